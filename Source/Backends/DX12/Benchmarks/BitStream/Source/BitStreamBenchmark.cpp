@@ -0,0 +1,570 @@
+// 
+// The MIT License (MIT)
+// 
+// Copyright (c) 2024 Advanced Micro Devices, Inc.,
+// Fatalist Development AB (Avalanche Studio Group),
+// and Miguel Petersen.
+// 
+// All Rights Reserved.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy 
+// of this software and associated documentation files (the "Software"), to deal 
+// in the Software without restriction, including without limitation the rights 
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies 
+// of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, 
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+// Layer
+#include <Backends/DX12/Compiler/DXIL/LLVM/LLVMBitStreamReader.h>
+#include <Backends/DX12/Compiler/DXIL/LLVM/LLVMBitStreamWriter.h>
+#include <Backends/DX12/Compiler/DXStream.h>
+
+// Std
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+/*
+ * Bit stream micro benchmark
+ *   Decodes every block and record of a corpus of DXIL bitcode, and re-encodes it with the
+ *   same abbreviations. Reports the throughput of both, and validates that the re-encoded
+ *   stream is bit-exact. Host independent, runs anywhere the headers compile.
+ *
+ *   Usage: GRS.Backends.DX12.BitStreamBenchmark [-iterations N] <file or directory>...
+ *   Files may either be raw bitcode or DXBC containers with a DXIL part.
+ */
+
+/// Abbreviation operand encodings
+enum class Encoding : uint8_t {
+    Literal = 0,
+    Fixed = 1,
+    VBR = 2,
+    Array = 3,
+    Char6 = 4,
+    Blob = 5
+};
+
+/// Single abbreviation operand
+struct AbbreviationParameter {
+    Encoding encoding;
+    uint64_t value;
+};
+
+/// Single abbreviation
+using Abbreviation = std::vector<AbbreviationParameter>;
+
+/// Walker state shared across blocks
+struct WalkState {
+    /// BLOCKINFO abbreviations per block id
+    std::map<uint32_t, std::vector<Abbreviation>> blockInfo;
+
+    /// Operand cache
+    std::vector<uint64_t> operands;
+};
+
+/// Transcodes all elements of a bit stream, optionally re-encoding them
+template<bool Write>
+struct Walker {
+    LLVMBitStreamReader& reader;
+    LLVMBitStreamWriter* writer;
+    WalkState& state;
+
+    /// Transcode a fixed width value
+    uint64_t Fixed(uint8_t width) {
+        uint64_t value = reader.Fixed<uint64_t>(width);
+        if constexpr (Write) {
+            writer->Fixed<uint64_t>(value, width);
+        }
+        return value;
+    }
+
+    /// Transcode a variable width value
+    uint64_t VBR(uint8_t width) {
+        uint64_t value = reader.VBR<uint64_t>(width);
+        if constexpr (Write) {
+            writer->VBR<uint64_t>(value, width);
+        }
+        return value;
+    }
+
+    /// Transcode a dword alignment
+    void AlignDWord() {
+        reader.AlignDWord();
+        if constexpr (Write) {
+            writer->AlignDWord();
+        }
+    }
+
+    /// Transcode an abbreviation definition
+    bool DefineAbbreviation(Abbreviation& abbreviation) {
+        const uint64_t count = VBR(5);
+
+        for (uint64_t i = 0; i < count; i++) {
+            AbbreviationParameter& parameter = abbreviation.emplace_back();
+
+            // Literal?
+            if (Fixed(1)) {
+                parameter.encoding = Encoding::Literal;
+                parameter.value = VBR(8);
+                continue;
+            }
+
+            parameter.encoding = static_cast<Encoding>(Fixed(3));
+            parameter.value = 0;
+
+            // Only fixed and variable width encodings carry a value
+            switch (parameter.encoding) {
+                default:
+                    return false;
+                case Encoding::Fixed:
+                case Encoding::VBR:
+                    parameter.value = VBR(5);
+                    break;
+                case Encoding::Array:
+                case Encoding::Char6:
+                case Encoding::Blob:
+                    break;
+            }
+        }
+
+        return !reader.IsError();
+    }
+
+    /// Transcode a single scalar operand
+    bool Scalar(const AbbreviationParameter& parameter, uint64_t& out) {
+        switch (parameter.encoding) {
+            default:
+                return false;
+            case Encoding::Literal:
+                out = parameter.value;
+                return true;
+            case Encoding::Fixed:
+                out = Fixed(static_cast<uint8_t>(parameter.value));
+                return true;
+            case Encoding::VBR:
+                out = VBR(static_cast<uint8_t>(parameter.value));
+                return true;
+            case Encoding::Char6:
+                out = static_cast<uint8_t>(reader.Char6());
+                if constexpr (Write) {
+                    writer->Char6(static_cast<char>(out));
+                }
+                return true;
+        }
+    }
+
+    /// Transcode an abbreviated record
+    bool AbbreviatedRecord(const Abbreviation& abbreviation) {
+        state.operands.clear();
+
+        for (size_t i = 0; i < abbreviation.size(); i++) {
+            const AbbreviationParameter& parameter = abbreviation[i];
+
+            switch (parameter.encoding) {
+                default: {
+                    uint64_t value;
+                    if (!Scalar(parameter, value)) {
+                        return false;
+                    }
+
+                    state.operands.push_back(value);
+                    break;
+                }
+                case Encoding::Array: {
+                    if (i + 2 != abbreviation.size()) {
+                        return false;
+                    }
+
+                    const AbbreviationParameter& contained = abbreviation[++i];
+
+                    // Bulk transcode
+                    const uint64_t count = VBR(6);
+                    const size_t offset = state.operands.size();
+                    state.operands.resize(offset + count);
+
+                    uint64_t* elements = state.operands.data() + offset;
+                    switch (contained.encoding) {
+                        default:
+                            return false;
+                        case Encoding::Literal:
+                            std::fill_n(elements, count, contained.value);
+                            break;
+                        case Encoding::Fixed:
+                            reader.FixedArray(elements, count, static_cast<uint8_t>(contained.value));
+                            if constexpr (Write) {
+                                writer->FixedArray(elements, count, static_cast<uint8_t>(contained.value));
+                            }
+                            break;
+                        case Encoding::VBR:
+                            reader.VBRArray(elements, count, static_cast<uint8_t>(contained.value));
+                            if constexpr (Write) {
+                                writer->VBRArray(elements, count, static_cast<uint8_t>(contained.value));
+                            }
+                            break;
+                        case Encoding::Char6:
+                            reader.Char6Array(elements, count);
+                            if constexpr (Write) {
+                                writer->Char6Array(elements, count);
+                            }
+                            break;
+                    }
+                    break;
+                }
+                case Encoding::Blob: {
+                    const uint64_t size = VBR(6);
+                    AlignDWord();
+
+                    // Bytes followed by tail padding
+                    const uint8_t* data = reader.GetSafeData();
+                    reader.Skip(static_cast<uint32_t>(size));
+                    reader.AlignDWord();
+
+                    if constexpr (Write) {
+                        const uint32_t dwordCount = static_cast<uint32_t>(size / sizeof(uint32_t));
+                        writer->WriteDWord(data, dwordCount);
+
+                        for (uint64_t byte = dwordCount * sizeof(uint32_t); byte < size; byte++) {
+                            writer->Fixed<uint8_t>(data[byte], 8);
+                        }
+
+                        writer->AlignDWord();
+                    }
+                    break;
+                }
+            }
+        }
+
+        return !reader.IsError();
+    }
+
+    /// Transcode the contents of a block
+    bool Block(uint32_t id, uint8_t abbreviationWidth) {
+        std::vector<Abbreviation> abbreviations;
+
+        // Abbreviations from BLOCKINFO are numbered first
+        const std::vector<Abbreviation>* info{nullptr};
+        if (auto it = state.blockInfo.find(id); it != state.blockInfo.end()) {
+            info = &it->second;
+        }
+
+        const size_t infoCount = info ? info->size() : 0;
+
+        // Target of BLOCKINFO records
+        uint32_t infoTarget = UINT32_MAX;
+
+        for (;;) {
+            if (reader.IsError() || reader.IsEOS()) {
+                return false;
+            }
+
+            const uint64_t abbreviationId = Fixed(abbreviationWidth);
+
+            switch (abbreviationId) {
+                case 0: {
+                    // END_BLOCK
+                    AlignDWord();
+                    return true;
+                }
+                case 1: {
+                    // ENTER_SUBBLOCK
+                    const auto childId = static_cast<uint32_t>(VBR(8));
+                    const auto childWidth = static_cast<uint8_t>(VBR(4));
+                    AlignDWord();
+
+                    // Length is patched on write, mirrors the stitching
+                    reader.Fixed<uint32_t>(32);
+
+                    LLVMBitStreamWriter::Position lengthPos{};
+                    if constexpr (Write) {
+                        lengthPos = writer->Fixed<uint32_t>(0);
+                    }
+
+                    if (!Block(childId, childWidth)) {
+                        return false;
+                    }
+
+                    if constexpr (Write) {
+                        writer->FixedPatch<uint32_t>(lengthPos, static_cast<uint32_t>(LLVMBitStreamWriter::Position::DWord(lengthPos, writer->Pos()) - 1));
+                    }
+                    break;
+                }
+                case 2: {
+                    // DEFINE_ABBREV
+                    Abbreviation abbreviation;
+                    if (!DefineAbbreviation(abbreviation)) {
+                        return false;
+                    }
+
+                    // BLOCKINFO definitions belong to the target block
+                    if (id == 0) {
+                        state.blockInfo[infoTarget].push_back(std::move(abbreviation));
+                    } else {
+                        abbreviations.push_back(std::move(abbreviation));
+                    }
+                    break;
+                }
+                case 3: {
+                    // UNABBREV_RECORD
+                    const uint64_t code = VBR(6);
+                    const uint64_t count = VBR(6);
+
+                    state.operands.resize(count);
+                    reader.VBRArray(state.operands.data(), count, 6);
+                    if constexpr (Write) {
+                        writer->VBRArray(state.operands.data(), count, 6);
+                    }
+
+                    // SETBID
+                    if (id == 0 && code == 1 && count) {
+                        infoTarget = static_cast<uint32_t>(state.operands[0]);
+                    }
+                    break;
+                }
+                default: {
+                    const uint64_t index = abbreviationId - 4;
+                    if (index >= infoCount + abbreviations.size()) {
+                        return false;
+                    }
+
+                    if (!AbbreviatedRecord(index < infoCount ? (*info)[index] : abbreviations[index - infoCount])) {
+                        return false;
+                    }
+                    break;
+                }
+            }
+        }
+    }
+
+    /// Transcode the whole stream
+    bool Stream(uint32_t byteLength) {
+        if (!reader.ValidateAndConsume()) {
+            return false;
+        }
+
+        if constexpr (Write) {
+            writer->AddHeaderValidation();
+        }
+
+        // Top level blocks, abbreviation width of 2
+        while (reader.GetBitOffset() + 32 <= byteLength * 8ull) {
+            if (Fixed(2) != 1) {
+                return false;
+            }
+
+            const auto id = static_cast<uint32_t>(VBR(8));
+            const auto width = static_cast<uint8_t>(VBR(4));
+            AlignDWord();
+
+            reader.Fixed<uint32_t>(32);
+
+            LLVMBitStreamWriter::Position lengthPos{};
+            if constexpr (Write) {
+                lengthPos = writer->Fixed<uint32_t>(0);
+            }
+
+            if (!Block(id, width)) {
+                return false;
+            }
+
+            if constexpr (Write) {
+                writer->FixedPatch<uint32_t>(lengthPos, static_cast<uint32_t>(LLVMBitStreamWriter::Position::DWord(lengthPos, writer->Pos()) - 1));
+            }
+        }
+
+        return !reader.IsError();
+    }
+};
+
+/// Single corpus entry
+struct Bitcode {
+    std::string path;
+    std::vector<uint8_t> file;
+    const uint8_t* data{nullptr};
+    uint32_t length{0};
+};
+
+/// Locate the bitcode of a file
+/// \return false if not bitcode
+static bool LocateBitcode(Bitcode& bitcode) {
+    const std::vector<uint8_t>& file = bitcode.file;
+
+    auto read32 = [&](size_t offset) {
+        uint32_t value = 0;
+        if (offset + sizeof(uint32_t) <= file.size()) {
+            std::memcpy(&value, file.data() + offset, sizeof(uint32_t));
+        }
+        return value;
+    };
+
+    // Raw bitcode?
+    if (file.size() >= 4 && file[0] == 'B' && file[1] == 'C' && file[2] == 0xC0 && file[3] == 0xDE) {
+        bitcode.data = file.data();
+        bitcode.length = static_cast<uint32_t>(file.size() & ~3ull);
+        return true;
+    }
+
+    // DXBC container?
+    if (read32(0) != 'CBXD') {
+        return false;
+    }
+
+    /*
+     * Container layout
+     *   [DXBC, hash[16], version, size, partCount, partOffsets[partCount]]
+     *   Part: [fourcc, size, data], DXIL part: [programVersion, dwordCount, DXIL, version, codeOffset, codeSize]
+     * */
+    const uint32_t partCount = read32(28);
+    for (uint32_t i = 0; i < partCount; i++) {
+        const uint32_t partOffset = read32(32 + i * 4);
+        if (read32(partOffset) != 'LIXD') {
+            continue;
+        }
+
+        const size_t programOffset = partOffset + 8;
+        const size_t identifierOffset = programOffset + 8;
+        const uint32_t codeOffset = read32(identifierOffset + 8);
+        const uint32_t codeSize = read32(identifierOffset + 12);
+
+        if (identifierOffset + codeOffset + codeSize > file.size()) {
+            return false;
+        }
+
+        bitcode.data = file.data() + identifierOffset + codeOffset;
+        bitcode.length = codeSize;
+        return true;
+    }
+
+    return false;
+}
+
+/// Load a file or directory into the corpus
+/// \param quiet do not report non-bitcode files, used for directory contents
+static void Load(const std::filesystem::path& path, std::vector<Bitcode>& corpus, bool quiet = false) {
+    if (std::filesystem::is_directory(path)) {
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(path)) {
+            if (entry.is_regular_file()) {
+                Load(entry.path(), corpus, true);
+            }
+        }
+        return;
+    }
+
+    std::ifstream stream(path, std::ios::binary);
+    if (!stream.good()) {
+        fprintf(stderr, "Failed to open '%s'\n", path.string().c_str());
+        return;
+    }
+
+    Bitcode bitcode;
+    bitcode.path = path.string();
+    bitcode.file.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+
+    if (!LocateBitcode(bitcode)) {
+        if (quiet) {
+            return;
+        }
+
+        fprintf(stderr, "Skipping '%s', no bitcode\n", bitcode.path.c_str());
+        return;
+    }
+
+    corpus.push_back(std::move(bitcode));
+}
+
+int main(int argc, char** argv) {
+    uint32_t iterations = 100;
+
+    // Gather corpus
+    std::vector<Bitcode> corpus;
+    for (int i = 1; i < argc; i++) {
+        if (!std::strcmp(argv[i], "-iterations") && i + 1 < argc) {
+            iterations = static_cast<uint32_t>(std::stoul(argv[++i]));
+            continue;
+        }
+
+        Load(argv[i], corpus);
+    }
+
+    if (corpus.empty()) {
+        fprintf(stderr, "Usage: %s [-iterations N] <file or directory>...\n", argv[0]);
+        return 1;
+    }
+
+    Allocators allocators;
+    WalkState state;
+
+    // Validate round trip before timing anything
+    uint64_t corpusBytes = 0;
+    for (const Bitcode& bitcode : corpus) {
+        DXStream out(allocators);
+
+        LLVMBitStreamReader reader(bitcode.data, bitcode.length);
+        LLVMBitStreamWriter writer(out);
+
+        state.blockInfo.clear();
+        if (!Walker<true>{reader, &writer, state}.Stream(bitcode.length)) {
+            fprintf(stderr, "Failed to transcode '%s'\n", bitcode.path.c_str());
+            return 1;
+        }
+
+        writer.Close();
+
+        if (out.GetByteSize() != bitcode.length || std::memcmp(out.GetData(), bitcode.data, bitcode.length)) {
+            fprintf(stderr, "Round trip of '%s' is not bit-exact\n", bitcode.path.c_str());
+            return 1;
+        }
+
+        corpusBytes += bitcode.length;
+    }
+
+    printf("Corpus: %zu modules, %.2f MB, round trip bit-exact\n", corpus.size(), corpusBytes / 1e6);
+
+    // Scan only
+    auto scanStart = std::chrono::steady_clock::now();
+    for (uint32_t iteration = 0; iteration < iterations; iteration++) {
+        for (const Bitcode& bitcode : corpus) {
+            LLVMBitStreamReader reader(bitcode.data, bitcode.length);
+            state.blockInfo.clear();
+            Walker<false>{reader, nullptr, state}.Stream(bitcode.length);
+        }
+    }
+    std::chrono::duration<double> scanElapsed = std::chrono::steady_clock::now() - scanStart;
+
+    // Scan and re-encode
+    DXStream out(allocators);
+    auto writeStart = std::chrono::steady_clock::now();
+    for (uint32_t iteration = 0; iteration < iterations; iteration++) {
+        for (const Bitcode& bitcode : corpus) {
+            out.Clear();
+
+            LLVMBitStreamReader reader(bitcode.data, bitcode.length);
+            LLVMBitStreamWriter writer(out);
+
+            state.blockInfo.clear();
+            Walker<true>{reader, &writer, state}.Stream(bitcode.length);
+            writer.Close();
+        }
+    }
+    std::chrono::duration<double> writeElapsed = std::chrono::steady_clock::now() - writeStart;
+
+    // Report
+    const double totalMB = corpusBytes * static_cast<double>(iterations) / 1e6;
+    printf("Scan:       %10.2f MB/s\n", totalMB / scanElapsed.count());
+    printf("Round trip: %10.2f MB/s\n", totalMB / writeElapsed.count());
+    return 0;
+}
@@ -59,4 +59,7 @@ private:
 private:
     /// Dynamic module
     HMODULE module{nullptr};
+
+    /// Sign with the in-process container hash?
+    bool useNativeSigning{true};
 };
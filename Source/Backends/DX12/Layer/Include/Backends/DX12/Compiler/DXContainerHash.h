@@ -0,0 +1,47 @@
+// 
+// The MIT License (MIT)
+// 
+// Copyright (c) 2024 Advanced Micro Devices, Inc.,
+// Fatalist Development AB (Avalanche Studio Group),
+// and Miguel Petersen.
+// 
+// All Rights Reserved.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy 
+// of this software and associated documentation files (the "Software"), to deal 
+// in the Software without restriction, including without limitation the rights 
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies 
+// of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, 
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma once
+
+// Std
+#include <cstdint>
+
+/// Size of a container digest
+static constexpr uint32_t kDXContainerDigestSize = 16;
+
+/// Compute the retail container hash, matching the digest written by the validators
+///   ! Platform independent, does not require any runtime components
+/// \param data data to be hashed
+/// \param byteCount number of bytes to be hashed
+/// \param digest destination digest
+void ComputeDXContainerHash(const void* data, uint32_t byteCount, uint8_t (&digest)[kDXContainerDigestSize]);
+
+/// Sign a DXBC / DXIL container in place
+///   Hashes all container contents following the digest and writes back the digest.
+/// \param code container code
+/// \param length byte length of the container
+/// \return false if the container is malformed
+bool SignDXContainer(void* code, uint64_t length);
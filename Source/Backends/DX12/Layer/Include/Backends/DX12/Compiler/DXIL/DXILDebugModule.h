@@ -31,15 +31,29 @@
 #include <Backends/DX12/Compiler/IDXDebugModule.h>
 
 // Common
+#include <Common/ComRef.h>
 #include <Common/Containers/LinearBlockAllocator.h>
 
 // Std
 #include <string>
+#include <mutex>
+#include <atomic>
+
+// Forward declarations
+class ShaderSourceStore;
+struct ShaderSourceBlob;
 
 struct DXILDebugModule final : public IDXDebugModule {
-    DXILDebugModule(const Allocators &allocators);
+    /// Constructor
+    /// \param allocators shared allocators
+    /// \param sourceStore shared store, the source contents are deduplicated across modules
+    DXILDebugModule(const Allocators &allocators, const ComRef<ShaderSourceStore>& sourceStore);
+
+    /// Deconstructor
+    ~DXILDebugModule();
 
     /// Parse the DXIL bytecode
+    ///   ! Parsing is deferred until the first query, the byte code must outlive this module
     /// \param byteCode code start
     /// \param byteLength byte size of code
     /// \return success state
@@ -55,6 +69,14 @@ struct DXILDebugModule final : public IDXDebugModule {
     void FillCombinedSource(uint32_t fileUID, char *buffer) const override;
 
 private:
+    /// Materialize the module if not already done
+    /// \return success state
+    bool Materialize() const;
+
+    /// Scan and parse the deferred byte code
+    /// \return success state
+    bool ParseDeferred();
+
     /// Parse all types
     /// \param block source block
     void ParseTypes(LLVMBlock* block);
@@ -89,6 +111,9 @@ private:
     /// Remap all line scopes for unresolved metadata
     void RemapLineScopes();
 
+    /// Move all parsed contents to the shared store
+    void FinalizeSources();
+
     /// Get the linear file index
     /// \param scopeMdId scope id
     uint32_t GetLinearFileUID(uint32_t scopeMdId);
@@ -97,6 +122,15 @@ private:
     /// Scanner
     DXILPhysicalBlockScan scan;
 
+    /// Deferred byte code
+    const void* deferredByteCode{nullptr};
+    uint64_t deferredByteLength{0};
+
+    /// Materialization state
+    mutable std::mutex materializeMutex;
+    mutable std::atomic<bool> materialized{false};
+    mutable bool materializeResult{false};
+
 private:
     struct SourceFragmentDirective {
         /// File identifier
@@ -110,22 +144,25 @@ private:
     };
     
     struct SourceFragment {
-        SourceFragment(const Allocators& allocators) : lineOffsets(allocators), preprocessedDirectives(allocators) {
+        SourceFragment(const Allocators& allocators) : preprocessedDirectives(allocators) {
             /** */
         }
         
         /// Filename of this fragment
         std::string filename;
 
-        /// Total contents of this fragment
-        std::string contents;
+        /// Contents of this fragment during parsing, moved to the blob on finalization
+        std::string pendingContents;
+
+        /// Number of lines in the pending contents, zero if not filled
+        uint32_t lineCount{0};
+
+        /// Shared contents and line offsets, null if not filled
+        const ShaderSourceBlob* blob{nullptr};
 
         /// Identifier of this file
         uint16_t uid{0};
 
-        /// All summarized line offsets, including base (0) line
-        Vector<uint32_t> lineOffsets;
-
         /// All preprocessed fragments within this, f.x. files on line directives
         Vector<SourceFragmentDirective> preprocessedDirectives;
     };
@@ -144,6 +181,9 @@ private:
     /// All source fragments within a module
     Vector<SourceFragment> sourceFragments;
 
+    /// Shared source store
+    ComRef<ShaderSourceStore> sourceStore;
+
 private:
     struct InstructionMetadata {
         /// Optional source association to the fragments
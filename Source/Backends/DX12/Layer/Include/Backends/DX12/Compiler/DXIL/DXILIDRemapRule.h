@@ -26,9 +26,10 @@
 
 #pragma once
 
+///  ? Values are the operand offset of the rule
 enum class DXILIDRemapRule {
-    None,
+    None = 0,
 
     /// Id values offset by 1
-    Nullable
+    Nullable = 1
 };
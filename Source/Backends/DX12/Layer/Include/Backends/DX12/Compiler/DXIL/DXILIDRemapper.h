@@ -43,6 +43,7 @@
 
 // Std
 #include <vector>
+#include <algorithm>
 
 struct DXILIDRemapper {
     struct Anchor {
@@ -95,13 +96,15 @@ struct DXILIDRemapper {
     /// \param user user modified program bound
     void SetBound(uint32_t source, uint32_t user) {
         stitchSegment.sourceMappings.resize(source, ~0u);
+        identityBound = std::min(identityBound, source);
         compileSegment.userMappings.resize(user, UserMapping {.index = ~0u, .type = DXILIDUserType::Singular});
     }
 
     /// Allocate a source record value
     uint32_t AllocSourceMapping(uint32_t sourceResult) {
+        ASSERT(sourceResult < stitchSegment.sourceMappings.size(), "Source mapping out of bounds");
         uint32_t valueId = stitchSegment.allocationIndex++;
-        stitchSegment.sourceMappings.at(sourceResult) = valueId;
+        AssignSourceMapping(sourceResult, valueId);
         return valueId;
     }
 
@@ -109,7 +112,8 @@ struct DXILIDRemapper {
     /// \param sourceResult original source index
     /// \param valueId stitched value index
     void SetSourceMapping(uint32_t sourceResult, uint32_t valueId) {
-        stitchSegment.sourceMappings.at(sourceResult) = valueId;
+        ASSERT(sourceResult < stitchSegment.sourceMappings.size(), "Source mapping out of bounds");
+        AssignSourceMapping(sourceResult, valueId);
     }
 
     /// Allocate a user mapping
@@ -173,82 +177,55 @@ struct DXILIDRemapper {
     /// \param value source operand
     /// \param rule given rule
     /// \return operand
-    uint64_t RemoveRemapRule(uint64_t value, DXILIDRemapRule rule) {
-        switch (rule) {
-            default:
-                ASSERT(false, "Invalid remap rule");
-                return ~0ull;
-            case DXILIDRemapRule::None:
-                return value;
-            case DXILIDRemapRule::Nullable:
-                ASSERT(value > 0, "Nullable remap with zero value");
-                return value - 1;
-        }
+    static uint64_t RemoveRemapRule(uint64_t value, DXILIDRemapRule rule) {
+        ASSERT(rule == DXILIDRemapRule::None || value > 0, "Nullable remap with zero value");
+        return value - static_cast<uint64_t>(rule);
     }
 
     /// Apply the remapping rule to an operand
     /// \param value source operand
     /// \param rule given rule
     /// \return operand
-    uint64_t ApplyRemapRule(uint64_t value, DXILIDRemapRule rule) {
-        switch (rule) {
-            default:
-                ASSERT(false, "Invalid remap rule");
-                return ~0ull;
-            case DXILIDRemapRule::None:
-                return value;
-            case DXILIDRemapRule::Nullable:
-                ASSERT(value > 0, "Nullable remap with zero value");
-                return value + 1;
-        }
+    static uint64_t ApplyRemapRule(uint64_t value, DXILIDRemapRule rule) {
+        return value + static_cast<uint64_t>(rule);
     }
 
     /// Remap a DXIL value
     /// \param source source DXIL value
     void Remap(uint64_t &source, DXILIDRemapRule rule = DXILIDRemapRule::None) {
-        // Original source mappings are allocated at a given range
-        if (IsSourceOperand(source)) {
-            uint64_t unmapped = RemoveRemapRule(source, rule);
+        uint32_t mapping = GetAbsoluteMapping(source, rule);
 
-            uint32_t mapping = stitchSegment.sourceMappings.at(unmapped);
-            if (mapping == ~0u) {
-                // Mapping doesn't exist yet, add as unresolved
-                unresolvedReferences.Add(UnresolvedReferenceEntry{
-                    .source = &source,
-                    .absolute = unmapped,
-                    .rule = rule
-                });
-
-                // Sanity
-#ifndef NDEBUG
-                source = ~0u;
-#endif // NDEBUG
+        // Mapping doesn't exist yet, add as unresolved
+        if (mapping == ~0u) {
+            AddUnresolvedReference(source, rule);
+            return;
+        }
 
-                return;
+        // Assign source to new mapping
+        source = ApplyRemapRule(mapping, rule);
+    }
+
+    /// Remap a contiguous range of DXIL values
+    ///   Values within the identity mapped source prefix are left untouched without a lookup
+    /// \param source first source DXIL value
+    /// \param count number of values
+    void RemapArray(uint64_t* source, uint32_t count, DXILIDRemapRule rule = DXILIDRemapRule::None) {
+        for (uint32_t i = 0; i < count; i++) {
+            // Mapped to itself? User operands are never below the bound
+            if (source[i] - static_cast<uint64_t>(rule) < identityBound) {
+                continue;
             }
 
-            // Assign source to new mapping
-            source = ApplyRemapRule(mapping, rule);
-        } else {
-            uint32_t mapping = compileSegment.userMappings.at(DecodeUserOperand(source)).index;
-            if (mapping == ~0u) {
-                // Mapping doesn't exist yet, add as unresolved
-                unresolvedReferences.Add(UnresolvedReferenceEntry{
-                    .source = &source,
-                    .absolute = source,
-                    .rule = rule
-                });
-
-                // Sanity
-#ifndef NDEBUG
-                source = ~0u;
-#endif // NDEBUG
+            uint32_t mapping = GetAbsoluteMapping(source[i], rule);
 
-                return;
+            // Mapping doesn't exist yet, add as unresolved
+            if (mapping == ~0u) {
+                AddUnresolvedReference(source[i], rule);
+                continue;
             }
 
             // Assign source to new mapping
-            source = ApplyRemapRule(mapping, rule);
+            source[i] = ApplyRemapRule(mapping, rule);
         }
     }
 
@@ -278,13 +255,17 @@ struct DXILIDRemapper {
             ASSERT(record.sourceAnchor != ~0u, "Source operand on a user record");
 
             // Forward?
-            uint32_t mapping;
+            uint32_t absolute;
             if (source <= record.sourceAnchor) {
-                mapping = stitchSegment.sourceMappings.at(record.sourceAnchor - source);
+                absolute = record.sourceAnchor - static_cast<uint32_t>(source);
             } else {
-                mapping = stitchSegment.sourceMappings.at(record.sourceAnchor + DXILIDRemapper::DecodeForward(static_cast<uint32_t>(source)));
+                absolute = record.sourceAnchor + DXILIDRemapper::DecodeForward(static_cast<uint32_t>(source));
             }
 
+            // Get mapping
+            ASSERT(absolute < stitchSegment.sourceMappings.size(), "Source mapping out of bounds");
+            uint32_t mapping = stitchSegment.sourceMappings[absolute];
+
             // If failed, this may be a replaced identifier, try user space
             if (mapping == ~0u) {
                 // Get mapped identifier
@@ -319,6 +300,35 @@ struct DXILIDRemapper {
         return absoluteRemap > anchor.stitchAnchor;
     }
 
+    /// Remap a contiguous range of relative DXIL values
+    ///   Backward references into the identity mapped source prefix are re-encoded without a lookup
+    /// \param anchor source anchor
+    /// \param record source record
+    /// \param source first source DXIL value
+    /// \param count number of values
+    void RemapRelativeArray(const Anchor &anchor, const LLVMRecord &record, uint64_t* source, uint32_t count) {
+        // User records have no source operands
+        if (record.sourceAnchor == ~0u) {
+            for (uint32_t i = 0; i < count; i++) {
+                RemapRelative(anchor, record, source[i]);
+            }
+            return;
+        }
+
+        for (uint32_t i = 0; i < count; i++) {
+            // Backward source reference mapped to itself?
+            if (source[i] <= record.sourceAnchor) {
+                uint32_t absolute = record.sourceAnchor - static_cast<uint32_t>(source[i]);
+                if (absolute < identityBound) {
+                    source[i] = anchor.stitchAnchor - absolute;
+                    continue;
+                }
+            }
+
+            RemapRelative(anchor, record, source[i]);
+        }
+    }
+
     /// Remap a DXIL value
     /// \param source source DXIL value
     void RemapUnresolvedReference(const Anchor &anchor, const LLVMRecord &record, uint64_t &source) {
@@ -365,38 +375,19 @@ struct DXILIDRemapper {
     }
 
     /// Resolve all unresolved references
+    ///  ? Resolved references are released, subsequent resolves only visit new references
     void ResolveForwardReferences() {
         for (const UnresolvedReferenceEntry &entry: unresolvedReferences) {
-            uint32_t absoluteRemap;
-
-            // Original source mappings are allocated at a given range
-            if (IsSourceOperand(entry.absolute)) {
-                uint32_t mapping = stitchSegment.sourceMappings.at(entry.absolute);
-                ASSERT(mapping != ~0u, "Remapped not found on source operand");
-                absoluteRemap = mapping;
-            } else {
-                uint32_t mapping = compileSegment.userMappings.at(DecodeUserOperand(entry.absolute)).index;
-                ASSERT(mapping != ~0u, "Remapped not found on user operand");
-                absoluteRemap = mapping;
-            }
+            uint32_t absoluteRemap = GetAbsoluteMapping(entry.absolute, DXILIDRemapRule::None);
+            ASSERT(absoluteRemap != ~0u, "Remapped not found on operand");
 
             // Re-encode relative
             *entry.source = ApplyRemapRule(absoluteRemap, entry.rule);
         }
 
         for (const UnresolvedForwardReferenceEntry &entry: unresolvedForwardReferences) {
-            uint32_t absoluteRemap;
-
-            // Original source mappings are allocated at a given range
-            if (IsSourceOperand(entry.absolute)) {
-                uint32_t mapping = stitchSegment.sourceMappings.at(entry.absolute);
-                ASSERT(mapping != ~0u, "Remapped not found on source operand");
-                absoluteRemap = mapping;
-            } else {
-                uint32_t mapping = compileSegment.userMappings.at(DecodeUserOperand(entry.absolute)).index;
-                ASSERT(mapping != ~0u, "Remapped not found on user operand");
-                absoluteRemap = mapping;
-            }
+            uint32_t absoluteRemap = GetAbsoluteMapping(entry.absolute, DXILIDRemapRule::None);
+            ASSERT(absoluteRemap != ~0u, "Remapped not found on operand");
 
 #ifndef NDEBUG
             if (absoluteRemap == ~0u) {
@@ -411,20 +402,24 @@ struct DXILIDRemapper {
             // Re-encode relative
             *entry.source = LLVMBitStreamWriter::EncodeSigned(relative);
         }
+
+        // All resolved
+        unresolvedReferences.Clear();
+        unresolvedForwardReferences.Clear();
     }
 
     /// Try to remap a DXIL value
     /// \param source source DXIL value
     /// \return remapped value, UINT32_MAX if not found
     uint32_t TryGetSourceMapping(uint32_t source) {
-        return source < stitchSegment.sourceMappings.size() ? stitchSegment.sourceMappings.at(source) : ~0u;
+        return source < stitchSegment.sourceMappings.size() ? stitchSegment.sourceMappings[source] : ~0u;
     }
 
     /// Try to remap a DXIL value
     /// \param source source DXIL value
     /// \return remapped value, UINT32_MAX if not found
     uint32_t TryGetUserMapping(uint32_t user) {
-        return user < compileSegment.userMappings.size() ? compileSegment.userMappings.at(user).index : ~0u;
+        return user < compileSegment.userMappings.size() ? compileSegment.userMappings[user].index : ~0u;
     }
 
     /// Get the user mapping
@@ -640,6 +635,7 @@ public:
     void Revert(const StitchSnapshot& from) {
         stitchSegment.allocationIndex = from.allocationIndex;
         stitchSegment.sourceMappings.resize(from.sourceMappingOffset);
+        identityBound = std::min(identityBound, static_cast<uint32_t>(from.sourceMappingOffset));
     }
 
     /// Merge a branch
@@ -650,11 +646,11 @@ public:
 
         // Move user
         compileSegment.userMappings.resize(remote.head.userMappingOffset + remote.userMappings.size());
-        std::memcpy(compileSegment.userMappings.data() + remote.head.userMappingOffset, remote.userMappings.data(), sizeof(uint32_t) * remote.userMappings.size());
+        std::memcpy(compileSegment.userMappings.data() + remote.head.userMappingOffset, remote.userMappings.data(), sizeof(UserMapping) * remote.userMappings.size());
 
         // Move redirect
         compileSegment.userRedirects.resize(remote.head.userRedirectsOffset + remote.userRedirects.size());
-        std::memcpy(compileSegment.userRedirects.data() + remote.head.userRedirectsOffset, remote.userRedirects.data(), sizeof(uint32_t) * remote.userRedirects.size());
+        std::memcpy(compileSegment.userRedirects.data() + remote.head.userRedirectsOffset, remote.userRedirects.data(), sizeof(uint64_t) * remote.userRedirects.size());
     }
 
     /// Merge a branch
@@ -669,6 +665,68 @@ public:
         // Move source
         stitchSegment.sourceMappings.resize(remote.head.sourceMappingOffset + remote.sourceMappings.size());
         std::memcpy(stitchSegment.sourceMappings.data() + remote.head.sourceMappingOffset, remote.sourceMappings.data(), sizeof(uint32_t) * remote.sourceMappings.size());
+        ExtendIdentityBound();
+    }
+
+    /// Get the number of leading source values mapped to themselves
+    uint32_t GetIdentityBound() const {
+        return identityBound;
+    }
+
+private:
+    /// Assign a source mapping, keeps the identity bound
+    /// \param sourceResult original source index
+    /// \param valueId stitched value index
+    void AssignSourceMapping(uint32_t sourceResult, uint32_t valueId) {
+        stitchSegment.sourceMappings[sourceResult] = valueId;
+
+        // Mapped elsewhere within the prefix?
+        if (sourceResult < identityBound && sourceResult != valueId) {
+            identityBound = sourceResult;
+        }
+
+        ExtendIdentityBound();
+    }
+
+    /// Extend the identity bound over all subsequent source values mapped to themselves
+    void ExtendIdentityBound() {
+        while (identityBound < stitchSegment.sourceMappings.size() && stitchSegment.sourceMappings[identityBound] == identityBound) {
+            identityBound++;
+        }
+    }
+
+    /// Get the absolute mapping of an operand
+    /// \param source source or user operand
+    /// \param rule remapping rule of the operand
+    /// \return UINT32_MAX if not mapped yet
+    uint32_t GetAbsoluteMapping(uint64_t source, DXILIDRemapRule rule) const {
+        // Original source mappings are allocated at a given range
+        if (IsSourceOperand(source)) {
+            uint64_t unmapped = RemoveRemapRule(source, rule);
+            ASSERT(unmapped < stitchSegment.sourceMappings.size(), "Source mapping out of bounds");
+            return stitchSegment.sourceMappings[unmapped];
+        }
+
+        // User mapping
+        IL::ID user = DecodeUserOperand(source);
+        ASSERT(user < compileSegment.userMappings.size(), "User mapping out of bounds");
+        return compileSegment.userMappings[user].index;
+    }
+
+    /// Add an unresolved reference
+    /// \param source source operand, resolved in place
+    /// \param rule remapping rule of the operand
+    void AddUnresolvedReference(uint64_t& source, DXILIDRemapRule rule) {
+        unresolvedReferences.Add(UnresolvedReferenceEntry{
+            .source = &source,
+            .absolute = IsSourceOperand(source) ? RemoveRemapRule(source, rule) : source,
+            .rule = rule
+        });
+
+        // Sanity
+#ifndef NDEBUG
+        source = ~0u;
+#endif // NDEBUG
     }
 
 private:
@@ -696,6 +754,9 @@ private:
     CompileSegment compileSegment;
     StitchSegment stitchSegment;
 
+    /// Number of leading source values mapped to themselves, i.e. untouched by instrumentation
+    uint32_t identityBound{0};
+
     /// Shared id map
     DXILIDMap& idMap;
 };
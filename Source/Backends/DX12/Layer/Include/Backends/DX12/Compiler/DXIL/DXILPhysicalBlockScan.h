@@ -76,6 +76,7 @@ public:
     void Stitch(DXStream& out);
 
     /// Copy to a new table
+    ///   ! Blocks never modified in place share their record operands with this scan, the copy must not outlive it
     /// \param out the destination table
     void CopyTo(DXILPhysicalBlockScan& out);
 
@@ -98,8 +99,14 @@ private:
     
     /// Copy a block
     /// \param block source block
+    /// \param shareOperands if true, the record operands are shared with the source block
     /// \param out destination block
-    void CopyBlock(const LLVMBlock* block, LinearBlockAllocator<sizeof(uint64_t) * 1024u>& outRecordAllocator, LLVMBlock& out);
+    void CopyBlock(const LLVMBlock* block, LinearBlockAllocator<sizeof(uint64_t) * 1024u>& outRecordAllocator, bool shareOperands, LLVMBlock& out);
+
+    /// Check if the records of a block are never modified in place after scanning
+    /// \param id block identifier
+    /// \return true if immutable
+    static bool IsImmutableRecordBlock(uint32_t id);
 
 private:
     /// Result of a scanning operation
@@ -55,6 +55,17 @@ public:
     /// \return false if failed
     bool Sign(void* code, uint64_t length);
 
+private:
+    /// Install the validator
+    /// \return false if failed
+    bool InstallValidator();
+
+    /// Sign a DXIL blob through the validator
+    /// \param code blob code
+    /// \param length blob length
+    /// \return false if failed
+    bool SignWithValidator(void* code, uint64_t length);
+
 private:
     /// Objects
     Microsoft::WRL::ComPtr<IDxcLibrary> library;
@@ -67,4 +78,7 @@ private:
 
     /// Signing required?
     bool needsSigning{true};
+
+    /// Sign with the in-process container hash?
+    bool useNativeSigning{true};
 };
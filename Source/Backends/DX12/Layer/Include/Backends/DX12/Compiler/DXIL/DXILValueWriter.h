@@ -100,6 +100,23 @@ struct DXILValueWriter {
         }
     }
 
+    /// Remap a range of relative values
+    /// \param anchor the stitch anchor
+    /// \param count number of values
+    void RemapRelativeRange(DXILIDRemapper::Anchor& anchor, uint32_t count) {
+        // Split operands, copy before remapping in place
+        if (destOperands != record.ops) {
+            std::memcpy(destOperands + destOffset, record.ops + sourceOffset, sizeof(uint64_t) * count);
+        }
+
+        // Remap destination in place
+        table.idRemapper.RemapRelativeArray(anchor, record, destOperands + destOffset, count);
+
+        // Offset both
+        sourceOffset += count;
+        destOffset += count;
+    }
+
     /// Skip a number of operands
     /// \param count operands to skip
     void Skip(uint32_t count) {
@@ -28,20 +28,22 @@
 
 // Std
 #include <cstdint>
+#include <cstddef>
+#include <cstring>
 #include <algorithm>
+#include <type_traits>
 
 // Common
 #include <Common/Assert.h>
 
 /// Bit stream reader
+///   Bits are consumed from a 64 bit buffer which is refilled on exhaustion, keeping
+///   the common paths free of stream bounds and word straddling checks.
 struct LLVMBitStreamReader {
-    template<typename T>
-    using ChunkType = std::conditional_t<(sizeof(T) > 4), uint64_t, uint32_t>;
-
     LLVMBitStreamReader(const void *ptr, uint32_t length) :
-        start(reinterpret_cast<const uint64_t *>(ptr)),
-        ptr(reinterpret_cast<const uint64_t *>(ptr)),
-        end(reinterpret_cast<const uint64_t *>(ptr) + length) {
+        start(static_cast<const uint8_t *>(ptr)),
+        next(static_cast<const uint8_t *>(ptr)),
+        end(static_cast<const uint8_t *>(ptr) + length) {
         /* */
     }
 
@@ -94,26 +96,17 @@ struct LLVMBitStreamReader {
     /// \return accumulated value
     template<typename T>
     T VBR(uint8_t bitWidth) {
-        using TChunk = ChunkType<T>;
-
-        T value = 0;
-
-        uint8_t chunkBitOffset = 1 << (bitWidth - 1);
-
-        TChunk mask = chunkBitOffset - 1;
+        ASSERT(bitWidth > 1 && bitWidth <= 32, "Invalid VBR width");
 
-        for (TChunk shift = 0;; shift += (bitWidth - 1)) {
-            auto chunk = Variable<TChunk>(bitWidth);
+        const uint64_t continuation = 1ull << (bitWidth - 1);
 
-            value += (chunk & mask) << shift;
-
-            // Next chunk?
-            if (!(chunk & chunkBitOffset)) {
-                break;
-            }
+        // Single chunk values are by far the most common
+        uint64_t chunk = Variable<uint64_t>(bitWidth);
+        if (!(chunk & continuation)) {
+            return static_cast<T>(chunk);
         }
 
-        return value;
+        return static_cast<T>(VBRContinued(chunk, bitWidth));
     }
 
     /// Decode a signed LLVM value
@@ -124,42 +117,114 @@ struct LLVMBitStreamReader {
 
     /// Align the stream to 32 bits
     void AlignDWord() {
-        if (bitOffset % 32 == 0) {
-            return;
-        }
-
-        // On dword boundary?
-        if (bitOffset < 32) {
-            bitOffset = 32;
-        } else {
-            bitOffset = 0;
-            ptr++;
+        if (uint32_t misalignment = static_cast<uint32_t>(GetBitOffset() % 32)) {
+            Variable<uint32_t>(static_cast<uint8_t>(32u - misalignment));
         }
     }
 
     /// Read the char6 value
     /// \return read value
     char Char6() {
-        auto encoded = Variable<uint8_t>(6);
-
-        if (encoded <= 25) {
-            return char('a' + encoded);
-        } else if (encoded <= 51) {
-            return char('A' + encoded - 26);
-        } else if (encoded <= 61) {
-            return char('0' + encoded - 52);
-        } else if (encoded == 62) {
-            return '.';
-        } else if (encoded == 63) {
-            return '_';
+        return kChar6Table[Variable<uint8_t>(6)];
+    }
+
+    /// Consume an array of variable width values
+    /// \param out destination of all values
+    /// \param count number of values
+    /// \param bitWidth the bit width of each chunk
+    void VBRArray(uint64_t* out, uint64_t count, uint8_t bitWidth) {
+        ASSERT(bitWidth > 1 && bitWidth <= 32, "Invalid VBR width");
+
+        const uint64_t continuation = 1ull << (bitWidth - 1);
+        const uint64_t mask = kMaskTable[bitWidth];
+
+        // Local copies, the output may otherwise alias the buffer
+        uint64_t localBuffer = buffer;
+        uint32_t localBits = bufferBits;
+
+        for (uint64_t i = 0; i < count; i++) {
+            // Decode single chunk values straight from the buffer
+            const uint64_t chunk = localBuffer & mask;
+            if (localBits >= bitWidth && !(chunk & continuation)) {
+                out[i] = chunk;
+                localBuffer >>= bitWidth;
+                localBits -= bitWidth;
+                continue;
+            }
+
+            // Refill or multi chunk value
+            buffer = localBuffer;
+            bufferBits = localBits;
+            out[i] = VBR<uint64_t>(bitWidth);
+            localBuffer = buffer;
+            localBits = bufferBits;
         }
 
-        // Debugging
-        ASSERT(false, "Invalid Char6 in LLVM bit-stream");
+        buffer = localBuffer;
+        bufferBits = localBits;
+    }
+
+    /// Consume an array of fixed width values
+    /// \param out destination of all values
+    /// \param count number of values
+    /// \param fixedWidth bit width of each value
+    void FixedArray(uint64_t* out, uint64_t count, uint8_t fixedWidth) {
+        ASSERT(fixedWidth <= 64, "Fixed width must be less or equal to 64 bits");
+
+        const uint64_t mask = kMaskTable[fixedWidth];
+
+        // Local copies, the output may otherwise alias the buffer
+        uint64_t localBuffer = buffer;
+        uint32_t localBits = bufferBits;
+
+        for (uint64_t i = 0; i < count; i++) {
+            // Decode straight from the buffer, never consumes the full buffer
+            if (localBits > fixedWidth) {
+                out[i] = localBuffer & mask;
+                localBuffer >>= fixedWidth;
+                localBits -= fixedWidth;
+                continue;
+            }
+
+            // Refill
+            buffer = localBuffer;
+            bufferBits = localBits;
+            out[i] = Variable<uint64_t>(fixedWidth);
+            localBuffer = buffer;
+            localBits = bufferBits;
+        }
 
-        // Mark as failed
-        errorState = true;
-        return 0x0;
+        buffer = localBuffer;
+        bufferBits = localBits;
+    }
+
+    /// Consume an array of char6 values
+    /// \param out destination of all values
+    /// \param count number of values
+    void Char6Array(uint64_t* out, uint64_t count) {
+        // Local copies, the output may otherwise alias the buffer
+        uint64_t localBuffer = buffer;
+        uint32_t localBits = bufferBits;
+
+        for (uint64_t i = 0; i < count; i++) {
+            // Decode straight from the buffer
+            if (localBits >= 6) {
+                out[i] = static_cast<uint8_t>(kChar6Table[localBuffer & 0x3F]);
+                localBuffer >>= 6;
+                localBits -= 6;
+                continue;
+            }
+
+            // Refill
+            buffer = localBuffer;
+            bufferBits = localBits;
+            out[i] = static_cast<uint8_t>(Char6());
+            localBuffer = buffer;
+            localBits = bufferBits;
+        }
+
+        buffer = localBuffer;
+        bufferBits = localBits;
     }
 
     /// Read a variable width data type
@@ -168,75 +233,164 @@ struct LLVMBitStreamReader {
     /// \return read value
     template<typename T>
     T Variable(uint8_t count) {
-        uint8_t available = 64u - bitOffset;
-
-        T mask = static_cast<T>((1ull << count) - 1ull);
-
-        T data;
-        if (count > available) {
-            data = static_cast<T>((*ptr >> bitOffset) | (*(ptr + 1) << available));
-        } else {
-            data = static_cast<T>(*ptr >> bitOffset);
+        // Fully buffered?
+        if (count <= bufferBits) {
+            uint64_t data = buffer & kMaskTable[count];
+            buffer = count < 64 ? buffer >> count : 0;
+            bufferBits -= count;
+            return static_cast<T>(data);
         }
 
-        bitOffset += count;
-
-        ptr += bitOffset / 64;
-        bitOffset = bitOffset % 64;
-
-        return data & mask;
+        return static_cast<T>(VariableRefill(count));
     }
 
     /// Get the safe data address for a given bit offset
     ///   ! Must be aligned to 8 bits
     /// \return the data address
     const uint8_t* GetSafeData() const {
-        ASSERT(bitOffset % 8 == 0, "Unaligned data access, align beforehand");
-        return reinterpret_cast<const uint8_t*>(ptr) + (bitOffset / 8);
+        ASSERT(GetBitOffset() % 8 == 0, "Unaligned data access, align beforehand");
+        return start + GetBitOffset() / 8;
     }
 
     /// Skip a number of bytes
     /// \param byteCount number of bytes to skip
     void Skip(uint32_t byteCount) {
-        uint32_t bits = byteCount * 8;
+        Seek(GetBitOffset() + static_cast<uint64_t>(byteCount) * 8);
+    }
+
+    /// Is this stream EOS?
+    bool IsEOS() const {
+        return !bufferBits && next >= end;
+    }
 
-        // Number of remaining bits
-        uint8_t boundaryBits = 64u - bitOffset;
+    /// Get the current bit offset from the start of the stream
+    uint64_t GetBitOffset() const {
+        return static_cast<uint64_t>(next - start) * 8 - bufferBits;
+    }
 
-        // Within the boundary?
-        if (bits <= boundaryBits) {
-            bitOffset += bits;
+private:
+    /// Refill the buffer, consumes up to 8 bytes
+    void Refill() {
+        if (end - next >= static_cast<ptrdiff_t>(sizeof(uint64_t))) {
+            std::memcpy(&buffer, next, sizeof(uint64_t));
+            next += sizeof(uint64_t);
+            bufferBits = 64;
+            return;
+        }
 
-            // On the boundary?
-            if (bits == 64) {
-                ptr++;
-                bitOffset = 0;
-            }
-        } else {
-            // Push boundary
-            bits -= boundaryBits;
+        // Tail of the stream
+        buffer = 0;
+        bufferBits = 0;
+        while (next < end) {
+            buffer |= static_cast<uint64_t>(*next++) << bufferBits;
+            bufferBits += 8;
+        }
+    }
+
+    /// Read a variable width data type straddling the buffer
+    /// \param count bit count
+    /// \return read value
+    uint64_t VariableRefill(uint8_t count) {
+        // Remaining low bits, always less than the count
+        uint64_t low = buffer;
+        uint32_t lowBits = bufferBits;
+
+        // Fill up
+        Refill();
+
+        // Out of data?
+        uint32_t highBits = count - lowBits;
+        if (highBits > bufferBits) {
+            errorState = true;
+            buffer = 0;
+            bufferBits = 0;
+            return low;
+        }
+
+        // Consume high bits
+        uint64_t high = buffer & kMaskTable[highBits];
+        buffer = highBits < 64 ? buffer >> highBits : 0;
+        bufferBits -= highBits;
+
+        return low | (high << lowBits);
+    }
 
-            // Push number of full 64 advances (+1 for the boundary)
-            ptr += 1 + (bits / 64);
+    /// Decode the remaining chunks of a variable width value
+    /// \param chunk the first chunk
+    /// \param bitWidth the bit width of each chunk
+    /// \return accumulated value
+    uint64_t VBRContinued(uint64_t chunk, uint8_t bitWidth) {
+        const uint32_t payloadWidth = bitWidth - 1u;
+        const uint64_t continuation = 1ull << payloadWidth;
+
+        uint64_t value = chunk & (continuation - 1);
 
-            // Push remaining
-            bitOffset = bits % 64;
+        for (uint32_t shift = payloadWidth; chunk & continuation; shift += payloadWidth) {
+            // Malformed values exceeding 64 bits
+            if (shift >= 64) {
+                errorState = true;
+                break;
+            }
+
+            chunk = Variable<uint64_t>(bitWidth);
+            value |= (chunk & (continuation - 1)) << shift;
         }
+
+        return value;
     }
 
-    /// Is this stream EOS?
-    bool IsEOS() const {
-        return ptr >= end;
+    /// Seek to a bit offset from the start of the stream
+    /// \param bitOffset bit offset
+    void Seek(uint64_t bitOffset) {
+        buffer = 0;
+        bufferBits = 0;
+
+        // Out of bounds?
+        if (bitOffset > static_cast<uint64_t>(end - start) * 8) {
+            errorState = true;
+            next = end;
+            return;
+        }
+
+        // Consume the unaligned bits
+        next = start + bitOffset / 8;
+        if (uint32_t bits = static_cast<uint32_t>(bitOffset % 8)) {
+            Variable<uint8_t>(static_cast<uint8_t>(bits));
+        }
     }
 
+    /// Low bit masks, [0, 64]
+    static constexpr uint64_t kMaskTable[65] = {
+        0x0ull,
+        0x1ull, 0x3ull, 0x7ull, 0xFull, 0x1Full, 0x3Full, 0x7Full, 0xFFull,
+        0x1FFull, 0x3FFull, 0x7FFull, 0xFFFull, 0x1FFFull, 0x3FFFull, 0x7FFFull, 0xFFFFull,
+        0x1FFFFull, 0x3FFFFull, 0x7FFFFull, 0xFFFFFull, 0x1FFFFFull, 0x3FFFFFull, 0x7FFFFFull, 0xFFFFFFull,
+        0x1FFFFFFull, 0x3FFFFFFull, 0x7FFFFFFull, 0xFFFFFFFull, 0x1FFFFFFFull, 0x3FFFFFFFull, 0x7FFFFFFFull, 0xFFFFFFFFull,
+        0x1FFFFFFFFull, 0x3FFFFFFFFull, 0x7FFFFFFFFull, 0xFFFFFFFFFull, 0x1FFFFFFFFFull, 0x3FFFFFFFFFull, 0x7FFFFFFFFFull, 0xFFFFFFFFFFull,
+        0x1FFFFFFFFFFull, 0x3FFFFFFFFFFull, 0x7FFFFFFFFFFull, 0xFFFFFFFFFFFull, 0x1FFFFFFFFFFFull, 0x3FFFFFFFFFFFull, 0x7FFFFFFFFFFFull, 0xFFFFFFFFFFFFull,
+        0x1FFFFFFFFFFFFull, 0x3FFFFFFFFFFFFull, 0x7FFFFFFFFFFFFull, 0xFFFFFFFFFFFFFull, 0x1FFFFFFFFFFFFFull, 0x3FFFFFFFFFFFFFull, 0x7FFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFull,
+        0x1FFFFFFFFFFFFFFull, 0x3FFFFFFFFFFFFFFull, 0x7FFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFull, 0x1FFFFFFFFFFFFFFFull, 0x3FFFFFFFFFFFFFFFull, 0x7FFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull
+    };
+
+    /// Char6 decoding table
+    static constexpr char kChar6Table[64] = {
+        'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v', 'w', 'x', 'y', 'z',
+        'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P', 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z',
+        '0', '1', '2', '3', '4', '5', '6', '7', '8', '9',
+        '.', '_'
+    };
+
 private:
     /// Data pointers
-    const uint64_t *start;
-    const uint64_t *ptr;
-    const uint64_t *end;
+    const uint8_t *start;
+    const uint8_t *next;
+    const uint8_t *end;
+
+    /// Buffered bits, next bit in the lowest bit
+    uint64_t buffer{0};
 
-    /// Current bit offset
-    uint8_t bitOffset{0};
+    /// Number of buffered bits
+    uint32_t bufferBits{0};
 
     /// Encountered an error?
     bool errorState{false};
@@ -31,16 +31,16 @@
 
 // Std
 #include <cstdint>
+#include <cstring>
 #include <algorithm>
+#include <type_traits>
 
 // Common
 #include <Common/Assert.h>
 
-/// Bit stream reader
+/// Bit stream writer
+///   Bits are accumulated in a 64 bit word which is appended to the stream once filled.
 struct LLVMBitStreamWriter {
-    template<typename T>
-    using ChunkType = std::conditional_t<(sizeof(T) > 4), uint64_t, uint32_t>;
-
     /// Position within the stream
     struct Position {
         /// Determinet the dword delta
@@ -59,8 +59,8 @@ struct LLVMBitStreamWriter {
         uint8_t bitOffset;
     };
 
-    LLVMBitStreamWriter(DXStream& stream) : stream(stream) {
-        ptr = stream.NextWord64();
+    LLVMBitStreamWriter(DXStream& stream) : stream(stream), baseOffset(stream.GetByteSize()) {
+        /* */
     }
 
     /// Add the DXIL header
@@ -115,27 +115,15 @@ struct LLVMBitStreamWriter {
     /// \param bitWidth the bit width of each chunk
     template<typename T>
     Position VBR(T value, uint8_t bitWidth) {
-        using TChunk = ChunkType<T>;
-
-        Position anchor = Pos();
+        ASSERT(bitWidth > 1 && bitWidth <= 32, "Invalid VBR width");
 
-        uint8_t chunkBitOffset = 1 << (bitWidth - 1);
-
-        TChunk mask = chunkBitOffset - 1;
-
-        do {
-            TChunk masked = value & mask;
-
-            // Next chunk?
-            if (value > masked) {
-                masked |= chunkBitOffset;
-            }
-
-            Variable(masked, bitWidth);
-
-            value >>= bitWidth - 1;
-        } while (value);
+        // Single chunk values are by far the most common
+        if (static_cast<uint64_t>(value) < (1ull << (bitWidth - 1))) {
+            return Variable(static_cast<uint64_t>(value), bitWidth);
+        }
 
+        Position anchor = Pos();
+        VBRContinued(static_cast<uint64_t>(value), bitWidth);
         return anchor;
     }
 
@@ -155,18 +143,15 @@ struct LLVMBitStreamWriter {
         if (bitOffset < 32) {
             bitOffset = 32;
         } else {
-            ptr = stream.NextWord64();
-            bitOffset = 0;
+            FlushWord();
         }
     }
 
     /// Write a set of dwords
     ///  ! Must be aligned beforehand
-    /// \param data dword data
+    /// \param data dword data, may be unaligned
     /// \param wordCount number of words
     Position WriteDWord(const uint8_t* data, uint32_t wordCount) {
-        const auto* wordData = reinterpret_cast<const uint32_t*>(data);
-
         Position anchor = Pos();
 
         // Must be aligned
@@ -177,26 +162,30 @@ struct LLVMBitStreamWriter {
             return anchor;
         }
 
-        // On dword boundary?
+        // On dword boundary? Fill the upper half of the current word
         if (bitOffset != 0) {
-            // Write first word out
-            *ptr |= static_cast<uint64_t>(wordData[0]) << 32u;
-            ptr = stream.NextWord64();
+            uint32_t dword;
+            std::memcpy(&dword, data, sizeof(uint32_t));
+            word |= static_cast<uint64_t>(dword) << 32u;
+            FlushWord();
 
             // Next!
-            wordData++;
+            data += sizeof(uint32_t);
             wordCount--;
         }
 
-        // Is the result going to be aligned?
-        const bool isAligned = wordCount % 2 == 0;
-
-        // Write all missing words
-        stream.AppendData(wordData, wordCount * sizeof(uint32_t));
+        // Append all whole words
+        const uint32_t pairedCount = wordCount & ~1u;
+        stream.AppendData(data, pairedCount * sizeof(uint32_t));
+        wordOffset += pairedCount / 2;
 
-        // Set new state
-        ptr = stream.GetMutableData<uint64_t>();
-        bitOffset = isAligned ? 0 : 32;
+        // Trailing dword?
+        if (wordCount & 1u) {
+            uint32_t dword;
+            std::memcpy(&dword, data + pairedCount * sizeof(uint32_t), sizeof(uint32_t));
+            word = dword;
+            bitOffset = 32;
+        }
 
         return anchor;
     }
@@ -204,29 +193,105 @@ struct LLVMBitStreamWriter {
     /// Write a char6 value
     /// \param ch ansi char
     Position Char6(char ch) {
-        Position anchor = Pos();
+        return Variable<uint8_t>(EncodeChar6(ch), 6);
+    }
 
-        // Encode it
-        uint8_t encoded;
-        if (ch >= 'a' && ch <= 'z') {
-            encoded = (ch - 'a') + 0;
-        } else if (ch >= 'A' && ch <= 'Z') {
-            encoded = (ch - 'A') + 26;
-        } else if (ch >= '0' && ch <= '9') {
-            encoded = (ch - '0') + 52;
-        } else if (ch == '.') {
-            encoded = 62;
-        } else if (ch == '_') {
-            encoded = 63;
-        } else {
-            ASSERT(false, "Invalid char6 encoding");
-            encoded = 0;
+    /// Write an array of variable width values
+    /// \param values all values
+    /// \param count number of values
+    /// \param bitWidth the bit width of each chunk
+    void VBRArray(const uint64_t* values, uint64_t count, uint8_t bitWidth) {
+        ASSERT(bitWidth > 1 && bitWidth <= 32, "Invalid VBR width");
+
+        const uint64_t continuation = 1ull << (bitWidth - 1);
+
+        // Local copies, the values may otherwise alias the word
+        uint64_t localWord = word;
+        uint32_t localOffset = bitOffset;
+
+        for (uint64_t i = 0; i < count; i++) {
+            const uint64_t value = values[i];
+
+            // Pack single chunk values straight into the current word
+            if (value < continuation && localOffset + bitWidth < 64) {
+                localWord |= value << localOffset;
+                localOffset += bitWidth;
+                continue;
+            }
+
+            // Flush or multi chunk value
+            word = localWord;
+            bitOffset = static_cast<uint8_t>(localOffset);
+            VBR<uint64_t>(value, bitWidth);
+            localWord = word;
+            localOffset = bitOffset;
+        }
+
+        word = localWord;
+        bitOffset = static_cast<uint8_t>(localOffset);
+    }
+
+    /// Write an array of fixed width values
+    /// \param values all values
+    /// \param count number of values
+    /// \param fixedWidth bit width of each value
+    void FixedArray(const uint64_t* values, uint64_t count, uint8_t fixedWidth) {
+        ASSERT(fixedWidth <= 64, "Fixed width must be less or equal to 64 bits");
+
+        const uint64_t mask = Mask(fixedWidth);
+
+        // Local copies, the values may otherwise alias the word
+        uint64_t localWord = word;
+        uint32_t localOffset = bitOffset;
+
+        for (uint64_t i = 0; i < count; i++) {
+            // Pack straight into the current word
+            if (localOffset + fixedWidth < 64) {
+                localWord |= (values[i] & mask) << localOffset;
+                localOffset += fixedWidth;
+                continue;
+            }
+
+            // Flush
+            word = localWord;
+            bitOffset = static_cast<uint8_t>(localOffset);
+            Variable<uint64_t>(values[i], fixedWidth);
+            localWord = word;
+            localOffset = bitOffset;
         }
 
-        // Write out encoded char
-        Variable<uint8_t>(encoded, 6);
+        word = localWord;
+        bitOffset = static_cast<uint8_t>(localOffset);
+    }
 
-        return anchor;
+    /// Write an array of char6 values
+    /// \param values all ansi chars
+    /// \param count number of values
+    void Char6Array(const uint64_t* values, uint64_t count) {
+        // Local copies, the values may otherwise alias the word
+        uint64_t localWord = word;
+        uint32_t localOffset = bitOffset;
+
+        for (uint64_t i = 0; i < count; i++) {
+            const uint64_t encoded = EncodeChar6(static_cast<char>(values[i]));
+
+            // Pack straight into the current word
+            if (localOffset + 6 < 64) {
+                localWord |= encoded << localOffset;
+                localOffset += 6;
+                continue;
+            }
+
+            // Flush
+            word = localWord;
+            bitOffset = static_cast<uint8_t>(localOffset);
+            Variable<uint64_t>(encoded, 6);
+            localWord = word;
+            localOffset = bitOffset;
+        }
+
+        word = localWord;
+        bitOffset = static_cast<uint8_t>(localOffset);
     }
 
     /// Write a variable width data type
@@ -235,22 +300,23 @@ struct LLVMBitStreamWriter {
     /// \param count bit count
     template<typename T>
     Position Variable(const T& value, uint8_t count) {
-        uint8_t available = 64u - bitOffset;
-
         Position anchor = Pos();
 
-        if (count > available) {
-            *ptr |= static_cast<uint64_t>(value) << bitOffset;
-            ptr = stream.NextWord64();
-            *ptr |= static_cast<uint64_t>(value) >> available;
-            bitOffset = count - available;
-        } else if (count == available) {
-            *ptr |= static_cast<uint64_t>(value) << bitOffset;
-            ptr = stream.NextWord64();
-            bitOffset = 0;
+        const uint64_t bits = static_cast<uint64_t>(value) & Mask(count);
+
+        word |= bits << bitOffset;
+
+        // Filled the current word?
+        const uint32_t end = bitOffset + count;
+        if (end >= 64) {
+            const uint8_t available = 64u - bitOffset;
+            FlushWord();
+
+            // Carry the remaining bits
+            word = available < 64 ? bits >> available : 0;
+            bitOffset = static_cast<uint8_t>(end - 64);
         } else {
-            *ptr |= static_cast<uint64_t>(value) << bitOffset;
-            bitOffset += count;
+            bitOffset = static_cast<uint8_t>(end);
         }
 
         return anchor;
@@ -262,41 +328,134 @@ struct LLVMBitStreamWriter {
     /// \param count bit count
     template<typename T>
     void VariablePatch(const Position& position, const T& value, uint8_t count) {
-        uint8_t available = 64u - position.bitOffset;
+        const uint64_t bits = static_cast<uint64_t>(value) & Mask(count);
 
-        uint64_t* patchPtr = stream.GetMutableData<uint64_t>() + position.offset;
+        PatchWord(position.offset, bits << position.bitOffset);
 
+        // Straddles the next word?
+        const uint8_t available = 64u - position.bitOffset;
         if (count > available) {
-            *patchPtr |= static_cast<uint64_t>(value) << position.bitOffset;
-            patchPtr++;
-            *patchPtr |= static_cast<uint64_t>(value) >> available;
-        } else if (count == available) {
-            *patchPtr |= static_cast<uint64_t>(value) << position.bitOffset;
-        } else {
-            *patchPtr |= static_cast<uint64_t>(value) << position.bitOffset;
+            PatchWord(position.offset + 1, bits >> available);
         }
     }
 
     /// Close this writer
     void Close() {
-        const uint8_t wordCount = 2u - (bitOffset + 31) / 32;
-        stream.Resize(static_cast<uint32_t>(stream.GetByteSize() - sizeof(uint32_t) * wordCount));
+        // Append the used dwords of the pending word
+        const uint32_t dwordCount = (bitOffset + 31) / 32;
+        stream.AppendData(&word, dwordCount * sizeof(uint32_t));
+
+        // Reset
+        word = 0;
+        bitOffset = 0;
     }
 
     /// Get the position of this writer
     Position Pos() const {
         return Position{
-            .offset = static_cast<uint64_t>(ptr - stream.GetData<uint64_t>()),
+            .offset = wordOffset,
             .bitOffset = bitOffset
         };
     }
 
+private:
+    /// Append the current word to the stream
+    void FlushWord() {
+        stream.Append(word);
+        wordOffset++;
+
+        // Reset
+        word = 0;
+        bitOffset = 0;
+    }
+
+    /// Write out the remaining chunks of a multi chunk variable width value
+    /// \param value value to be written
+    /// \param bitWidth the bit width of each chunk
+    void VBRContinued(uint64_t value, uint8_t bitWidth) {
+        const uint64_t continuation = 1ull << (bitWidth - 1);
+
+        // Pack as many chunks as possible before writing
+        uint64_t packed = 0;
+        uint32_t packedBits = 0;
+
+        do {
+            uint64_t chunk = value & (continuation - 1);
+            value >>= bitWidth - 1;
+
+            // Next chunk?
+            if (value) {
+                chunk |= continuation;
+            }
+
+            // Out of space?
+            if (packedBits + bitWidth > 64) {
+                Variable(packed, static_cast<uint8_t>(packedBits));
+                packed = 0;
+                packedBits = 0;
+            }
+
+            packed |= chunk << packedBits;
+            packedBits += bitWidth;
+        } while (value);
+
+        Variable(packed, static_cast<uint8_t>(packedBits));
+    }
+
+    /// OR a set of bits into a written or pending word
+    /// \param offset word offset
+    /// \param bits bits to be written
+    void PatchWord(uint64_t offset, uint64_t bits) {
+        if (offset == wordOffset) {
+            word |= bits;
+            return;
+        }
+
+        uint8_t* address = stream.GetMutableDataAt(baseOffset + offset * sizeof(uint64_t));
+
+        uint64_t written;
+        std::memcpy(&written, address, sizeof(uint64_t));
+        written |= bits;
+        std::memcpy(address, &written, sizeof(uint64_t));
+    }
+
+    /// Get the low bit mask of a given width
+    static uint64_t Mask(uint32_t count) {
+        return count < 64 ? (1ull << count) - 1ull : ~0ull;
+    }
+
+    /// Encode a char6 value
+    /// \param ch ansi char
+    /// \return encoded value
+    static uint8_t EncodeChar6(char ch) {
+        if (ch >= 'a' && ch <= 'z') {
+            return static_cast<uint8_t>((ch - 'a') + 0);
+        } else if (ch >= 'A' && ch <= 'Z') {
+            return static_cast<uint8_t>((ch - 'A') + 26);
+        } else if (ch >= '0' && ch <= '9') {
+            return static_cast<uint8_t>((ch - '0') + 52);
+        } else if (ch == '.') {
+            return 62;
+        } else if (ch == '_') {
+            return 63;
+        }
+
+        ASSERT(false, "Invalid char6 encoding");
+        return 0;
+    }
+
 private:
     /// Underlying stream
     DXStream& stream;
 
-    /// Current word64
-    uint64_t* ptr{nullptr};
+    /// Byte offset of the first word
+    uint32_t baseOffset;
+
+    /// Word offset of the pending word
+    uint64_t wordOffset{0};
+
+    /// Pending word
+    uint64_t word{0};
 
     /// Current bit offset
     uint8_t bitOffset{0};
@@ -171,6 +171,7 @@ struct LLVMBlock {
     /// Add a record to the end of this block
     /// \param record record to be added
     void AddRecord(const LLVMRecord& record) {
+        dirty = true;
         elements.push_back(LLVMBlockElement(LLVMBlockElementType::Record, static_cast<uint32_t>(records.size())));
         records.push_back(record);
     }
@@ -178,6 +179,7 @@ struct LLVMBlock {
     /// Add a block to the end of this block
     /// \param record block to be added
     void AddBlock(LLVMBlock* block) {
+        dirty = true;
         elements.push_back(LLVMBlockElement(LLVMBlockElementType::Block, static_cast<uint32_t>(blocks.size())));
         blocks.push_back(block);
     }
@@ -185,6 +187,7 @@ struct LLVMBlock {
     /// Add a record at a location
     /// \param record record to be added
     void InsertRecord(const LLVMBlockElement* location, const LLVMRecord& record) {
+        dirty = true;
         elements.insert(AsIterator(location), LLVMBlockElement(LLVMBlockElementType::Record, static_cast<uint32_t>(records.size())));
         records.push_back(record);
     }
@@ -192,10 +195,25 @@ struct LLVMBlock {
     /// Add a block at a location
     /// \param record block to be added
     void InsertBlock(const LLVMBlockElement* location, LLVMBlock* block) {
+        dirty = true;
         elements.insert(AsIterator(location), LLVMBlockElement(LLVMBlockElementType::Block, static_cast<uint32_t>(blocks.size())));
         blocks.push_back(block);
     }
 
+    /// Mark this block and all child blocks as modified
+    void MarkDirtyRecursive() {
+        dirty = true;
+
+        for (LLVMBlock* block : blocks) {
+            block->MarkDirtyRecursive();
+        }
+    }
+
+    /// Can this block be copied verbatim from its source stream?
+    bool IsVerbatim() const {
+        return sourceData && !dirty;
+    }
+
     /// Identifier of this block, may be reserved
     uint32_t id{~0u};
     
@@ -208,6 +226,16 @@ struct LLVMBlock {
     /// First scan block length
     uint32_t blockLength{~0u};
 
+    /// Source dword data of the block contents, [blockLength] dwords, null if not scanned
+    const uint8_t* sourceData{nullptr};
+
+    /// Has this block been modified since scanning?
+    bool dirty{false};
+
+    /// Are the record operands shared with the source scan?
+    ///  ? Shared operands are immutable, records must be given their own operands before modification
+    bool sharedOperands{false};
+
     /// All child blocks
     Vector<LLVMBlock*> blocks;
 
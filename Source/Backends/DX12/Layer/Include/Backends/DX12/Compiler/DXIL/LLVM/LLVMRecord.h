@@ -35,6 +35,7 @@
 // Std
 #include <cstdint>
 #include <memory>
+#include <cstring>
 
 struct LLVMRecord {
     LLVMRecord() : opCount(0), userRecord(0), hasValue(0) {
@@ -32,6 +32,7 @@
 // Forward declarations
 class PDBController;
 class DXBCConverter;
+class ShaderSourceStore;
 
 /// Job description
 struct DXParseJob {
@@ -44,4 +45,7 @@ struct DXParseJob {
     /// Controllers
     ComRef<PDBController> pdbController;
     ComRef<DXBCConverter> dxbcConverter;
+
+    /// Shared stores
+    ComRef<ShaderSourceStore> sourceStore;
 };
@@ -0,0 +1,106 @@
+// 
+// The MIT License (MIT)
+// 
+// Copyright (c) 2024 Advanced Micro Devices, Inc.,
+// Fatalist Development AB (Avalanche Studio Group),
+// and Miguel Petersen.
+// 
+// All Rights Reserved.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy 
+// of this software and associated documentation files (the "Software"), to deal 
+// in the Software without restriction, including without limitation the rights 
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies 
+// of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, 
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma once
+
+// Layer
+#include <Backends/DX12/DX12.h>
+
+// Common
+#include <Common/Allocators.h>
+
+// Std
+#include <mutex>
+#include <list>
+#include <unordered_map>
+
+// Forward declarations
+class IDXModule;
+
+/// Parsed module of a given bytecode, shared between all shader states of the same bytecode
+struct ShaderModuleEntry {
+    /// Bytecode hash
+    uint64_t hash{0};
+
+    /// Owned bytecode copy
+    D3D12_SHADER_BYTECODE byteCode{};
+
+    /// Parsed module, read only once parsed
+    ///   ! Created on demand under the entry lock, see ShaderCompiler::InitializeModule
+    IDXModule* module{nullptr};
+
+    /// Set if parsing failed, avoids re-parsing known bad bytecode
+    bool failed{false};
+
+    /// Parsing lock
+    std::mutex mutex;
+
+private:
+    friend class ShaderModuleCache;
+
+    /// Number of shader states referencing this entry, guarded by the cache lock
+    uint32_t users{0};
+
+    /// Position in the retained list, valid if unreferenced
+    std::list<ShaderModuleEntry*>::iterator retainedIt;
+};
+
+class ShaderModuleCache {
+public:
+    ShaderModuleCache(const Allocators& allocators);
+
+    /// Deconstructor
+    ~ShaderModuleCache();
+
+    /// Get or create the entry of a bytecode, adds a user
+    /// \param hash bytecode hash
+    /// \param byteCode bytecode, copied if no entry matches
+    /// \return entry
+    ShaderModuleEntry* Acquire(uint64_t hash, const D3D12_SHADER_BYTECODE& byteCode);
+
+    /// Release a user of an entry
+    ///   Parsed entries without users are retained for future shader states of the same bytecode
+    /// \param entry entry to release
+    void Release(ShaderModuleEntry* entry);
+
+private:
+    /// Destroy an entry and its module
+    /// \param entry entry to destroy
+    void Destroy(ShaderModuleEntry* entry);
+
+private:
+    /// All entries, keyed by the bytecode hash
+    std::unordered_multimap<uint64_t, ShaderModuleEntry*> entries;
+
+    /// All unreferenced parsed entries, most recently released first
+    std::list<ShaderModuleEntry*> retained;
+
+    /// Shared lock
+    std::mutex mutex;
+
+    /// Shared allocators
+    Allocators allocators;
+};
@@ -73,6 +73,9 @@
 /// Enables the DXBC signer, as DXBC support is done through DXIL, this is not required
 #define USE_DXBC_SIGNER (0)
 
+/// Validates the in-process container hash against the validator
+#define DXIL_VALIDATE_CONTAINER_HASH (DX12_DIAGNOSTIC && 1)
+
 /// Enable instrumentation of a specific file for debugging purposes
 ///  ? Instrumentation of large applications can be difficult to debug and even harder to reproduce under the same conditions.
 ///    When such a fault occurs, it is very useful to simply be able to iterate on a binary file.
@@ -91,7 +94,14 @@
 /// Current heap method
 #define DESCRIPTOR_HEAP_METHOD DESCRIPTOR_HEAP_METHOD_POSTFIX
 
+/// Optimize the instrumented program prior to compilation
+///   Merges redundant literals, folds constants and removes dead instrumentation code.
+#define SHADER_COMPILER_OPTIMIZE_INSTRUMENTATION 1
+
 /** Constants **/
 
 /// Maximum number of dwords in a root signature
 static constexpr uint32_t MaxRootSignatureDWord = 64;
+
+/// Maximum number of parsed shader modules kept alive after their last shader state is released
+static constexpr uint32_t MaxRetainedShaderModules = 256;
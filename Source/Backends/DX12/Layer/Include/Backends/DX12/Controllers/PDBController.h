@@ -28,6 +28,7 @@
 
 // Layer
 #include <Backends/DX12/Controllers/IController.h>
+#include <Backends/DX12/Controllers/PDBPathIndex.h>
 
 // Bridge
 #include <Bridge/IBridgeListener.h>
@@ -35,23 +36,18 @@
 // Common
 #include <Common/ComRef.h>
 #include <Common/Allocator/Vector.h>
-#include <Common/Containers/TrivialStackVector.h>
 
 // Std
 #include <string_view>
 #include <vector>
 #include <mutex>
-#include <filesystem>
-#include <unordered_map>
+#include <memory>
 
 // Forward declarations
 class IBridge;
 struct DeviceState;
 struct ResourceState;
 
-/// Candidate list
-using PDBCandidateList = TrivialStackVector<std::string_view, 32u>;
-
 class PDBController final : public IController, public IBridgeListener {
 public:
     COMPONENT(PDBController);
@@ -67,10 +63,11 @@ public:
     /// Overrides
     void Handle(const MessageStream *streams, uint32_t count) final;
 
-    /// Get the candidates for a given path
+    /// Get the candidates for a given path, lock free
     /// \param view path
     /// \param candidates candidate list, may be empty
-    void GetCandidateList(const char* path, PDBCandidateList& candidates);
+    /// \param references keeps the candidates alive, must outlive all use of the candidates
+    void GetCandidateList(const char* path, PDBCandidateList& candidates, PDBCandidateReferences& references);
 
 protected:
     /// Message handlers
@@ -81,21 +78,6 @@ protected:
 private:
     /// Load all implicit configurations
     void LoadStartupConfiguration();
-    
-    /// Index a given path and its candidates
-    /// \param base pdb root
-    /// \param path candidate path
-    void IndexPathCandidates(const std::string_view& base, const std::filesystem::path& path);
-    
-    /// Index a given path
-    /// \param base pdb root
-    /// \param path candidate path
-    void IndexPath(const std::string_view& base, const std::filesystem::path& path);
-
-    /// Append a given set of candidates
-    /// \param view search path
-    /// \param candidates all candidates
-    void AppendCandidates(const std::string_view& view, PDBCandidateList& candidates);
 
 private:
     DeviceState* device;
@@ -109,9 +91,9 @@ private:
     /// Recursive indexing?
     bool recursive{false};
 
-    /// All indexed paths
-    std::unordered_map<uint64_t, std::vector<std::string>> indexed;
+    /// Persistent path index
+    std::unique_ptr<PDBPathIndex> pathIndex;
 
-    /// Shared lock
+    /// Shared lock, not held by lookups
     std::mutex mutex;
 };
@@ -0,0 +1,168 @@
+// 
+// The MIT License (MIT)
+// 
+// Copyright (c) 2024 Advanced Micro Devices, Inc.,
+// Fatalist Development AB (Avalanche Studio Group),
+// and Miguel Petersen.
+// 
+// All Rights Reserved.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy 
+// of this software and associated documentation files (the "Software"), to deal 
+// in the Software without restriction, including without limitation the rights 
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies 
+// of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, 
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma once
+
+// Common
+#include <Common/Containers/TrivialStackVector.h>
+
+// Std
+#include <string_view>
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <filesystem>
+#include <condition_variable>
+
+// Forward declarations
+class PDBPathIndexTable;
+
+/// Candidate list
+using PDBCandidateList = TrivialStackVector<std::string_view, 32u>;
+
+/// Tables referenced by a candidate list, keeps the candidate strings alive
+using PDBCandidateReferences = std::vector<std::shared_ptr<const PDBPathIndexTable>>;
+
+/// Persistent index of symbol paths
+///   Each root is indexed to an immutable table keyed by the hashes of the relative path, the file name,
+///   and the file stem. Tables are persisted to the cache directory and memory mapped on the next
+///   session, after which a background refresh only enumerates directories whose modification
+///   time differs from the persisted one. Roots indexed for the first time are walked synchronously.
+///   Lookups are lock free.
+class PDBPathIndex {
+public:
+    /// Constructor
+    /// \param cacheDirectory directory of all persisted tables
+    PDBPathIndex(const std::filesystem::path& cacheDirectory);
+
+    /// Deconstructor, cancels any pending refresh
+    ~PDBPathIndex();
+
+    /// No copy
+    PDBPathIndex(const PDBPathIndex&) = delete;
+    PDBPathIndex& operator=(const PDBPathIndex&) = delete;
+
+    /// Index a set of roots
+    ///   Persisted tables are immediately visible, refreshing happens in the background
+    ///   Roots without a persisted table are indexed before returning
+    /// \param roots all root directories
+    /// \param recursive index sub-directories
+    void Index(const std::vector<std::string>& roots, bool recursive);
+
+    /// Wait for all pending refreshes
+    void Wait();
+
+    /// Get the candidates for a given path, lock free
+    ///   ! Candidates remain valid for the lifetime of the references
+    /// \param path path to search for
+    /// \param candidates candidate list, appended to
+    /// \param references tables of the appended candidates, appended to
+    void GetCandidates(const std::string_view& path, PDBCandidateList& candidates, PDBCandidateReferences& references) const;
+
+    /// Refresh statistics
+    struct Statistics {
+        /// Number of directories enumerated
+        uint64_t enumeratedDirectoryCount{0};
+
+        /// Number of directories reused from persisted tables
+        uint64_t reusedDirectoryCount{0};
+
+        /// Number of tables loaded from the cache
+        uint64_t loadedTableCount{0};
+    };
+
+    /// Get the refresh statistics
+    Statistics GetStatistics();
+
+private:
+    struct View {
+        /// All live tables
+        std::vector<std::shared_ptr<const PDBPathIndexTable>> tables;
+    };
+
+    struct Request {
+        /// All root directories
+        std::vector<std::string> roots;
+
+        /// Tables built on request, persisted without a refresh
+        std::vector<std::shared_ptr<const PDBPathIndexTable>> built;
+
+        /// Index sub-directories
+        bool recursive{false};
+
+        /// Unique request id
+        uint64_t id{0};
+    };
+
+    /// Worker entry point
+    void Worker();
+
+    /// Publish a set of tables
+    void Publish(std::vector<std::shared_ptr<const PDBPathIndexTable>>&& tables);
+
+    /// Get the persisted path of a root
+    std::filesystem::path GetTablePath(uint32_t key, uint64_t generation) const;
+
+    /// Map the latest valid persisted table of a root
+    /// \return nullptr if none
+    std::shared_ptr<const PDBPathIndexTable> LoadTable(const std::string& root, bool recursive);
+
+    /// Persist a table as a new generation
+    void StoreTable(const PDBPathIndexTable& table, uint32_t key);
+
+private:
+    /// Cache directory
+    std::filesystem::path cacheDirectory;
+
+    /// Live view
+    std::atomic<const View*> view{nullptr};
+
+    /// Owner of the live view, retired views are released once no lookup may observe them
+    std::unique_ptr<View> liveView;
+
+    /// Pending request
+    Request pending;
+
+    /// Number of requests issued and completed
+    uint64_t requestCounter{0};
+    uint64_t completedCounter{0};
+
+    /// Statistics
+    Statistics statistics;
+
+    /// Worker state
+    bool exitFlag{false};
+    std::atomic<uint64_t> cancelRequest{0};
+    std::condition_variable wake;
+    std::condition_variable completed;
+    std::thread thread;
+
+    /// Shared lock, not held by lookups
+    std::mutex mutex;
+};
@@ -110,6 +110,9 @@ struct D3D12GPUOpenProcessState {
     bool applicationRequestedExperimentalShadingModels{false};
     bool isDXBCConversionEnabled{false};
 
+    /// Sign containers with the in-process hash, validator otherwise
+    bool isNativeContainerSigningEnabled{true};
+
     /// Device UID allocator
     std::atomic<uint32_t> deviceUID; 
 };
@@ -27,10 +27,7 @@
 #pragma once
 
 // Common
-#include <Common/Allocator/BTree.h>
-
-// Std
-#include <mutex>
+#include <Common/Containers/ConcurrentIntervalMap.h>
 
 // Forward declarations
 struct ResourceState;
@@ -47,55 +44,26 @@ public:
     /// \param base base address
     /// \param length address length
     void Add(ResourceState *state, uint64_t base, uint64_t length) {
-        std::lock_guard guard(lock);
-        entries[base] = AddressEntry{
-            .state = state,
-            .length = length
-        };
+        entries.Add(base, length, state);
     }
 
     /// Remove an address
     /// \param base base address
     void Remove(uint64_t base) {
-        std::lock_guard guard(lock);
-        entries.erase(base);
+        entries.Remove(base);
     }
 
-    /// Find the resource for a given address
+    /// Find the resource for a given address, lock free
     /// \param offset given virtual address
     /// \return nullptr if not found
     ResourceState *Find(uint64_t offset) {
-        std::lock_guard guard(lock);
-        if (entries.empty()) {
-            return nullptr;
-        }
-
-        // Sorted search
-        auto it = --entries.upper_bound(offset);
-
-        // Bad lower?
-        if (offset < it->first) {
-            return nullptr;
-        }
-
-        // Validate against upper
-        if (offset - it->first > it->second.length) {
-            return nullptr;
-        }
-
-        // OK
-        return it->second.state;
+        ResourceState* state{nullptr};
+        entries.Find(offset, state);
+        return state;
     }
 
 private:
-    struct AddressEntry {
-        ResourceState *state{nullptr};
-        uint64_t length{0};
-    };
-
-    /// Shared lock
-    std::mutex lock;
-
     /// All virtual addresses tracked
-    BTreeMap<uint64_t, AddressEntry> entries;
+    ///   Successive lookups tend to target the same buffer
+    ConcurrentIntervalMap<uint64_t, ResourceState*, true> entries;
 };
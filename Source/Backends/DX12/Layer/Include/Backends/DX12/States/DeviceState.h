@@ -31,6 +31,7 @@
 #include <Backends/DX12/TrackedObject.h>
 #include <Backends/DX12/DependentObject.h>
 #include <Backends/DX12/Compiler/ShaderSet.h>
+#include <Backends/DX12/Compiler/ShaderModuleCache.h>
 #include <Backends/DX12/Resource/HeapTable.h>
 #include <Backends/DX12/Resource/ResourceVirtualAddressTable.h>
 #include <Backends/DX12/Resource/PhysicalResourceIdentifierMap.h>
@@ -69,11 +70,13 @@ class ShaderExportStreamer;
 class ShaderSGUIDHost;
 class DeviceAllocator;
 class ShaderProgramHost;
+class ShaderSourceStore;
 class Scheduler;
 
 struct __declspec(uuid("548FDFD6-37E2-461C-A599-11DA5290F06E")) DeviceState {
     DeviceState(const Allocators& allocators)
         : allocators(allocators),
+          shaderModuleCache(allocators),
           states_Shaders(allocators.Tag(kAllocTracking)),
           states_Pipelines(allocators.Tag(kAllocTracking)),
           states_Queues(allocators.Tag(kAllocTracking)),
@@ -83,8 +86,7 @@ struct __declspec(uuid("548FDFD6-37E2-461C-A599-11DA5290F06E")) DeviceState {
           virtualAddressTable(allocators.Tag(kAllocTracking)),
           physicalResourceIdentifierMap(allocators.Tag(kAllocPRMT)),
           dependencies_shaderPipelines(allocators.Tag(kAllocTracking)),
-          features(allocators),
-          featureHookTables(allocators) { }
+          features(allocators) { }
     
     ~DeviceState();
 
@@ -103,6 +105,9 @@ struct __declspec(uuid("548FDFD6-37E2-461C-A599-11DA5290F06E")) DeviceState {
     /// All shared shader sets
     ShaderSet shaderSet;
 
+    /// Shared parsed modules, keyed by byte code
+    ShaderModuleCache shaderModuleCache;
+
     /// Message bridge
     ComRef<IBridge> bridge;
 
@@ -151,6 +156,9 @@ struct __declspec(uuid("548FDFD6-37E2-461C-A599-11DA5290F06E")) DeviceState {
     /// User programs
     ComRef<ShaderProgramHost> shaderProgramHost{nullptr};
 
+    /// Shared shader sources
+    ComRef<ShaderSourceStore> sourceStore{nullptr};
+
     /// Shared remapping table
     EventDataStack::RemappingTable eventRemappingTable;
     ShaderConstantsRemappingTable  constantRemappingTable;
@@ -169,5 +177,7 @@ struct __declspec(uuid("548FDFD6-37E2-461C-A599-11DA5290F06E")) DeviceState {
 
     /// All features
     Vector<ComRef<IFeature>> features;
-    Vector<FeatureHookTable> featureHookTables;
+
+    /// Flattened submission hooks of all features
+    FeatureSubmissionHookTable submissionHookTable;
 };
@@ -41,6 +41,7 @@
 
 // Forward declarations
 struct DeviceState;
+struct ShaderModuleEntry;
 class IDXModule;
 
 struct ShaderState : public ReferenceObject {
@@ -77,9 +78,12 @@ struct ShaderState : public ReferenceObject {
     /// Originating key
     ShaderStateKey key;
 
-    /// Byte code copy
+    /// Byte code copy, owned by the module entry
     D3D12_SHADER_BYTECODE byteCode;
 
+    /// Shared module entry of this byte code
+    ShaderModuleEntry* moduleEntry{nullptr};
+
     /// Backwards reference
     DeviceState* parent{nullptr};
 
@@ -90,7 +94,7 @@ struct ShaderState : public ReferenceObject {
     /// TODO: How do we manage lifetimes here?
     std::map<ShaderInstrumentationKey, DXStream> instrumentObjects;
 
-    /// Parsing module
+    /// Parsing module, shared read only with all states of the same byte code
     ///   ! May not be indexed yet, indexing occurs during instrumentation.
     ///     Avoided during regular use to not tamper with performance.
     IDXModule* module{nullptr};
@@ -58,8 +58,8 @@ void CreateDeviceCommandProxies(DeviceState *state) {
         // Get the hook table
         FeatureHookTable hookTable = feature->GetHookTable();
 
-        // Append
-        state->featureHookTables.push_back(hookTable);
+        // Append all valid submission hooks
+        state->submissionHookTable.Add(hookTable);
 
         /* Create all relevant proxies */
 
@@ -357,9 +357,7 @@ static void BeginCommandList(DeviceState* device, CommandListState* state, ID3D1
     state->streamState->commandContextHandle = state->userContext.handle;
 
     // Invoke proxies
-    for (const FeatureHookTable &table: device->featureHookTables) {
-        table.open.TryInvoke(&state->userContext);
-    }
+    FeatureSubmissionHookTable::Invoke(device->submissionHookTable.open, &state->userContext);
 }
 
 HRESULT CreateCommandListState(ID3D12Device *device, ID3D12CommandList* commandList, D3D12_COMMAND_LIST_TYPE type, ID3D12PipelineState *initialState, ID3D12PipelineState* hotSwap, bool opened, const IID &riid, void **pCommandList) {
@@ -860,9 +858,7 @@ HRESULT WINAPI HookID3D12CommandListClose(ID3D12CommandList *list) {
     device.state->exportStreamer->CloseCommandList(table.state->streamState);
 
     // Invoke proxies
-    for (const FeatureHookTable &proxyTable: device.state->featureHookTables) {
-        proxyTable.close.TryInvoke(table.state->userContext.handle);
-    }
+    FeatureSubmissionHookTable::Invoke(device.state->submissionHookTable.close, table.state->userContext.handle);
 
     // Pass down callchain
     return table.bottom->next_Close(table.next);
@@ -957,13 +953,13 @@ void HookID3D12CommandQueueExecuteCommandLists(ID3D12CommandQueue *queue, UINT c
     // Pass down callchain
     table.bottom->next_ExecuteCommandLists(table.next, static_cast<uint32_t>(unwrapped.Size()), unwrapped.Data());
 
-    // Process all again for proxies
-    for (uint32_t i = 0; i < count; i++) {
-        auto listTable = GetTable(lists[i]);
+    // Process all again for proxies, skipped entirely if no feature subscribes
+    if (!device.state->submissionHookTable.submit.empty()) {
+        for (uint32_t i = 0; i < count; i++) {
+            auto listTable = GetTable(lists[i]);
 
-        // Invoke all proxies
-        for (const FeatureHookTable &proxyTable: device.state->featureHookTables) {
-            proxyTable.submit.TryInvoke(listTable.state->userContext.handle);
+            // Invoke all proxies
+            FeatureSubmissionHookTable::Invoke(device.state->submissionHookTable.submit, listTable.state->userContext.handle);
         }
     }
 
@@ -69,7 +69,8 @@ bool DXBCPhysicalBlockDebug::Parse(const DXParseJob& job) {
 
         // Search for possible candidates
         PDBCandidateList candidates(allocators);
-        job.pdbController->GetCandidateList(path, candidates);
+        PDBCandidateReferences references;
+        job.pdbController->GetCandidateList(path, candidates, references);
 
         // Check all PDB candidates
         for (const std::string_view& candidate : candidates) {
@@ -83,7 +84,7 @@ bool DXBCPhysicalBlockDebug::Parse(const DXParseJob& job) {
     // Unfortunately basing the main program off the ILDB is more trouble than it's worth,
     // as stripping the debug data after recompilation is quite troublesome.
     if (ildbBlock) {
-        auto* dxilDebugModule = new(allocators, kAllocModuleDXILDebug) DXILDebugModule(allocators.Tag(kAllocModuleDXILDebug));
+        auto* dxilDebugModule = new(allocators, kAllocModuleDXILDebug) DXILDebugModule(allocators.Tag(kAllocModuleDXILDebug), job.sourceStore);
 
         // Attempt to parse the module
         if (!dxilDebugModule->Parse(ildbBlock->ptr, ildbBlock->length)) {
@@ -25,6 +25,8 @@
 // 
 
 #include <Backends/DX12/Compiler/DXBC/DXBCSigner.h>
+#include <Backends/DX12/Compiler/DXContainerHash.h>
+#include <Backends/DX12/Layer.h>
 
 // Common
 #include <Common/FileSystem.h>
@@ -41,6 +43,9 @@
 #endif // NDEBUG
 
 bool DXBCSigner::Install() {
+    // Prefer the in-process hash
+    useNativeSigning = D3D12GPUOpenProcessInfo.isNativeContainerSigningEnabled;
+
 #if USE_DXBC_SIGNER
     // Get path of the layer
     std::filesystem::path modulePath = GetBaseModuleDirectory();
@@ -49,7 +54,7 @@ bool DXBCSigner::Install() {
     //   ! No non-system/runtime dependents in dxbcsigner.dll, verified with dumpbin
     module = LoadLibrary((modulePath / "dxbcsigner.dll").string().c_str());
     if (!module) {
-        return false;
+        return useNativeSigning;
     }
 
     // Get gpa
@@ -69,7 +74,16 @@ DXBCSigner::~DXBCSigner() {
 }
 
 bool DXBCSigner::Sign(void *code, uint64_t length) {
+    // DXBC containers share the container hash
+    if (useNativeSigning) {
+        return SignDXContainer(code, length);
+    }
+
 #if USE_DXBC_SIGNER
+    if (!dxbcSign) {
+        return false;
+    }
+
     return SUCCEEDED(dxbcSign(static_cast<BYTE*>(code), static_cast<uint32_t>(length)));
 #else // USE_DXBC_SIGNER
     return false;
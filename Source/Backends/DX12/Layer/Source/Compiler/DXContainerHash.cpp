@@ -0,0 +1,220 @@
+// 
+// The MIT License (MIT)
+// 
+// Copyright (c) 2024 Advanced Micro Devices, Inc.,
+// Fatalist Development AB (Avalanche Studio Group),
+// and Miguel Petersen.
+// 
+// All Rights Reserved.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy 
+// of this software and associated documentation files (the "Software"), to deal 
+// in the Software without restriction, including without limitation the rights 
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies 
+// of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, 
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#include <Backends/DX12/Compiler/DXContainerHash.h>
+#include <Backends/DX12/Compiler/DXBC/DXBCHeader.h>
+
+// Std
+#include <cstring>
+#include <cstddef>
+
+/*
+ * The container hash is MD5 with a non-standard final block. The bit count is placed
+ * in the first dword of the final block, with the tail data following it, and the last
+ * dword of the final block is (byteCount * 2) | 1.
+ * */
+
+/// MD5 round helpers
+static inline uint32_t RotateLeft(uint32_t x, uint32_t n) {
+    return (x << n) | (x >> (32u - n));
+}
+
+#define MD5_STEP(F, A, B, C, D, X, S, K) \
+    A += F(B, C, D) + (X) + (K); \
+    A = RotateLeft(A, S) + (B)
+
+#define MD5_F(X, Y, Z) ((Z) ^ ((X) & ((Y) ^ (Z))))
+#define MD5_G(X, Y, Z) ((Y) ^ ((Z) & ((X) ^ (Y))))
+#define MD5_H(X, Y, Z) ((X) ^ (Y) ^ (Z))
+#define MD5_I(X, Y, Z) ((Y) ^ ((X) | ~(Z)))
+
+/// Transform a single 64 byte block
+/// \param state hash state
+/// \param block little endian block
+static void MD5Transform(uint32_t (&state)[4], const uint8_t* block) {
+    uint32_t x[16];
+    std::memcpy(x, block, sizeof(x));
+
+    uint32_t a = state[0];
+    uint32_t b = state[1];
+    uint32_t c = state[2];
+    uint32_t d = state[3];
+
+    // Round 1
+    MD5_STEP(MD5_F, a, b, c, d, x[0], 7, 0xd76aa478);
+    MD5_STEP(MD5_F, d, a, b, c, x[1], 12, 0xe8c7b756);
+    MD5_STEP(MD5_F, c, d, a, b, x[2], 17, 0x242070db);
+    MD5_STEP(MD5_F, b, c, d, a, x[3], 22, 0xc1bdceee);
+    MD5_STEP(MD5_F, a, b, c, d, x[4], 7, 0xf57c0faf);
+    MD5_STEP(MD5_F, d, a, b, c, x[5], 12, 0x4787c62a);
+    MD5_STEP(MD5_F, c, d, a, b, x[6], 17, 0xa8304613);
+    MD5_STEP(MD5_F, b, c, d, a, x[7], 22, 0xfd469501);
+    MD5_STEP(MD5_F, a, b, c, d, x[8], 7, 0x698098d8);
+    MD5_STEP(MD5_F, d, a, b, c, x[9], 12, 0x8b44f7af);
+    MD5_STEP(MD5_F, c, d, a, b, x[10], 17, 0xffff5bb1);
+    MD5_STEP(MD5_F, b, c, d, a, x[11], 22, 0x895cd7be);
+    MD5_STEP(MD5_F, a, b, c, d, x[12], 7, 0x6b901122);
+    MD5_STEP(MD5_F, d, a, b, c, x[13], 12, 0xfd987193);
+    MD5_STEP(MD5_F, c, d, a, b, x[14], 17, 0xa679438e);
+    MD5_STEP(MD5_F, b, c, d, a, x[15], 22, 0x49b40821);
+
+    // Round 2
+    MD5_STEP(MD5_G, a, b, c, d, x[1], 5, 0xf61e2562);
+    MD5_STEP(MD5_G, d, a, b, c, x[6], 9, 0xc040b340);
+    MD5_STEP(MD5_G, c, d, a, b, x[11], 14, 0x265e5a51);
+    MD5_STEP(MD5_G, b, c, d, a, x[0], 20, 0xe9b6c7aa);
+    MD5_STEP(MD5_G, a, b, c, d, x[5], 5, 0xd62f105d);
+    MD5_STEP(MD5_G, d, a, b, c, x[10], 9, 0x02441453);
+    MD5_STEP(MD5_G, c, d, a, b, x[15], 14, 0xd8a1e681);
+    MD5_STEP(MD5_G, b, c, d, a, x[4], 20, 0xe7d3fbc8);
+    MD5_STEP(MD5_G, a, b, c, d, x[9], 5, 0x21e1cde6);
+    MD5_STEP(MD5_G, d, a, b, c, x[14], 9, 0xc33707d6);
+    MD5_STEP(MD5_G, c, d, a, b, x[3], 14, 0xf4d50d87);
+    MD5_STEP(MD5_G, b, c, d, a, x[8], 20, 0x455a14ed);
+    MD5_STEP(MD5_G, a, b, c, d, x[13], 5, 0xa9e3e905);
+    MD5_STEP(MD5_G, d, a, b, c, x[2], 9, 0xfcefa3f8);
+    MD5_STEP(MD5_G, c, d, a, b, x[7], 14, 0x676f02d9);
+    MD5_STEP(MD5_G, b, c, d, a, x[12], 20, 0x8d2a4c8a);
+
+    // Round 3
+    MD5_STEP(MD5_H, a, b, c, d, x[5], 4, 0xfffa3942);
+    MD5_STEP(MD5_H, d, a, b, c, x[8], 11, 0x8771f681);
+    MD5_STEP(MD5_H, c, d, a, b, x[11], 16, 0x6d9d6122);
+    MD5_STEP(MD5_H, b, c, d, a, x[14], 23, 0xfde5380c);
+    MD5_STEP(MD5_H, a, b, c, d, x[1], 4, 0xa4beea44);
+    MD5_STEP(MD5_H, d, a, b, c, x[4], 11, 0x4bdecfa9);
+    MD5_STEP(MD5_H, c, d, a, b, x[7], 16, 0xf6bb4b60);
+    MD5_STEP(MD5_H, b, c, d, a, x[10], 23, 0xbebfbc70);
+    MD5_STEP(MD5_H, a, b, c, d, x[13], 4, 0x289b7ec6);
+    MD5_STEP(MD5_H, d, a, b, c, x[0], 11, 0xeaa127fa);
+    MD5_STEP(MD5_H, c, d, a, b, x[3], 16, 0xd4ef3085);
+    MD5_STEP(MD5_H, b, c, d, a, x[6], 23, 0x04881d05);
+    MD5_STEP(MD5_H, a, b, c, d, x[9], 4, 0xd9d4d039);
+    MD5_STEP(MD5_H, d, a, b, c, x[12], 11, 0xe6db99e5);
+    MD5_STEP(MD5_H, c, d, a, b, x[15], 16, 0x1fa27cf8);
+    MD5_STEP(MD5_H, b, c, d, a, x[2], 23, 0xc4ac5665);
+
+    // Round 4
+    MD5_STEP(MD5_I, a, b, c, d, x[0], 6, 0xf4292244);
+    MD5_STEP(MD5_I, d, a, b, c, x[7], 10, 0x432aff97);
+    MD5_STEP(MD5_I, c, d, a, b, x[14], 15, 0xab9423a7);
+    MD5_STEP(MD5_I, b, c, d, a, x[5], 21, 0xfc93a039);
+    MD5_STEP(MD5_I, a, b, c, d, x[12], 6, 0x655b59c3);
+    MD5_STEP(MD5_I, d, a, b, c, x[3], 10, 0x8f0ccc92);
+    MD5_STEP(MD5_I, c, d, a, b, x[10], 15, 0xffeff47d);
+    MD5_STEP(MD5_I, b, c, d, a, x[1], 21, 0x85845dd1);
+    MD5_STEP(MD5_I, a, b, c, d, x[8], 6, 0x6fa87e4f);
+    MD5_STEP(MD5_I, d, a, b, c, x[15], 10, 0xfe2ce6e0);
+    MD5_STEP(MD5_I, c, d, a, b, x[6], 15, 0xa3014314);
+    MD5_STEP(MD5_I, b, c, d, a, x[13], 21, 0x4e0811a1);
+    MD5_STEP(MD5_I, a, b, c, d, x[4], 6, 0xf7537e82);
+    MD5_STEP(MD5_I, d, a, b, c, x[11], 10, 0xbd3af235);
+    MD5_STEP(MD5_I, c, d, a, b, x[2], 15, 0x2ad7d2bb);
+    MD5_STEP(MD5_I, b, c, d, a, x[9], 21, 0xeb86d391);
+
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+}
+
+void ComputeDXContainerHash(const void* data, uint32_t byteCount, uint8_t (&digest)[kDXContainerDigestSize]) {
+    auto* bytes = static_cast<const uint8_t*>(data);
+
+    // Standard MD5 initial state
+    uint32_t state[4] = {
+        0x67452301,
+        0xefcdab89,
+        0x98badcfe,
+        0x10325476
+    };
+
+    // All full blocks are hashed in place
+    const uint32_t blockCount = byteCount / 64u;
+    for (uint32_t i = 0; i < blockCount; i++) {
+        MD5Transform(state, bytes + i * 64u);
+    }
+
+    // Remaining data
+    //   ! Empty ranges may be null, never offset or copy from those
+    const uint32_t remainder = byteCount % 64u;
+    const uint8_t* tail = remainder ? bytes + blockCount * 64u : nullptr;
+
+    // Final block dwords
+    const uint32_t bitCount = byteCount << 3u;
+    const uint32_t trailer = (byteCount << 1u) | 1u;
+
+    uint8_t block[64];
+    if (remainder < 56u) {
+        // Single final block, [bitCount, tail, 0x80, zero padding, trailer]
+        std::memset(block, 0x0, sizeof(block));
+        std::memcpy(block, &bitCount, sizeof(uint32_t));
+        if (remainder) {
+            std::memcpy(block + sizeof(uint32_t), tail, remainder);
+        }
+        block[sizeof(uint32_t) + remainder] = 0x80;
+        std::memcpy(block + 60, &trailer, sizeof(uint32_t));
+        MD5Transform(state, block);
+    } else {
+        // Tail does not fit, [tail, 0x80, zero padding]
+        std::memset(block, 0x0, sizeof(block));
+        std::memcpy(block, tail, remainder);
+        block[remainder] = 0x80;
+        MD5Transform(state, block);
+
+        // [bitCount, zero padding, trailer]
+        std::memset(block, 0x0, sizeof(block));
+        std::memcpy(block, &bitCount, sizeof(uint32_t));
+        std::memcpy(block + 60, &trailer, sizeof(uint32_t));
+        MD5Transform(state, block);
+    }
+
+    // Digest is the little endian state
+    std::memcpy(digest, state, sizeof(digest));
+}
+
+bool SignDXContainer(void* code, uint64_t length) {
+    // Must hold the header
+    if (length < sizeof(DXBCHeader)) {
+        return false;
+    }
+
+    auto* header = static_cast<DXBCHeader*>(code);
+
+    // Must be a valid container
+    if (header->identifier != 'CBXD' || header->byteCount != length) {
+        return false;
+    }
+
+    // Hash everything past the digest
+    constexpr size_t kHashOffset = offsetof(DXBCHeader, reserved);
+
+    // Hash and write back
+    ComputeDXContainerHash(static_cast<const uint8_t*>(code) + kHashOffset, static_cast<uint32_t>(length - kHashOffset), header->privateChecksum);
+
+    // OK
+    return true;
+}
@@ -4058,9 +4058,7 @@ void DXILPhysicalBlockFunction::StitchFunction(struct LLVMBlock *block) {
                 ASSERT(false, "Unexpected record in stitch operation");
                 
                 // Force remap all operands as references
-                for (uint32_t i = 0; i < record.opCount; i++) {
-                    table.idRemapper.RemapRelative(anchor, record, record.ops[i]);
-                }
+                table.idRemapper.RemapRelativeArray(anchor, record, record.ops, record.opCount);
 
                 // OK
                 break;
@@ -4174,11 +4172,9 @@ void DXILPhysicalBlockFunction::StitchFunction(struct LLVMBlock *block) {
             case LLVMFunctionRecord::InstCall:
             case LLVMFunctionRecord::InstCall2: {
                 writer.Skip(3);
-                writer.RemapRelative(anchor);
 
-                for (uint32_t i = 4; i < record.opCount; i++) {
-                    writer.RemapRelative(anchor);
-                }
+                // Callee and all arguments
+                writer.RemapRelativeRange(anchor, record.opCount - 3);
                 break;
             }
         }
@@ -245,9 +245,7 @@ void DXILPhysicalBlockGlobal::StitchConstants(struct LLVMBlock *block) {
             }
 
             case LLVMConstantRecord::Aggregate: {
-                for (uint32_t i = 0; i < record.opCount; i++) {
-                    table.idRemapper.Remap(record.Op(i));
-                }
+                table.idRemapper.RemapArray(record.ops, record.opCount);
                 break;
             }
 
@@ -132,6 +132,9 @@ void DXILPhysicalBlockSymbol::CompileSymTab(struct LLVMBlock *block) {
 }
 
 void DXILPhysicalBlockSymbol::StitchSymTab(struct LLVMBlock *block) {
+    // Entries are remapped in place, possibly deferred to forward resolution
+    block->dirty = true;
+
     for (size_t i = 0; i < block->elements.size(); i++) {
         const LLVMBlockElement& element = block->elements[i];
         
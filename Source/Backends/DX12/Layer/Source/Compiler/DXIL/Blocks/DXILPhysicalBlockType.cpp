@@ -248,6 +248,16 @@ void DXILPhysicalBlockType::StitchType(LLVMBlock *block) {
     LLVMRecord& record = block->records[0];
     ASSERT(record.Is(LLVMTypeRecord::NumEntry), "Invalid type block");
 
-    // Set new number of entries
-    record.ops[0] = typeMap.GetEntryCount();
+    // Set new number of entries, only a modification if types were allocated
+    if (record.ops[0] != typeMap.GetEntryCount()) {
+        // Operands may be shared with the source module
+        if (block->sharedOperands) {
+            auto* ops = table.recordAllocator.AllocateArray<uint64_t>(record.opCount);
+            std::memcpy(ops, record.ops, sizeof(uint64_t) * record.opCount);
+            record.ops = ops;
+        }
+
+        record.ops[0] = typeMap.GetEntryCount();
+        block->dirty = true;
+    }
 }
@@ -28,18 +28,31 @@
 #include <Backends/DX12/Compiler/DXIL/LLVM/LLVMHeader.h>
 #include <Backends/DX12/Compiler/DXIL/LLVM/LLVMRecordStringView.h>
 
+// Backend
+#include <Backend/ShaderSourceStore.h>
+
 // Common
 #include <Common/FileSystem.h>
 
-DXILDebugModule::DXILDebugModule(const Allocators &allocators)
+DXILDebugModule::DXILDebugModule(const Allocators &allocators, const ComRef<ShaderSourceStore>& sourceStore)
     : scan(allocators),
       sourceFragments(allocators),
+      sourceStore(sourceStore),
       instructionMetadata(allocators),
       metadata(allocators),
       thinTypes(allocators),
       thinValues(allocators),
       allocators(allocators) { }
 
+DXILDebugModule::~DXILDebugModule() {
+    // Release all shared contents
+    for (const SourceFragment& fragment : sourceFragments) {
+        if (fragment.blob) {
+            sourceStore->Release(fragment.blob);
+        }
+    }
+}
+
 static std::string SanitizeCompilerPath(const std::string_view& view) {
     std::string path = SanitizePath(view);
 
@@ -53,7 +66,7 @@ static std::string SanitizeCompilerPath(const std::string_view& view) {
 }
 
 DXSourceAssociation DXILDebugModule::GetSourceAssociation(uint32_t codeOffset) {
-    if (codeOffset >= instructionMetadata.size()) {
+    if (!Materialize() || codeOffset >= instructionMetadata.size()) {
         return {};
     }
 
@@ -62,34 +75,75 @@ DXSourceAssociation DXILDebugModule::GetSourceAssociation(uint32_t codeOffset) {
 
 std::string_view DXILDebugModule::GetLine(uint32_t fileUID, uint32_t line) {
     // Safeguard file
-    if (fileUID >= sourceFragments.size()) {
+    if (!Materialize() || fileUID >= sourceFragments.size()) {
         return {};
     }
 
-    SourceFragment& fragment = sourceFragments.at(fileUID);
+    const ShaderSourceBlob* blob = sourceFragments.at(fileUID).blob;
 
     // Safeguard line
-    if (line >= fragment.lineOffsets.size()) {
+    if (!blob || line >= blob->lineOffsets.size()) {
         return {};
     }
 
     // Base offset
-    uint32_t base = fragment.lineOffsets.at(line);
+    uint32_t base = blob->lineOffsets[line];
 
     // Get view
-    if (line == fragment.lineOffsets.size() - 1) {
-        return std::string_view(fragment.contents.data() + base, fragment.contents.length() - base);
+    if (line == blob->lineOffsets.size() - 1) {
+        return std::string_view(blob->contents.data() + base, blob->contents.length() - base);
     } else {
-        return std::string_view(fragment.contents.data() + base, fragment.lineOffsets.at(line + 1) - base);
+        return std::string_view(blob->contents.data() + base, blob->lineOffsets[line + 1] - base);
     }
 }
 
 bool DXILDebugModule::Parse(const void *byteCode, uint64_t byteLength) {
+    // Must be DXIL
+    if (byteLength < sizeof(DXILHeader) || static_cast<const DXILHeader*>(byteCode)->identifier != 'LIXD') {
+        return false;
+    }
+
+    // Debug data is only needed on source queries, which most modules never see, defer it
+    deferredByteCode = byteCode;
+    deferredByteLength = byteLength;
+
+    // OK
+    return true;
+}
+
+bool DXILDebugModule::Materialize() const {
+    if (materialized.load(std::memory_order_acquire)) {
+        return materializeResult;
+    }
+
+    // Serialize materialization
+    std::lock_guard guard(materializeMutex);
+
+    // Materialized during wait?
+    if (!materialized.load(std::memory_order_relaxed)) {
+        materializeResult = const_cast<DXILDebugModule*>(this)->ParseDeferred();
+        materialized.store(true, std::memory_order_release);
+    }
+
+    // OK
+    return materializeResult;
+}
+
+bool DXILDebugModule::ParseDeferred() {
     // Postfix
     scan.SetDebugPostfix(".debug");
 
+    // Only scan the blocks contributing to source associations, all others just record their ranges
+    scan.SetBlockFilter(
+        (1ull << static_cast<uint32_t>(LLVMReservedBlock::Module)) |
+        (1ull << static_cast<uint32_t>(LLVMReservedBlock::Type)) |
+        (1ull << static_cast<uint32_t>(LLVMReservedBlock::Constants)) |
+        (1ull << static_cast<uint32_t>(LLVMReservedBlock::Function)) |
+        (1ull << static_cast<uint32_t>(LLVMReservedBlock::Metadata))
+    );
+
     // Scan data
-    if (!scan.Scan(byteCode, byteLength)) {
+    if (!scan.Scan(deferredByteCode, deferredByteLength)) {
         return false;
     }
 
@@ -151,10 +205,34 @@ bool DXILDebugModule::Parse(const void *byteCode, uint64_t byteLength) {
         RemapLineScopes();
     }
 
+    // Share all contents
+    FinalizeSources();
+
     // OK
     return true;
 }
 
+void DXILDebugModule::FinalizeSources() {
+    // Sources are only shared through the store
+    if (!sourceStore) {
+        ASSERT(false, "Debug module without a source store");
+        return;
+    }
+
+    for (SourceFragment& fragment : sourceFragments) {
+        // Never filled?
+        if (!fragment.lineCount) {
+            continue;
+        }
+
+        // Permutations share their include files, the contents and line offsets are only stored once
+        fragment.blob = sourceStore->Acquire(std::move(fragment.pendingContents));
+
+        // Contents are not moved if already stored
+        std::string().swap(fragment.pendingContents);
+    }
+}
+
 void DXILDebugModule::RemapLineScopes() {
     for (InstructionMetadata& md : instructionMetadata) {
         // Unmapped or invalid?
@@ -474,7 +552,7 @@ void DXILDebugModule::ParseContents(LLVMBlock* block, uint32_t fileMdId) {
     uint32_t targetUID = fragment->uid;
 
     // Already filled by another preprocessed segment?
-    if (!fragment->lineOffsets.empty()) {
+    if (fragment->lineCount) {
         return;
     }
     
@@ -493,7 +571,7 @@ void DXILDebugModule::ParseContents(LLVMBlock* block, uint32_t fileMdId) {
     /** TODO: This is such a mess! I'll clean this up when it's matured a bit. */
 
     // Append initial line
-    fragment->lineOffsets.push_back(0);
+    fragment->lineCount = 1;
 
     // Summarize the line offsets
     for (uint32_t i = 0; i < contents.Length(); i++) {
@@ -563,29 +641,25 @@ void DXILDebugModule::ParseContents(LLVMBlock* block, uint32_t fileMdId) {
         size_t fragmentLength = lastSourceEnd - lastSourceOffset;
 
         // Copy contents
-        size_t contentOffset = fragment->contents.length();
-        fragment->contents.resize(contentOffset + fragmentLength);
-        contents.SubStr(lastSourceOffset, lastSourceEnd, fragment->contents.data() + contentOffset);
-
-        // Summarize line endings
-        for (size_t j = contentOffset; j < fragment->contents.size(); j++) {
-            if (fragment->contents[j] == '\n') {
-                fragment->lineOffsets.push_back(static_cast<uint32_t>(j + 1));
-            }
-        }
+        size_t contentOffset = fragment->pendingContents.length();
+        fragment->pendingContents.resize(contentOffset + fragmentLength);
+        contents.SubStr(lastSourceOffset, lastSourceEnd, fragment->pendingContents.data() + contentOffset);
+
+        // Count line endings, offsets are summarized once the contents are shared
+        fragment->lineCount += ShaderSourceStore::CountLines(std::string_view(fragment->pendingContents).substr(contentOffset));
 
         // Extend fragments
         fragment = FindOrCreateSourceFragment(file);
 
         // Append initial line
-        if (fragment->lineOffsets.empty()) {
-            fragment->lineOffsets.push_back(0);
+        if (!fragment->lineCount) {
+            fragment->lineCount = 1;
         }
 
         // Append expected newlines to new fragment
-        for (size_t j = fragment->lineOffsets.size(); j < offset; j++) {
-            fragment->contents.push_back('\n'); 
-            fragment->lineOffsets.push_back(static_cast<uint32_t>(fragment->contents.size()));
+        if (fragment->lineCount < offset) {
+            fragment->pendingContents.append(offset - fragment->lineCount, '\n');
+            fragment->lineCount = offset;
         }
 
         // New offset
@@ -605,21 +679,17 @@ void DXILDebugModule::ParseContents(LLVMBlock* block, uint32_t fileMdId) {
         size_t fragmentLength = contents.Length() - lastSourceOffset;
 
         // Copy contents
-        size_t contentOffset = fragment->contents.length();
-        fragment->contents.resize(contentOffset + fragmentLength);
-        contents.SubStr(lastSourceOffset, contents.Length(), fragment->contents.data() + contentOffset);
-
-        // Summarize line endings
-        for (size_t j = contentOffset; j < fragment->contents.size(); j++) {
-            if (fragment->contents[j] == '\n') {
-                fragment->lineOffsets.push_back(static_cast<uint32_t>(j + 1));
-            }
-        }
+        size_t contentOffset = fragment->pendingContents.length();
+        fragment->pendingContents.resize(contentOffset + fragmentLength);
+        contents.SubStr(lastSourceOffset, contents.Length(), fragment->pendingContents.data() + contentOffset);
+
+        // Count line endings
+        fragment->lineCount += ShaderSourceStore::CountLines(std::string_view(fragment->pendingContents).substr(contentOffset));
     }
 }
 
 std::string_view DXILDebugModule::GetFilename() {
-    if (sourceFragments.empty()) {
+    if (!Materialize() || sourceFragments.empty()) {
         return {};
     }
 
@@ -627,20 +697,33 @@ std::string_view DXILDebugModule::GetFilename() {
 }
 
 std::string_view DXILDebugModule::GetSourceFilename(uint32_t fileUID) {
+    Materialize();
     return sourceFragments.at(fileUID).filename;
 }
 
 uint32_t DXILDebugModule::GetFileCount() {
+    if (!Materialize()) {
+        return 0;
+    }
+
     return static_cast<uint32_t>(sourceFragments.size());
 }
 
 uint64_t DXILDebugModule::GetCombinedSourceLength(uint32_t fileUID) const {
-    return sourceFragments.at(fileUID).contents.length();
+    Materialize();
+
+    // Never filled?
+    const ShaderSourceBlob* blob = sourceFragments.at(fileUID).blob;
+    return blob ? blob->contents.length() : 0;
 }
 
 void DXILDebugModule::FillCombinedSource(uint32_t fileUID, char *buffer) const {
-    const SourceFragment& fragment = sourceFragments.at(fileUID);
-    std::memcpy(buffer, fragment.contents.data(), fragment.contents.length());
+    Materialize();
+
+    // Never filled?
+    if (const ShaderSourceBlob* blob = sourceFragments.at(fileUID).blob) {
+        std::memcpy(buffer, blob->contents.data(), blob->contents.length());
+    }
 }
 
 uint32_t DXILDebugModule::GetLinearFileUID(uint32_t scopeMdId) {
@@ -156,6 +156,9 @@ DXILPhysicalBlockScan::ScanResult DXILPhysicalBlockScan::ScanEnterSubBlock(LLVMB
     // Read number of dwords
     block->blockLength = stream.Fixed<uint32_t>();
 
+    // Keep the source contents for verbatim copies, always dword aligned
+    block->sourceData = stream.GetSafeData();
+
     // Id zero indicates BLOCKINFO
     if (block->id == 0) {
         return ScanBlockInfo(stream, block, block->abbreviationSize);
@@ -164,7 +167,7 @@ DXILPhysicalBlockScan::ScanResult DXILPhysicalBlockScan::ScanEnterSubBlock(LLVMB
     // Part of filter?
     if (shlBlockFilter != UINT64_MAX && !(shlBlockFilter & (1ull << block->id))) {
         // Just skip the contents
-        stream.Skip(block->blockLength - sizeof(uint32_t));
+        stream.Skip(block->blockLength * sizeof(uint32_t));
         return ScanResult::OK;
     }
 
@@ -301,9 +304,7 @@ DXILPhysicalBlockScan::ScanResult DXILPhysicalBlockScan::ScanUnabbreviatedRecord
     record.ops = recordAllocator.AllocateArray<uint64_t>(record.opCount);
 
     // Scan all ops
-    for (uint32_t i = 0; i < record.opCount; i++) {
-        record.ops[i] = stream.VBR<uint64_t>(6);
-    }
+    stream.VBRArray(record.ops, record.opCount, 6);
 
     // OK
     return ScanResult::OK;
@@ -380,9 +381,7 @@ DXILPhysicalBlockScan::ScanResult DXILPhysicalBlockScan::ScanUnabbreviatedInfoRe
     record.ops = recordAllocator.AllocateArray<uint64_t>(record.opCount);
 
     // Scan all ops
-    for (uint32_t i = 0; i < record.opCount; i++) {
-        record.ops[i] = stream.VBR<uint64_t>(6);
-    }
+    stream.VBRArray(record.ops, record.opCount, 6);
 
     // Handle type
     switch (record.id) {
@@ -538,21 +537,15 @@ DXILPhysicalBlockScan::ScanResult DXILPhysicalBlockScan::ScanRecord(LLVMBitStrea
                         break;
                     }
                     case LLVMAbbreviationEncoding::Fixed: {
-                        for (uint32_t elementIndex = 0; elementIndex < count; elementIndex++) {
-                            recordOperandCache[dataOffset + elementIndex] = stream.Fixed<uint64_t>(static_cast<uint32_t>(contained.value));
-                        }
+                        stream.FixedArray(recordOperandCache.data() + dataOffset, count, static_cast<uint8_t>(contained.value));
                         break;
                     }
                     case LLVMAbbreviationEncoding::VBR: {
-                        for (uint32_t elementIndex = 0; elementIndex < count; elementIndex++) {
-                            recordOperandCache[dataOffset + elementIndex] = stream.VBR<uint64_t>(static_cast<uint32_t>(contained.value));
-                        }
+                        stream.VBRArray(recordOperandCache.data() + dataOffset, count, static_cast<uint8_t>(contained.value));
                         break;
                     }
                     case LLVMAbbreviationEncoding::Char6: {
-                        for (uint32_t elementIndex = 0; elementIndex < count; elementIndex++) {
-                            recordOperandCache[dataOffset + elementIndex] = stream.Char6();
-                        }
+                        stream.Char6Array(recordOperandCache.data() + dataOffset, count);
                         break;
                     }
                 }
@@ -760,8 +753,21 @@ void DXILPhysicalBlockScan::CopyTo(DXILPhysicalBlockScan &out) {
     out.header = header;
     out.metadataLookup = metadataLookup;
 
-    // Copy root block
-    CopyBlock(&root, out.recordAllocator, out.root);
+    // Copy root block, module records are remapped in place
+    CopyBlock(&root, out.recordAllocator, false, out.root);
+}
+
+bool DXILPhysicalBlockScan::IsImmutableRecordBlock(uint32_t id) {
+    switch (static_cast<LLVMReservedBlock>(id)) {
+        default:
+            return false;
+        case LLVMReservedBlock::Info:
+        case LLVMReservedBlock::Parameter:
+        case LLVMReservedBlock::ParameterGroup:
+        case LLVMReservedBlock::Type:
+        case LLVMReservedBlock::StrTab:
+            return true;
+    }
 }
 
 void DXILPhysicalBlockScan::DestroyBlockContents(const LLVMBlock *block) {
@@ -774,35 +780,40 @@ void DXILPhysicalBlockScan::DestroyBlockContents(const LLVMBlock *block) {
     }
 }
 
-void DXILPhysicalBlockScan::CopyBlock(const LLVMBlock *block, LinearBlockAllocator<sizeof(uint64_t) * 1024u>& outRecordAllocator, LLVMBlock &out) {
+void DXILPhysicalBlockScan::CopyBlock(const LLVMBlock *block, LinearBlockAllocator<sizeof(uint64_t) * 1024u>& outRecordAllocator, bool shareOperands, LLVMBlock &out) {
     // Immutable data
     out.id = block->id;
     out.uid = block->uid;
     out.abbreviationSize = block->abbreviationSize;
     out.blockLength = block->blockLength;
+    out.sourceData = block->sourceData;
+    out.dirty = block->dirty;
     out.metadata = block->metadata;
     out.abbreviations = block->abbreviations;
     out.elements = block->elements;
 
     // Copy records
     out.records = block->records;
+    out.sharedOperands = shareOperands;
 
-    // Reallocate operands
-    for (LLVMRecord& record : out.records) {
-        if (!record.opCount) {
-            continue;
-        }
+    // Reallocate operands of mutable blocks, immutable blocks share the source operands
+    if (!shareOperands) {
+        for (LLVMRecord& record : out.records) {
+            if (!record.opCount) {
+                continue;
+            }
 
-        // Copy operands
-        auto* ops = outRecordAllocator.AllocateArray<uint64_t>(record.opCount);
-        std::memcpy(ops, record.ops, sizeof(uint64_t) * record.opCount);
-        record.ops = ops;
+            // Copy operands
+            auto* ops = outRecordAllocator.AllocateArray<uint64_t>(record.opCount);
+            std::memcpy(ops, record.ops, sizeof(uint64_t) * record.opCount);
+            record.ops = ops;
+        }
     }
     
     // Mutable blocks
     for (const LLVMBlock *child: block->blocks) {
         auto copy = new(allocators, kAllocModuleDXILLLVMBlock) LLVMBlock(allocators);
-        CopyBlock(child, outRecordAllocator, *copy);
+        CopyBlock(child, outRecordAllocator, shareOperands || IsImmutableRecordBlock(child->id), *copy);
         out.blocks.push_back(copy);
     }
 }
@@ -822,6 +833,14 @@ DXILPhysicalBlockScan::WriteResult DXILPhysicalBlockScan::WriteSubBlock(LLVMBitS
     // Align32
     stream.AlignDWord();
 
+    // Unmodified blocks are copied verbatim, the contents are dword aligned on both ends
+    //  ? BLOCKINFO is always re-emitted from its metadata
+    if (block->id != 0 && block->IsVerbatim()) {
+        stream.Fixed<uint32_t>(block->blockLength);
+        stream.WriteDWord(block->sourceData, block->blockLength);
+        return WriteResult::OK;
+    }
+
     // Write number of dwords
     LLVMBitStreamWriter::Position lengthPos = stream.Fixed<uint32_t>(0);
 
@@ -1034,9 +1053,7 @@ DXILPhysicalBlockScan::WriteResult DXILPhysicalBlockScan::WriteUnabbreviatedReco
     stream.VBR<uint32_t>(record.opCount, 6);
 
     // Write all operands
-    for (uint32_t i = 0; i < record.opCount; i++) {
-        stream.VBR<uint64_t>(record.ops[i], 6);
-    }
+    stream.VBRArray(record.ops, record.opCount, 6);
 
     // OK
     return WriteResult::OK;
@@ -1109,11 +1126,33 @@ DXILPhysicalBlockScan::WriteResult DXILPhysicalBlockScan::WriteRecord(LLVMBitStr
                 stream.VBR<uint64_t>(count, 6);
 
                 // Write all elements
-                for (uint32_t elementIndex = 0; elementIndex < count; elementIndex++) {
-                    if (WriteResult result = WriteTrivialAbbreviationParameter(stream, contained, record.Op(operandOffset++)); result != WriteResult::OK) {
-                        return result;
+                //  ? Flatten the switch to improve inlining efforts
+                switch (contained.encoding) {
+                    default:
+                        ASSERT(false, "Unexpected encoding");
+                        return WriteResult::Error;
+
+                    /* Handle cases */
+                    case LLVMAbbreviationEncoding::Literal: {
+                        // No writeback, already part of the abbreviation
+                        break;
+                    }
+                    case LLVMAbbreviationEncoding::Fixed: {
+                        stream.FixedArray(record.ops + operandOffset, count, static_cast<uint8_t>(contained.value));
+                        break;
+                    }
+                    case LLVMAbbreviationEncoding::VBR: {
+                        stream.VBRArray(record.ops + operandOffset, count, static_cast<uint8_t>(contained.value));
+                        break;
+                    }
+                    case LLVMAbbreviationEncoding::Char6: {
+                        stream.Char6Array(record.ops + operandOffset, count);
+                        break;
                     }
                 }
+
+                // Consumed all elements
+                operandOffset += count;
                 break;
             }
 
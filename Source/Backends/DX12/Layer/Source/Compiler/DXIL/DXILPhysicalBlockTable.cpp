@@ -300,6 +300,9 @@ void DXILPhysicalBlockTable::Stitch(DXStream &out) {
     // Set the remap bound
     idRemapper.SetBound(idMap.GetBound(), program.GetIdentifierMap().GetMaxID());
 
+    // Module records are remapped in place
+    root.dirty = true;
+
     // Visit in declaration order
     for (const LLVMBlockElement& element : root.elements) {
         if (element.Is(LLVMBlockElementType::Record)) {
@@ -347,15 +350,18 @@ void DXILPhysicalBlockTable::Stitch(DXStream &out) {
                 case LLVMReservedBlock::ParameterGroup:
                     break;
                 case LLVMReservedBlock::Constants:
+                    block->MarkDirtyRecursive();
                     global.StitchConstants(block);
                     break;
                 case LLVMReservedBlock::Function:
+                    block->MarkDirtyRecursive();
                     function.StitchFunction(block);
                     break;
                 case LLVMReservedBlock::ValueSymTab:
                     symbol.StitchSymTab(block);
                     break;
                 case LLVMReservedBlock::Metadata:
+                    block->MarkDirtyRecursive();
                     metadata.StitchMetadata(block);
                     break;
                 case LLVMReservedBlock::MetadataAttachment:
@@ -25,6 +25,8 @@
 // 
 
 #include <Backends/DX12/Compiler/DXIL/DXILSigner.h>
+#include <Backends/DX12/Compiler/DXContainerHash.h>
+#include <Backends/DX12/Compiler/DXBC/DXBCHeader.h>
 #include <Backends/DX12/Layer.h>
 
 // System
@@ -35,6 +37,7 @@
 
 // Std
 #include <string>
+#include <cstring>
 
 // Special includes
 #ifndef NDEBUG
@@ -46,6 +49,22 @@
  * */
 
 bool DXILSigner::Install() {
+    // Signing may not be required
+    needsSigning = !D3D12GPUOpenProcessInfo.isExperimentalShaderModelsEnabled;
+
+    // Prefer the in-process hash
+    useNativeSigning = D3D12GPUOpenProcessInfo.isNativeContainerSigningEnabled;
+
+    // The validator is optional with native signing
+    if (!InstallValidator()) {
+        return useNativeSigning;
+    }
+
+    // OK
+    return true;
+}
+
+bool DXILSigner::InstallValidator() {
     // Get path of the layer
     std::filesystem::path modulePath = GetBaseModuleDirectory();
 
@@ -82,9 +101,6 @@ bool DXILSigner::Install() {
         return false;
     }
 
-    // Signing may not be required
-    needsSigning = !D3D12GPUOpenProcessInfo.isExperimentalShaderModelsEnabled;
-
     // OK
     return true;
 }
@@ -103,8 +119,6 @@ DXILSigner::~DXILSigner() {
 }
 
 bool DXILSigner::Sign(void *code, uint64_t length) {
-    Microsoft::WRL::ComPtr<IDxcOperationResult> result;
-
     // Early out if not needed
     //  ! Keep it in for debug validation
 #if defined(NDEBUG)
@@ -113,6 +127,47 @@ bool DXILSigner::Sign(void *code, uint64_t length) {
     }
 #endif // defined(NDEBUG)
 
+    // Fall back to the validator if requested
+    if (!useNativeSigning) {
+        return SignWithValidator(code, length);
+    }
+
+    // Hash in-process, avoids the validation round-trip entirely
+    if (!SignDXContainer(code, length)) {
+        return false;
+    }
+
+#if DXIL_VALIDATE_CONTAINER_HASH
+    // Validator may not be present
+    if (!validator) {
+        return true;
+    }
+
+    // Keep the native digest
+    uint8_t digest[kDXContainerDigestSize];
+    std::memcpy(digest, static_cast<DXBCHeader*>(code)->privateChecksum, sizeof(digest));
+
+    // Sign and validate through the validator
+    if (!SignWithValidator(code, length)) {
+        return false;
+    }
+
+    // Both must agree
+    ASSERT(std::memcmp(digest, static_cast<DXBCHeader*>(code)->privateChecksum, sizeof(digest)) == 0, "Container hash mismatch against validator");
+#endif // DXIL_VALIDATE_CONTAINER_HASH
+
+    // OK
+    return true;
+}
+
+bool DXILSigner::SignWithValidator(void *code, uint64_t length) {
+    Microsoft::WRL::ComPtr<IDxcOperationResult> result;
+
+    // Validator may have failed to install
+    if (!validator) {
+        return false;
+    }
+
     // Create a pinned blob (no-copy)
     Microsoft::WRL::ComPtr<IDxcBlobEncoding> pinnedBlob;
     library->CreateBlobWithEncodingFromPinned(static_cast<BYTE*>(code), static_cast<uint32_t>(length), 0u, pinnedBlob.GetAddressOf());
@@ -38,12 +38,14 @@
 #include <Backends/DX12/Compiler/Tags.h>
 #include <Backends/DX12/ShaderData/ShaderDataHost.h>
 #include <Backends/DX12/Compiler/Diagnostic/DiagnosticType.h>
+#include <Backends/DX12/Config.h>
 
 // Backend
 #include <Backend/IFeatureHost.h>
 #include <Backend/IFeature.h>
 #include <Backend/IShaderFeature.h>
 #include <Backend/IShaderExportHost.h>
+#include <Backend/IL/InstrumentationOptimizer.h>
 #include <Backend/Diagnostic/DiagnosticBucketScope.h>
 
 // Common
@@ -113,22 +115,31 @@ void ShaderCompiler::Worker(void *data) {
 }
 
 bool ShaderCompiler::InitializeModule(ShaderState *state) {
+    ShaderModuleEntry* entry = state->moduleEntry;
+
     // Instrumented pipelines are unique, however, originating modules may not be
-    std::lock_guard moduleGuad(state->mutex);
+    std::lock_guard moduleGuad(entry->mutex);
 
-    // Create the module on demand
-    if (!state->module) {
+    // Known bad byte code?
+    if (entry->failed) {
+        return false;
+    }
+
+    // Create the module on demand, may already be parsed by a previous state
+    if (!entry->module) {
         // Get type
         uint32_t type = *static_cast<const uint32_t *>(state->byteCode.pShaderBytecode);
 
         // Create the module
+        IDXModule* module;
         switch (type) {
             default: {
                 // Unknown type, just skip the job
+                entry->failed = true;
                 return false;
             }
             case 'CBXD': {
-                state->module = new (allocators, kAllocModuleDXBC) DXBCModule(allocators.Tag(kAllocModuleDXBC), state->uid, GlobalUID::New());
+                module = new (allocators, kAllocModuleDXBC) DXBCModule(allocators.Tag(kAllocModuleDXBC), state->uid, GlobalUID::New());
                 break;
             }
         }
@@ -139,13 +150,22 @@ bool ShaderCompiler::InitializeModule(ShaderState *state) {
         job.byteLength = state->byteCode.BytecodeLength;
         job.pdbController = device->pdbController;
         job.dxbcConverter = dxbcConverter;
+        job.sourceStore = device->sourceStore;
 
         // Try to parse the bytecode
-        if (!state->module->Parse(job)) {
+        if (!module->Parse(job)) {
+            destroy(module, allocators);
+            entry->failed = true;
             return false;
         }
+
+        // Publish to all states of this byte code
+        entry->module = module;
     }
 
+    // Assign shared module
+    state->module = entry->module;
+
     // OK
     return true;
 }
@@ -169,6 +189,9 @@ void ShaderCompiler::CompileShader(const ShaderJob &job) {
     // Create a copy of the module, don't modify the source
     IDXModule *module = job.state->module->Copy();
 
+    // Shared modules may originate from a previous state of the same byte code
+    module->GetProgram()->SetShaderGUID(job.state->uid);
+
     // Debugging
     std::filesystem::path debugPath;
     if (debug) {
@@ -197,6 +220,13 @@ void ShaderCompiler::CompileShader(const ShaderJob &job) {
         shaderFeatures[i]->Inject(*module->GetProgram(), *job.dependentSpecialization);
     }
 
+#if SHADER_COMPILER_OPTIMIZE_INSTRUMENTATION
+    // Clean up the injected instrumentation
+    if (job.instrumentationKey.featureBitSet) {
+        IL::InstrumentationOptimizer(*module->GetProgram()).Optimize();
+    }
+#endif // SHADER_COMPILER_OPTIMIZE_INSTRUMENTATION
+
     // Instrumentation job
     DXCompileJob compileJob;
     compileJob.instrumentationKey = job.instrumentationKey;
@@ -0,0 +1,134 @@
+// 
+// The MIT License (MIT)
+// 
+// Copyright (c) 2024 Advanced Micro Devices, Inc.,
+// Fatalist Development AB (Avalanche Studio Group),
+// and Miguel Petersen.
+// 
+// All Rights Reserved.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy 
+// of this software and associated documentation files (the "Software"), to deal 
+// in the Software without restriction, including without limitation the rights 
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies 
+// of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, 
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#include <Backends/DX12/Compiler/ShaderModuleCache.h>
+#include <Backends/DX12/Compiler/IDXModule.h>
+#include <Backends/DX12/Config.h>
+
+// Std
+#include <cstring>
+
+ShaderModuleCache::ShaderModuleCache(const Allocators &allocators) : allocators(allocators) {
+
+}
+
+ShaderModuleCache::~ShaderModuleCache() {
+    for (auto&& [hash, entry] : entries) {
+        Destroy(entry);
+    }
+}
+
+ShaderModuleEntry* ShaderModuleCache::Acquire(uint64_t hash, const D3D12_SHADER_BYTECODE& byteCode) {
+    std::lock_guard guard(mutex);
+
+    // Hashes may collide, compare the contents
+    for (auto [it, end] = entries.equal_range(hash); it != end; ++it) {
+        ShaderModuleEntry* entry = it->second;
+
+        // Matching bytecode?
+        if (entry->byteCode.BytecodeLength != byteCode.BytecodeLength ||
+            std::memcmp(entry->byteCode.pShaderBytecode, byteCode.pShaderBytecode, byteCode.BytecodeLength)) {
+            continue;
+        }
+
+        // Revive retained entries
+        if (!entry->users++) {
+            retained.erase(entry->retainedIt);
+        }
+
+        // OK
+        return entry;
+    }
+
+    // Create new entry
+    auto entry = new (allocators, kAllocStateShader) ShaderModuleEntry();
+    entry->hash = hash;
+    entry->users = 1;
+
+    // Copy byte code
+    auto data = new (allocators, kAllocStateShader) uint8_t[byteCode.BytecodeLength];
+    std::memcpy(data, byteCode.pShaderBytecode, byteCode.BytecodeLength);
+    entry->byteCode.BytecodeLength = byteCode.BytecodeLength;
+    entry->byteCode.pShaderBytecode = data;
+
+    // Add to lookup
+    entries.emplace(hash, entry);
+
+    // OK
+    return entry;
+}
+
+void ShaderModuleCache::Release(ShaderModuleEntry* entry) {
+    std::lock_guard guard(mutex);
+
+    // Still in use?
+    ASSERT(entry->users, "Releasing unreferenced entry");
+    if (--entry->users) {
+        return;
+    }
+
+    // Entries without a parsed module have nothing worth keeping
+    bool parsed;
+    {
+        std::lock_guard entryGuard(entry->mutex);
+        parsed = entry->module != nullptr;
+    }
+
+    // Retain parsed entries, evicting the least recently released ones
+    if (parsed) {
+        entry->retainedIt = retained.insert(retained.begin(), entry);
+
+        // Within budget?
+        if (retained.size() <= MaxRetainedShaderModules) {
+            return;
+        }
+
+        // Evict oldest
+        entry = retained.back();
+        retained.pop_back();
+    }
+
+    // Remove from lookup
+    for (auto [it, end] = entries.equal_range(entry->hash); it != end; ++it) {
+        if (it->second == entry) {
+            entries.erase(it);
+            break;
+        }
+    }
+
+    // Release memory
+    Destroy(entry);
+}
+
+void ShaderModuleCache::Destroy(ShaderModuleEntry* entry) {
+    if (entry->module) {
+        destroy(entry->module, allocators);
+    }
+
+    // Release byte code
+    destroy(static_cast<uint8_t*>(const_cast<void*>(entry->byteCode.pShaderBytecode)), allocators);
+    destroy(entry, allocators);
+}
@@ -38,17 +38,16 @@
 #include <Schemas/PDB.h>
 
 // Common
-#include <Common/CRC.h>
 #include <Common/FileSystem.h>
 
-// Std
-#include <filesystem>
-
 PDBController::PDBController(DeviceState *device) : device(device), pdbPaths(device->allocators) {
 
 }
 
 bool PDBController::Install() {
+    // Create index, persisted across sessions
+    pathIndex = std::make_unique<PDBPathIndex>(GetIntermediatePath("PDB"));
+
     // Install bridge
     bridge = registry->Get<IBridge>().GetUnsafe();
     if (!bridge) {
@@ -99,45 +98,7 @@ void PDBController::OnMessage(const struct SetPDBConfigMessage &message) {
     recursive = message.recursive;
 }
 
-void PDBController::IndexPathCandidates(const std::string_view& base, const std::filesystem::path &path) {
-    // May create a copy
-    std::string filename = path.string();
-    
-    // Local view
-    std::string_view view = filename;
-
-    // Remove up to the base directory
-    view = view.substr(base.length());
-    IndexPath(view, path);
-
-    // Strip directory information
-    if (auto delim = view.find_last_of("\\/"); delim != std::string::npos) {
-        view = view.substr(delim + 1u);
-        IndexPath(view, path);
-    }
-
-    // Strip extension information
-    if (auto ext = view.find_last_of("."); ext != std::string::npos) {
-        view = view.substr(0, ext);
-        IndexPath(view, path);
-    }
-}
-
-void PDBController::IndexPath(const std::string_view& view, const std::filesystem::path &path) {
-    // Insert to crc64 of the filename
-    uint64_t crc64 = BufferCRC32Short(view.data(), view.size() * sizeof(char));
-    indexed[crc64].push_back(path.string());
-}
-
-void PDBController::AppendCandidates(const std::string_view &path, PDBCandidateList &candidates) {
-    // Check crc64 of the filename
-    uint64_t crc64 = BufferCRC32Short(path.data(), path.size() * sizeof(char));
-    for (const std::string& candidate : indexed[crc64]) {
-        candidates.Add(candidate);
-    }
-}
-
-void PDBController::GetCandidateList(const char* path, PDBCandidateList& candidates) {
+void PDBController::GetCandidateList(const char* path, PDBCandidateList& candidates, PDBCandidateReferences& references) {
     /** TODO: Is there some universally accepted way to index debug files? */
     
     // The path may exist relative to the executable, or be an absolute path (f.x. local iteration)
@@ -145,26 +106,8 @@ void PDBController::GetCandidateList(const char* path, PDBCandidateList& candida
         candidates.Add(path);
     }
 
-    // Serial
-    std::lock_guard guard(mutex);
-
-    // Local view
-    std::string_view view = path;
-
-    // Relative to pdb root candidates
-    AppendCandidates(view, candidates);
-    
-    // Strip directory information
-    if (auto delim = view.find_last_of("\\/"); delim != std::string::npos) {
-        view = view.substr(delim + 1u);
-        AppendCandidates(view, candidates);
-    }
-
-    // Strip extension information
-    if (auto ext = view.find_last_of("."); ext != std::string::npos) {
-        view = view.substr(0, ext);
-        AppendCandidates(view, candidates);
-    }
+    // Relative to pdb root candidates, file name and stem
+    pathIndex->GetCandidates(path, candidates, references);
 }
 
 void PDBController::OnMessage(const struct SetPDBPathMessage &message) {
@@ -172,27 +115,6 @@ void PDBController::OnMessage(const struct SetPDBPathMessage &message) {
 }
 
 void PDBController::OnMessage(const struct IndexPDPathsMessage &message) {
-    indexed.clear();
-
-    // Visit all paths
-    for (const std::string &path: pdbPaths) {
-        // Recursive?
-        if (recursive) {
-            for (auto &&entry: std::filesystem::recursive_directory_iterator(path)) {
-                if (entry.is_directory()) {
-                    continue;
-                }
-
-                IndexPathCandidates(path, entry.path());
-            }
-        } else {
-            for (auto &&entry: std::filesystem::directory_iterator(path)) {
-                if (entry.is_directory()) {
-                    continue;
-                }
-
-                IndexPathCandidates(path, entry.path());
-            }
-        }
-    }
+    // Persisted roots are visible immediately, changes are picked up in the background
+    pathIndex->Index(std::vector<std::string>(pdbPaths.begin(), pdbPaths.end()), recursive);
 }
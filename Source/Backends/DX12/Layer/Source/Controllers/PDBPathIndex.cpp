@@ -0,0 +1,782 @@
+// 
+// The MIT License (MIT)
+// 
+// Copyright (c) 2024 Advanced Micro Devices, Inc.,
+// Fatalist Development AB (Avalanche Studio Group),
+// and Miguel Petersen.
+// 
+// All Rights Reserved.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy 
+// of this software and associated documentation files (the "Software"), to deal 
+// in the Software without restriction, including without limitation the rights 
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies 
+// of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, 
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+#include <Backends/DX12/Controllers/PDBPathIndex.h>
+
+// Common
+#include <Common/MappedFile.h>
+#include <Common/CRC.h>
+#include <Common/Containers/ReaderEpoch.h>
+
+// Std
+#include <algorithm>
+#include <unordered_map>
+#include <fstream>
+#include <chrono>
+#include <cstring>
+#include <cstdio>
+#include <utility>
+
+/// Table identifier, "PDBI"
+static constexpr uint32_t kTableMagic = 0x49424450;
+
+/// Table layout version, bump on any change
+static constexpr uint32_t kTableVersion = 1;
+
+/// Persisted table extension
+static constexpr const char* kTableExtension = ".pdbi";
+
+/// Directories modified within this window of a walk may change without a visible time change
+static constexpr std::chrono::seconds kRacyWindow{2};
+
+/// Modification time of directories that must always be enumerated
+static constexpr int64_t kUntrustedTime = INT64_MIN;
+
+/// Invalid index
+static constexpr uint32_t kInvalidIndex = ~0u;
+
+struct TableHeader {
+    /// Identifiers
+    uint32_t magic;
+    uint32_t version;
+
+    /// Root key
+    uint32_t key;
+
+    /// Sub-directories indexed?
+    uint32_t recursive;
+
+    /// Number of records
+    uint64_t directoryCount;
+    uint64_t fileCount;
+    uint64_t keyCount;
+
+    /// Number of bytes in the string table
+    uint64_t stringByteCount;
+};
+
+struct TableDirectory {
+    /// Modification time at the time of enumeration, or kUntrustedTime
+    int64_t modificationTime;
+
+    /// Path in string table
+    uint64_t pathOffset;
+    uint32_t pathLength;
+
+    /// Parent directory, kInvalidIndex for the root
+    uint32_t parent;
+
+    /// Contiguous range of files
+    uint32_t firstFile;
+    uint32_t fileCount;
+};
+
+struct TableFile {
+    /// Path in string table
+    uint64_t pathOffset;
+    uint32_t pathLength;
+
+    /// Owning directory
+    uint32_t directory;
+};
+
+struct TableKey {
+    /// Path variant hash
+    uint32_t hash;
+
+    /// Referenced file
+    uint32_t file;
+};
+
+/// Visit all searchable variants of a path
+///   The path itself, without directory information, and without extension information
+template<typename F>
+static void VisitPathVariants(std::string_view view, F&& functor) {
+    functor(view);
+
+    // Strip directory information
+    if (auto delim = view.find_last_of("\\/"); delim != std::string::npos) {
+        view = view.substr(delim + 1u);
+        functor(view);
+    }
+
+    // Strip extension information
+    if (auto ext = view.find_last_of("."); ext != std::string::npos) {
+        view = view.substr(0, ext);
+        functor(view);
+    }
+}
+
+/// Hash a path variant
+static uint32_t HashPathVariant(const std::string_view& view) {
+    return BufferCRC32Short(view.data(), view.size() * sizeof(char));
+}
+
+/// Get the key of a root
+static uint32_t GetRootKey(const std::string& root, bool recursive) {
+    return BufferCRC32Short(root.data(), root.size() * sizeof(char), recursive ? 0x1u : ~0u);
+}
+
+class PDBPathIndexTable {
+public:
+    /// Map a persisted table
+    /// \param path path of the table
+    /// \return false if failed
+    bool Map(const std::filesystem::path& path) {
+        if (!file.Open(path)) {
+            return false;
+        }
+
+        data = file.GetData();
+        size = file.GetSize();
+        return true;
+    }
+
+    /// Assign in-memory contents
+    /// \param contents serialized contents
+    void Assign(std::vector<uint8_t>&& contents) {
+        blob = std::move(contents);
+        data = blob.data();
+        size = blob.size();
+    }
+
+    /// Validate the contents against a root
+    /// \param root expected root
+    /// \param recursive expected recursion
+    /// \return false if invalid, table must not be used
+    bool Validate(const std::string& root, bool recursive) const {
+        if (size < sizeof(TableHeader)) {
+            return false;
+        }
+
+        // Validate identifiers
+        const TableHeader& header = GetHeader();
+        if (header.magic != kTableMagic || header.version != kTableVersion || header.key != GetRootKey(root, recursive) || header.recursive != recursive) {
+            return false;
+        }
+
+        // Validate sizes, guard against overflows on malformed counts
+        if (header.directoryCount > size || header.fileCount > size || header.keyCount > size || header.stringByteCount > size) {
+            return false;
+        }
+
+        uint64_t expectedSize =
+            sizeof(TableHeader) +
+            sizeof(TableDirectory) * header.directoryCount +
+            sizeof(TableFile) * header.fileCount +
+            sizeof(TableKey) * header.keyCount +
+            header.stringByteCount;
+
+        if (size != expectedSize || !header.directoryCount) {
+            return false;
+        }
+
+        // Validate directories
+        for (uint64_t i = 0; i < header.directoryCount; i++) {
+            const TableDirectory& directory = GetDirectories()[i];
+            if (directory.pathOffset + directory.pathLength > header.stringByteCount ||
+                static_cast<uint64_t>(directory.firstFile) + directory.fileCount > header.fileCount ||
+                (i && directory.parent >= i)) {
+                return false;
+            }
+        }
+
+        // Validate files
+        for (uint64_t i = 0; i < header.fileCount; i++) {
+            const TableFile& tableFile = GetFiles()[i];
+            if (tableFile.pathOffset + tableFile.pathLength > header.stringByteCount || tableFile.directory >= header.directoryCount) {
+                return false;
+            }
+        }
+
+        // Validate keys
+        for (uint64_t i = 0; i < header.keyCount; i++) {
+            if (GetKeys()[i].file >= header.fileCount || (i && GetKeys()[i - 1].hash > GetKeys()[i].hash)) {
+                return false;
+            }
+        }
+
+        // Root must match
+        return GetDirectoryPath(0) == root;
+    }
+
+    /// Append all candidates of a hash
+    void GetCandidates(uint32_t hash, PDBCandidateList& candidates) const {
+        const TableKey* begin = GetKeys();
+        const TableKey* end = begin + GetHeader().keyCount;
+
+        // Sorted search
+        const TableKey* it = std::lower_bound(begin, end, hash, [](const TableKey& key, uint32_t value) {
+            return key.hash < value;
+        });
+
+        for (; it != end && it->hash == hash; it++) {
+            candidates.Add(GetFilePath(it->file));
+        }
+    }
+
+    /// Get the header
+    const TableHeader& GetHeader() const {
+        return *reinterpret_cast<const TableHeader*>(data);
+    }
+
+    /// Get all directories
+    const TableDirectory* GetDirectories() const {
+        return reinterpret_cast<const TableDirectory*>(data + sizeof(TableHeader));
+    }
+
+    /// Get all files
+    const TableFile* GetFiles() const {
+        return reinterpret_cast<const TableFile*>(GetDirectories() + GetHeader().directoryCount);
+    }
+
+    /// Get all keys
+    const TableKey* GetKeys() const {
+        return reinterpret_cast<const TableKey*>(GetFiles() + GetHeader().fileCount);
+    }
+
+    /// Get the string table
+    const char* GetStrings() const {
+        return reinterpret_cast<const char*>(GetKeys() + GetHeader().keyCount);
+    }
+
+    /// Get the path of a directory
+    std::string_view GetDirectoryPath(uint32_t index) const {
+        const TableDirectory& directory = GetDirectories()[index];
+        return std::string_view(GetStrings() + directory.pathOffset, directory.pathLength);
+    }
+
+    /// Get the path of a file
+    std::string_view GetFilePath(uint32_t index) const {
+        const TableFile& tableFile = GetFiles()[index];
+        return std::string_view(GetStrings() + tableFile.pathOffset, tableFile.pathLength);
+    }
+
+    /// Get the serialized contents
+    const uint8_t* GetData() const {
+        return data;
+    }
+
+    /// Get the byte size of the serialized contents
+    uint64_t GetSize() const {
+        return size;
+    }
+
+private:
+    /// Persisted contents
+    MappedFile file;
+
+    /// In-memory contents
+    std::vector<uint8_t> blob;
+
+    /// Serialized contents
+    const uint8_t* data{nullptr};
+    uint64_t size{0};
+};
+
+class PDBPathIndexTableBuilder {
+public:
+    PDBPathIndexTableBuilder(const std::string& root, bool recursive) : root(root), recursive(recursive) {
+
+    }
+
+    /// Begin a new directory, all successive files are owned by it
+    /// \param path directory path
+    /// \param modificationTime time of enumeration
+    /// \param parent parent directory
+    /// \return directory index
+    uint32_t BeginDirectory(const std::string_view& path, int64_t modificationTime, uint32_t parent) {
+        TableDirectory& directory = directories.emplace_back();
+        directory.modificationTime = modificationTime;
+        directory.pathOffset = AddString(path);
+        directory.pathLength = static_cast<uint32_t>(path.length());
+        directory.parent = parent;
+        directory.firstFile = static_cast<uint32_t>(files.size());
+        directory.fileCount = 0;
+        return static_cast<uint32_t>(directories.size() - 1);
+    }
+
+    /// Add a file to the current directory
+    /// \param path full path of the file
+    void AddFile(const std::string_view& path) {
+        auto index = static_cast<uint32_t>(files.size());
+
+        TableFile& tableFile = files.emplace_back();
+        tableFile.pathOffset = AddString(path);
+        tableFile.pathLength = static_cast<uint32_t>(path.length());
+        tableFile.directory = static_cast<uint32_t>(directories.size() - 1);
+        directories.back().fileCount++;
+
+        // Key all variants relative to the root
+        VisitPathVariants(path.substr(std::min(root.length(), path.length())), [&](const std::string_view& view) {
+            keys.push_back(TableKey {
+                .hash = HashPathVariant(view),
+                .file = index
+            });
+        });
+    }
+
+    /// Serialize the table
+    std::vector<uint8_t> Serialize() {
+        std::stable_sort(keys.begin(), keys.end(), [](const TableKey& lhs, const TableKey& rhs) {
+            return lhs.hash < rhs.hash;
+        });
+
+        TableHeader header {
+            .magic = kTableMagic,
+            .version = kTableVersion,
+            .key = GetRootKey(root, recursive),
+            .recursive = recursive,
+            .directoryCount = directories.size(),
+            .fileCount = files.size(),
+            .keyCount = keys.size(),
+            .stringByteCount = strings.size()
+        };
+
+        std::vector<uint8_t> out;
+        out.reserve(sizeof(header) + directories.size() * sizeof(TableDirectory) + files.size() * sizeof(TableFile) + keys.size() * sizeof(TableKey) + strings.size());
+        Append(out, &header, sizeof(header));
+        Append(out, directories.data(), directories.size() * sizeof(TableDirectory));
+        Append(out, files.data(), files.size() * sizeof(TableFile));
+        Append(out, keys.data(), keys.size() * sizeof(TableKey));
+        Append(out, strings.data(), strings.size());
+        return out;
+    }
+
+private:
+    /// Add a string to the string table
+    uint64_t AddString(const std::string_view& view) {
+        uint64_t offset = strings.size();
+        strings.append(view);
+        return offset;
+    }
+
+    /// Append raw bytes
+    static void Append(std::vector<uint8_t>& out, const void* data, size_t length) {
+        out.insert(out.end(), static_cast<const uint8_t*>(data), static_cast<const uint8_t*>(data) + length);
+    }
+
+private:
+    /// Root of this table
+    std::string root;
+
+    /// Sub-directories indexed?
+    bool recursive;
+
+    /// Records
+    std::vector<TableDirectory> directories;
+    std::vector<TableFile> files;
+    std::vector<TableKey> keys;
+
+    /// String table
+    std::string strings;
+};
+
+/// Refresh a table of a root, see below
+template<typename F>
+static std::shared_ptr<PDBPathIndexTable> RefreshTable(const std::string& root, bool recursive, const PDBPathIndexTable* previous, F&& cancel, PDBPathIndex::Statistics& statistics);
+
+PDBPathIndex::PDBPathIndex(const std::filesystem::path &cacheDirectory) : cacheDirectory(cacheDirectory) {
+    // Start worker
+    thread = std::thread(&PDBPathIndex::Worker, this);
+}
+
+PDBPathIndex::~PDBPathIndex() {
+    // Cancel pending work
+    {
+        std::lock_guard guard(mutex);
+        exitFlag = true;
+        cancelRequest.store(~0ull);
+    }
+
+    // Wait for worker
+    wake.notify_all();
+    thread.join();
+}
+
+void PDBPathIndex::Index(const std::vector<std::string> &roots, bool recursive) {
+    std::lock_guard guard(mutex);
+
+    // Persisted tables are immediately visible
+    std::vector<std::shared_ptr<const PDBPathIndexTable>> tables;
+    std::vector<std::shared_ptr<const PDBPathIndexTable>> built;
+    for (const std::string& root : roots) {
+        if (std::shared_ptr<const PDBPathIndexTable> table = LoadTable(root, recursive)) {
+            tables.push_back(std::move(table));
+            statistics.loadedTableCount++;
+            continue;
+        }
+
+        // Nothing persisted, build the first table before returning so lookups never miss on the first session
+        std::shared_ptr<const PDBPathIndexTable> table = RefreshTable(root, recursive, nullptr, [] { return false; }, statistics);
+        tables.push_back(table);
+        built.push_back(std::move(table));
+    }
+
+    Publish(std::move(tables));
+
+    // Schedule refresh, cancels any in-flight refresh
+    pending.roots = roots;
+    pending.built = std::move(built);
+    pending.recursive = recursive;
+    pending.id = ++requestCounter;
+    cancelRequest.store(pending.id);
+    wake.notify_one();
+}
+
+void PDBPathIndex::Wait() {
+    std::unique_lock lock(mutex);
+    completed.wait(lock, [&] { return completedCounter == requestCounter; });
+}
+
+void PDBPathIndex::GetCandidates(const std::string_view &path, PDBCandidateList &candidates, PDBCandidateReferences &references) const {
+    // The view may be retired during the lookup, see Publish
+    ReaderEpochScope scope;
+
+    const View* live = view.load(std::memory_order_acquire);
+    if (!live) {
+        return;
+    }
+
+    size_t begin = candidates.Size();
+
+    // Search all tables by all variants
+    VisitPathVariants(path, [&](const std::string_view& variant) {
+        uint32_t hash = HashPathVariant(variant);
+        for (const std::shared_ptr<const PDBPathIndexTable>& table : live->tables) {
+            table->GetCandidates(hash, candidates);
+        }
+    });
+
+    // Keep the tables alive for as long as the caller holds the candidates
+    if (candidates.Size() != begin) {
+        references.insert(references.end(), live->tables.begin(), live->tables.end());
+    }
+}
+
+PDBPathIndex::Statistics PDBPathIndex::GetStatistics() {
+    std::lock_guard guard(mutex);
+    return statistics;
+}
+
+void PDBPathIndex::Publish(std::vector<std::shared_ptr<const PDBPathIndexTable>> &&tables) {
+    auto next = std::make_unique<View>();
+    next->tables = std::move(tables);
+
+    // Swap the live view
+    view.store(next.get(), std::memory_order_release);
+    std::unique_ptr<View> retired = std::exchange(liveView, std::move(next));
+
+    // Release the previous view once no lookup may observe it, handed out
+    // candidates keep their tables alive through the references
+    if (retired) {
+        SynchronizeReaderEpoch();
+    }
+}
+
+/// Refresh a table of a root
+/// \param root root directory
+/// \param recursive index sub-directories
+/// \param previous previous table, may be null
+/// \param cancel polled for cancellation
+/// \param statistics refresh statistics
+/// \return nullptr if cancelled
+template<typename F>
+static std::shared_ptr<PDBPathIndexTable> RefreshTable(const std::string& root, bool recursive, const PDBPathIndexTable* previous, F&& cancel, PDBPathIndex::Statistics& statistics) {
+    PDBPathIndexTableBuilder builder(root, recursive);
+
+    // Directories modified after this point cannot be trusted on the next refresh
+    const int64_t racyTime = (std::filesystem::file_time_type::clock::now() - kRacyWindow).time_since_epoch().count();
+
+    // Previous directories by path, and their children
+    std::unordered_map<std::string_view, uint32_t> previousDirectories;
+    std::vector<std::vector<uint32_t>> previousChildren;
+    if (previous) {
+        const uint64_t directoryCount = previous->GetHeader().directoryCount;
+        previousChildren.resize(directoryCount);
+
+        for (uint32_t i = 0; i < directoryCount; i++) {
+            previousDirectories[previous->GetDirectoryPath(i)] = i;
+
+            if (i) {
+                previousChildren[previous->GetDirectories()[i].parent].push_back(i);
+            }
+        }
+    }
+
+    struct PendingDirectory {
+        /// Directory path
+        std::string path;
+
+        /// Index in the previous table
+        uint32_t previousIndex;
+
+        /// Parent in the new table
+        uint32_t parent;
+    };
+
+    // Find a previous directory
+    auto findPrevious = [&](const std::string_view& path) {
+        auto it = previousDirectories.find(path);
+        return it != previousDirectories.end() ? it->second : kInvalidIndex;
+    };
+
+    // Depth first walk
+    std::vector<PendingDirectory> stack;
+    stack.push_back(PendingDirectory {
+        .path = root,
+        .previousIndex = findPrevious(root),
+        .parent = kInvalidIndex
+    });
+
+    while (!stack.empty()) {
+        if (cancel()) {
+            return nullptr;
+        }
+
+        PendingDirectory directory = std::move(stack.back());
+        stack.pop_back();
+
+        // Directory may have been removed
+        std::error_code error;
+        std::filesystem::file_time_type time = std::filesystem::last_write_time(directory.path, error);
+        if (error) {
+            continue;
+        }
+
+        // Recently modified directories must be enumerated on the next refresh
+        int64_t modificationTime = time.time_since_epoch().count();
+        uint32_t index = builder.BeginDirectory(directory.path, modificationTime >= racyTime ? kUntrustedTime : modificationTime, directory.parent);
+
+        // Unchanged since the previous table?
+        if (directory.previousIndex != kInvalidIndex) {
+            const TableDirectory& previousDirectory = previous->GetDirectories()[directory.previousIndex];
+            if (previousDirectory.modificationTime != kUntrustedTime && previousDirectory.modificationTime == modificationTime) {
+                statistics.reusedDirectoryCount++;
+
+                // Reuse all files
+                for (uint32_t i = 0; i < previousDirectory.fileCount; i++) {
+                    builder.AddFile(previous->GetFilePath(previousDirectory.firstFile + i));
+                }
+
+                // Children are unchanged, their contents may not be
+                for (uint32_t child : previousChildren[directory.previousIndex]) {
+                    stack.push_back(PendingDirectory {
+                        .path = std::string(previous->GetDirectoryPath(child)),
+                        .previousIndex = child,
+                        .parent = index
+                    });
+                }
+
+                continue;
+            }
+        }
+
+        statistics.enumeratedDirectoryCount++;
+
+        // Enumerate contents
+        for (std::filesystem::directory_iterator it(directory.path, error), end; !error && it != end; it.increment(error)) {
+            std::error_code entryError;
+
+            // Sub-directories are not indexed, symbolic links are not followed
+            if (it->is_directory(entryError)) {
+                if (recursive && !it->is_symlink(entryError)) {
+                    std::string path = it->path().string();
+                    uint32_t previousIndex = findPrevious(path);
+
+                    stack.push_back(PendingDirectory {
+                        .path = std::move(path),
+                        .previousIndex = previousIndex,
+                        .parent = index
+                    });
+                }
+
+                continue;
+            }
+
+            builder.AddFile(it->path().string());
+        }
+    }
+
+    // Create table
+    auto table = std::make_shared<PDBPathIndexTable>();
+    table->Assign(builder.Serialize());
+    return table;
+}
+
+void PDBPathIndex::Worker() {
+    std::unique_lock lock(mutex);
+
+    for (;;) {
+        wake.wait(lock, [&] { return exitFlag || completedCounter != requestCounter; });
+
+        // Exit requested?
+        if (exitFlag) {
+            return;
+        }
+
+        // Take latest request
+        Request request = pending;
+
+        // Current tables are the starting point
+        std::vector<std::shared_ptr<const PDBPathIndexTable>> previousTables = view.load(std::memory_order_acquire)->tables;
+
+        lock.unlock();
+
+        // Refresh all roots
+        auto cancel = [&] { return cancelRequest.load(std::memory_order_relaxed) != request.id; };
+
+        Statistics requestStatistics;
+        std::vector<std::shared_ptr<const PDBPathIndexTable>> tables;
+        for (const std::string& root : request.roots) {
+            // Freshly built tables only need persisting
+            auto built = std::find_if(request.built.begin(), request.built.end(), [&](const std::shared_ptr<const PDBPathIndexTable>& table) {
+                return table->GetDirectoryPath(0) == root;
+            });
+
+            if (built != request.built.end()) {
+                StoreTable(**built, GetRootKey(root, request.recursive));
+                tables.push_back(*built);
+                continue;
+            }
+
+            // Find previous table of this root
+            const PDBPathIndexTable* previous{nullptr};
+            for (const std::shared_ptr<const PDBPathIndexTable>& table : previousTables) {
+                if (table->GetDirectoryPath(0) == root) {
+                    previous = table.get();
+                }
+            }
+
+            // Refresh
+            std::shared_ptr<PDBPathIndexTable> table = RefreshTable(root, request.recursive, previous, cancel, requestStatistics);
+            if (!table) {
+                break;
+            }
+
+            // Persist for the next session
+            StoreTable(*table, GetRootKey(root, request.recursive));
+            tables.push_back(std::move(table));
+        }
+
+        lock.lock();
+
+        // Superseded requests are discarded
+        if (cancel()) {
+            continue;
+        }
+
+        Publish(std::move(tables));
+
+        // Accumulate statistics
+        statistics.enumeratedDirectoryCount += requestStatistics.enumeratedDirectoryCount;
+        statistics.reusedDirectoryCount += requestStatistics.reusedDirectoryCount;
+
+        // Mark as completed
+        completedCounter = request.id;
+        completed.notify_all();
+    }
+}
+
+std::filesystem::path PDBPathIndex::GetTablePath(uint32_t key, uint64_t generation) const {
+    char name[64];
+    std::snprintf(name, sizeof(name), "%08x.%llu%s", key, static_cast<unsigned long long>(generation), kTableExtension);
+    return cacheDirectory / name;
+}
+
+/// Get all persisted generations of a key, sorted by descending generation
+static std::vector<uint64_t> GetTableGenerations(const std::filesystem::path& cacheDirectory, uint32_t key) {
+    char prefix[16];
+    std::snprintf(prefix, sizeof(prefix), "%08x.", key);
+
+    std::vector<uint64_t> generations;
+
+    // Find all tables of this key
+    std::error_code error;
+    for (std::filesystem::directory_iterator it(cacheDirectory, error), end; !error && it != end; it.increment(error)) {
+        std::string filename = it->path().filename().string();
+        if (filename.rfind(prefix, 0) != 0 || it->path().extension() != kTableExtension) {
+            continue;
+        }
+
+        // Parse generation
+        unsigned long long generation;
+        if (std::sscanf(filename.c_str() + std::strlen(prefix), "%llu", &generation) == 1) {
+            generations.push_back(generation);
+        }
+    }
+
+    std::sort(generations.rbegin(), generations.rend());
+    return generations;
+}
+
+std::shared_ptr<const PDBPathIndexTable> PDBPathIndex::LoadTable(const std::string &root, bool recursive) {
+    uint32_t key = GetRootKey(root, recursive);
+
+    // Latest valid generation
+    for (uint64_t candidate : GetTableGenerations(cacheDirectory, key)) {
+        auto table = std::make_shared<PDBPathIndexTable>();
+        if (table->Map(GetTablePath(key, candidate)) && table->Validate(root, recursive)) {
+            return table;
+        }
+    }
+
+    // None found
+    return nullptr;
+}
+
+void PDBPathIndex::StoreTable(const PDBPathIndexTable &table, uint32_t key) {
+    std::vector<uint64_t> generations = GetTableGenerations(cacheDirectory, key);
+
+    // Next generation, older generations may still be mapped
+    uint64_t generation = generations.empty() ? 1 : generations.front() + 1;
+    std::filesystem::path path = GetTablePath(key, generation);
+
+    // Write to a temporary file first, readers never observe partial tables
+    std::filesystem::path temporaryPath = path;
+    temporaryPath += ".tmp";
+    {
+        std::ofstream stream(temporaryPath, std::ios::binary | std::ios::trunc);
+        stream.write(reinterpret_cast<const char*>(table.GetData()), static_cast<std::streamsize>(table.GetSize()));
+
+        // Failed?
+        if (!stream.good()) {
+            return;
+        }
+    }
+
+    // Publish
+    std::error_code error;
+    std::filesystem::rename(temporaryPath, path, error);
+    if (error) {
+        std::filesystem::remove(temporaryPath, error);
+        return;
+    }
+
+    // Remove older generations, deferred by the system if mapped
+    for (uint64_t previous : generations) {
+        std::filesystem::remove(GetTablePath(key, previous), error);
+    }
+}
@@ -560,7 +560,7 @@ DescriptorHeapState::~DescriptorHeapState() {
 
     // GPU visibility optional
     if (flags & D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE) {
-        table.state->cpuHeapTable.Remove(type, gpuDescriptorBase.ptr);
+        table.state->gpuHeapTable.Remove(type, gpuDescriptorBase.ptr);
     }
 
     // Release table
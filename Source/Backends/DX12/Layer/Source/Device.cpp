@@ -57,9 +57,11 @@
 
 // Backend
 #include <Backend/EnvironmentInfo.h>
+#include <Backend/EnvironmentKeys.h>
 #include <Backend/StartupEnvironment.h>
 #include <Backend/IFeatureHost.h>
 #include <Backend/IFeature.h>
+#include <Backend/ShaderSourceStore.h>
 
 // Bridge
 #include <Bridge/IBridge.h>
@@ -73,6 +75,7 @@
 #endif // NDEBUG
 #include <Common/IComponentTemplate.h>
 #include <Common/GlobalUID.h>
+#include <Common/String.h>
 
 // Detour
 #include <Detour/detours.h>
@@ -83,6 +86,7 @@
 #include <sstream>
 #endif // NDEBUG
 #include <fstream>
+#include <string>
 
 // Debugging allocator
 #ifndef NDEBUG
@@ -248,6 +252,9 @@ HRESULT WINAPI D3D12CreateDeviceGPUOpen(
         state->shaderDataHost = state->registry.AddNew<ShaderDataHost>(state);
         ENSURE(state->shaderDataHost->Install(), "Failed to install shader data host");
 
+        // Create the shared source store, must exist before any module parsing
+        state->sourceStore = state->registry.AddNew<ShaderSourceStore>();
+
         // Create the program host
         state->shaderProgramHost = state->registry.AddNew<ShaderProgramHost>(state);
         ENSURE(state->shaderProgramHost->Install(), "Failed to install shader program host");
@@ -273,6 +280,18 @@ HRESULT WINAPI D3D12CreateDeviceGPUOpen(
         auto shaderDebug = state->registry.AddNew<ShaderCompilerDebug>();
 #endif
 
+        // Validator signing may be explicitly requested
+        size_t validatorSigningKeySize;
+        if (char* validatorSigningKey{nullptr}; _dupenv_s(&validatorSigningKey, &validatorSigningKeySize, Backend::kValidatorSigningKey) == 0 && validatorSigningKey) {
+            std::string value = std::trim_copy(validatorSigningKey);
+            free(validatorSigningKey);
+
+            // Boolean value, empty or negative values keep native signing
+            if (!value.empty() && value != "0" && !std::iequals(value, "false") && !std::iequals(value, "off") && !std::iequals(value, "no")) {
+                D3D12GPUOpenProcessInfo.isNativeContainerSigningEnabled = false;
+            }
+        }
+
         // Install the dxil signer
         auto dxilSigner = state->registry.AddNew<DXILSigner>();
         ENSURE(dxilSigner->Install(), "Failed to install DXIL signer");
@@ -625,9 +625,7 @@ void ShaderExportStreamer::Process() {
     
     // Invoke proxies for all handles
     for (CommandContextHandle handle : completedHandles) {
-        for (const FeatureHookTable &proxyTable: device->featureHookTables) {
-            proxyTable.join.TryInvoke(handle);
-        }
+        FeatureSubmissionHookTable::Invoke(device->submissionHookTable.join, handle);
     }
 }
 
@@ -647,9 +645,7 @@ void ShaderExportStreamer::Process(CommandQueueState* queueState) {
     
     // Invoke proxies for all handles
     for (CommandContextHandle handle : completedHandles) {
-        for (const FeatureHookTable &proxyTable: device->featureHookTables) {
-            proxyTable.join.TryInvoke(handle);
-        }
+        FeatureSubmissionHookTable::Invoke(device->submissionHookTable.join, handle);
     }
 }
 
@@ -83,11 +83,9 @@ ShaderState *GetOrCreateShaderState(DeviceState *device, const D3D12_SHADER_BYTE
     shaderState->parent = device;
     shaderState->key = key;
 
-    // Copy key memory
-    auto shader = new (device->allocators, kAllocStateShader) uint8_t[byteCode.BytecodeLength];
-    std::memcpy(shader, byteCode.pShaderBytecode, byteCode.BytecodeLength);
-    shaderState->byteCode.BytecodeLength = byteCode.BytecodeLength;
-    shaderState->byteCode.pShaderBytecode = shader;
+    // Share the byte code and parsed module with previous states of the same byte code
+    shaderState->moduleEntry = device->shaderModuleCache.Acquire(key.hash, byteCode);
+    shaderState->byteCode = shaderState->moduleEntry->byteCode;
 
     // Add owning user
     shaderState->AddUser();
@@ -694,6 +692,9 @@ ShaderState::~ShaderState() {
     // Remove tracked objects
     parent->states_Shaders.RemoveNoLock(this);
     parent->shaderSet.Remove(key);
+
+    // Release shared module
+    parent->shaderModuleCache.Release(moduleEntry);
 }
 
 D3D12_SHADER_BYTECODE ShaderState::GetInstrument(const ShaderInstrumentationKey &instrumentationKey) {
@@ -62,6 +62,7 @@ bool ShaderProgramHost::Install() {
     job.byteCode = reinterpret_cast<const uint32_t*>(kSPIRVInbuiltTemplateModuleD3D12);
     job.byteLength = static_cast<uint32_t>(sizeof(kSPIRVInbuiltTemplateModuleD3D12));
     job.pdbController = device->pdbController;
+    job.sourceStore = device->sourceStore;
 
     // Attempt to parse template data
     if (!templateModule->Parse(job)) {
@@ -0,0 +1,162 @@
+// 
+// The MIT License (MIT)
+// 
+// Copyright (c) 2024 Advanced Micro Devices, Inc.,
+// Fatalist Development AB (Avalanche Studio Group),
+// and Miguel Petersen.
+// 
+// All Rights Reserved.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy 
+// of this software and associated documentation files (the "Software"), to deal 
+// in the Software without restriction, including without limitation the rights 
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies 
+// of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, 
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+// Catch2
+#include <catch2/catch.hpp>
+
+// Layer
+#include <Backends/DX12/Compiler/DXContainerHash.h>
+#include <Backends/DX12/Compiler/DXBC/DXBCHeader.h>
+
+// Std
+#include <vector>
+#include <string>
+#include <cstring>
+
+/*
+ * Reference digests were produced by the retail container hash in dxil.dll.
+ * */
+
+/// Format a digest
+static std::string ToHex(const uint8_t (&digest)[kDXContainerDigestSize]) {
+    static constexpr const char* kHex = "0123456789abcdef";
+
+    std::string out;
+    for (uint8_t byte : digest) {
+        out += kHex[byte >> 4];
+        out += kHex[byte & 0xF];
+    }
+
+    return out;
+}
+
+/// Create a deterministic pattern
+static std::vector<uint8_t> CreatePattern(uint32_t length) {
+    std::vector<uint8_t> data(length);
+    for (uint32_t i = 0; i < length; i++) {
+        data[i] = static_cast<uint8_t>(i * 31 + 7);
+    }
+
+    return data;
+}
+
+/// Hash a buffer
+static std::string Hash(const void* data, uint32_t length) {
+    uint8_t digest[kDXContainerDigestSize];
+    ComputeDXContainerHash(data, length, digest);
+    return ToHex(digest);
+}
+
+/// Signed reference container, SFI0 and DXIL parts
+static const uint8_t kReferenceContainer[] = {
+    0x44, 0x58, 0x42, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x28, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x53, 0x46, 0x49, 0x30, 0x08, 0x00, 0x00, 0x00,
+    0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x58, 0x49, 0x4c, 0x34, 0x00, 0x00, 0x00,
+    0x07, 0x26, 0x45, 0x64, 0x83, 0xa2, 0xc1, 0xe0, 0xff, 0x1e, 0x3d, 0x5c, 0x7b, 0x9a, 0xb9, 0xd8,
+    0xf7, 0x16, 0x35, 0x54, 0x73, 0x92, 0xb1, 0xd0, 0xef, 0x0e, 0x2d, 0x4c, 0x6b, 0x8a, 0xa9, 0xc8,
+    0xe7, 0x06, 0x25, 0x44, 0x63, 0x82, 0xa1, 0xc0, 0xdf, 0xfe, 0x1d, 0x3c, 0x5b, 0x7a, 0x99, 0xb8,
+    0xd7, 0xf6, 0x15, 0x34
+};
+
+/// Expected digest of the reference container
+static constexpr const char* kReferenceContainerDigest = "b0aed10d0accbfc28750f47dc1344fd5";
+
+TEST_CASE("Backend.DX12.ContainerHash.Vectors") {
+    // All padding boundaries, single and dual final blocks
+    struct Vector {
+        uint32_t length;
+        const char* digest;
+    } vectors[] = {
+        { 0, "140d60f6b775e2ba4e4abed401b2e9a1" },
+        { 1, "2c0faf2f1e272c8285c0dd537f95097a" },
+        { 55, "6f1fd0a7d12099693fc16d6c45c28f64" },
+        { 56, "20ec0f395e3a535afa0ec7ff65c2a16c" },
+        { 63, "c0edec77c67afbd4fc95cb4c30f69e2c" },
+        { 64, "1d75e7085da262ff1baaf8a651673d6b" },
+        { 119, "6842a3826a07dd998048e7b0d509a503" },
+        { 120, "8246f418c90917b464222ddd2fe797eb" },
+        { 1000, "b984c9fe5a435c384216a12d658e393d" }
+    };
+
+    for (const Vector& vector : vectors) {
+        std::vector<uint8_t> data = CreatePattern(vector.length);
+        CHECK(Hash(data.data(), vector.length) == vector.digest);
+    }
+
+    // Differs from standard MD5 (900150983cd24fb0d6963f7d28e17f72)
+    REQUIRE(Hash("abc", 3) == "fbf0ffb01d1f9d12864dff8830d1b4a3");
+}
+
+TEST_CASE("Backend.DX12.ContainerHash.Sign") {
+    std::vector<uint8_t> container(std::begin(kReferenceContainer), std::end(kReferenceContainer));
+
+    // Sign in place
+    REQUIRE(SignDXContainer(container.data(), container.size()));
+
+    // Validate digest
+    auto* header = reinterpret_cast<DXBCHeader*>(container.data());
+    REQUIRE(ToHex(header->privateChecksum) == kReferenceContainerDigest);
+
+    // Re-signing must not depend on the previous digest
+    REQUIRE(SignDXContainer(container.data(), container.size()));
+    REQUIRE(ToHex(header->privateChecksum) == kReferenceContainerDigest);
+
+    // Any change in contents must change the digest
+    container.back() ^= 0x1;
+    REQUIRE(SignDXContainer(container.data(), container.size()));
+    REQUIRE(ToHex(header->privateChecksum) != kReferenceContainerDigest);
+}
+
+TEST_CASE("Backend.DX12.ContainerHash.Malformed") {
+    std::vector<uint8_t> container(std::begin(kReferenceContainer), std::end(kReferenceContainer));
+
+    // Truncated header
+    REQUIRE(!SignDXContainer(container.data(), sizeof(DXBCHeader) - 1));
+
+    // Length mismatch
+    REQUIRE(!SignDXContainer(container.data(), container.size() - 4));
+
+    // Invalid identifier
+    container[0] = 'X';
+    REQUIRE(!SignDXContainer(container.data(), container.size()));
+
+    // Digest must be untouched on failure
+    auto* header = reinterpret_cast<DXBCHeader*>(container.data());
+    for (uint8_t byte : header->privateChecksum) {
+        REQUIRE(byte == 0x0);
+    }
+}
+
+TEST_CASE("Backend.DX12.ContainerHash.Benchmark", "[!benchmark]") {
+    std::vector<uint8_t> data = CreatePattern(64u * 1024u);
+
+    BENCHMARK("64KB") {
+        uint8_t digest[kDXContainerDigestSize];
+        ComputeDXContainerHash(data.data(), static_cast<uint32_t>(data.size()), digest);
+        return digest[0];
+    };
+}
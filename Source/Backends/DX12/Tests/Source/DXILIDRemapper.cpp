@@ -0,0 +1,342 @@
+// 
+// The MIT License (MIT)
+// 
+// Copyright (c) 2024 Advanced Micro Devices, Inc.,
+// Fatalist Development AB (Avalanche Studio Group),
+// and Miguel Petersen.
+// 
+// All Rights Reserved.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy 
+// of this software and associated documentation files (the "Software"), to deal 
+// in the Software without restriction, including without limitation the rights 
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies 
+// of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, 
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+// Catch2
+#include <catch2/catch.hpp>
+
+// Layer
+#include <Backends/DX12/Compiler/DXIL/DXILIDRemapper.h>
+
+// Std
+#include <vector>
+
+/// Synthetic function, records with a value every other record, each referencing prior values
+///   User values are inserted before the record at the given index, all prior values keep their identity
+struct DXILIDRemapperFunction {
+    DXILIDRemapperFunction(uint32_t recordCount, uint32_t operandCount, uint32_t userRecord) : program(allocators, 0), idMap(allocators, program), remapper(allocators, idMap) {
+        records.resize(recordCount);
+        operands.resize(recordCount * operandCount);
+
+        // Create records
+        for (uint32_t i = 0; i < recordCount; i++) {
+            LLVMRecord& record = records[i];
+            record.SetSource(i % 2 == 0, valueCount);
+            record.opCount = operandCount;
+            record.ops = operands.data() + i * operandCount;
+
+            // Relative references to previous values
+            for (uint32_t op = 0; op < operandCount; op++) {
+                record.ops[op] = valueCount ? 1 + (i * 7 + op) % std::min(valueCount, 64u) : 0;
+            }
+
+            // Values allocate the next source index
+            valueCount += record.hasValue;
+        }
+
+        // Source bound
+        remapper.SetBound(valueCount + 1, 0);
+
+        // Allocate all results
+        for (uint32_t i = 0; i < recordCount; i++) {
+            LLVMRecord& record = records[i];
+
+            // Offset all subsequent stitched values, mirrors injected instrumentation
+            if (i == userRecord) {
+                for (uint32_t user = 0; user < 16; user++) {
+                    remapper.AllocUserMapping(user);
+                }
+            }
+
+            DXILIDRemapper::Anchor anchor = remapper.GetAnchor();
+
+            if (record.hasValue) {
+                remapper.AllocRecordMapping(record);
+            }
+
+            record.result = anchor.stitchAnchor;
+        }
+    }
+
+    /// Restore the source operands
+    void Reset(const std::vector<uint64_t>& source) {
+        std::memcpy(operands.data(), source.data(), sizeof(uint64_t) * source.size());
+    }
+
+    Allocators allocators;
+    IL::Program program;
+    DXILIDMap idMap;
+    DXILIDRemapper remapper;
+    std::vector<LLVMRecord> records;
+    std::vector<uint64_t> operands;
+
+    /// Number of source values
+    uint32_t valueCount{0};
+};
+
+TEST_CASE("Backend.DX12.DXILIDRemapper") {
+    DXILIDRemapperFunction function(1024, 4, 512);
+
+    // Values of the first half keep their identity
+    REQUIRE(function.remapper.GetIdentityBound() == 256);
+
+    // Keep source operands
+    std::vector<uint64_t> source = function.operands;
+
+    SECTION("Relative") {
+        for (LLVMRecord& record : function.records) {
+            DXILIDRemapper::Anchor anchor{record.result};
+
+            for (uint32_t i = 0; i < record.opCount; i++) {
+                function.remapper.RemapRelative(anchor, record, record.ops[i]);
+            }
+        }
+
+        // Relative operands are re-encoded against the stitched anchor
+        for (uint32_t i = 0; i < function.records.size(); i++) {
+            const LLVMRecord& record = function.records[i];
+
+            for (uint32_t op = 0; op < record.opCount; op++) {
+                uint32_t absolute = function.remapper.TryGetSourceMapping(record.sourceAnchor - static_cast<uint32_t>(source[i * record.opCount + op]));
+                REQUIRE(record.ops[op] == record.result - absolute);
+            }
+        }
+    }
+
+    SECTION("Relative Array") {
+        for (LLVMRecord& record : function.records) {
+            DXILIDRemapper::Anchor anchor{record.result};
+            function.remapper.RemapRelativeArray(anchor, record, record.ops, record.opCount);
+        }
+
+        for (uint32_t i = 0; i < function.records.size(); i++) {
+            const LLVMRecord& record = function.records[i];
+
+            for (uint32_t op = 0; op < record.opCount; op++) {
+                uint32_t absolute = record.sourceAnchor - static_cast<uint32_t>(source[i * record.opCount + op]);
+
+                // Identity values keep the relative distance up to the inserted user values
+                if (i < 512) {
+                    REQUIRE(record.ops[op] == source[i * record.opCount + op]);
+                } else if (absolute < 256) {
+                    REQUIRE(record.ops[op] == source[i * record.opCount + op] + 16);
+                } else {
+                    REQUIRE(record.ops[op] == source[i * record.opCount + op]);
+                }
+            }
+        }
+    }
+
+    SECTION("Absolute") {
+        for (LLVMRecord& record : function.records) {
+            for (uint32_t i = 0; i < record.opCount; i++) {
+                function.remapper.Remap(record.ops[i]);
+            }
+        }
+
+        // Absolute source values map directly
+        for (uint32_t i = 0; i < function.operands.size(); i++) {
+            REQUIRE(function.operands[i] == function.remapper.TryGetSourceMapping(static_cast<uint32_t>(source[i])));
+        }
+    }
+
+    SECTION("Absolute Array") {
+        for (LLVMRecord& record : function.records) {
+            function.remapper.RemapArray(record.ops, record.opCount);
+        }
+
+        // Values past the inserted user values are shifted
+        for (uint32_t i = 0; i < function.operands.size(); i++) {
+            REQUIRE(function.operands[i] == (source[i] < 256 ? source[i] : source[i] + 16));
+        }
+    }
+
+    SECTION("Forward") {
+        // The value past the last record is not mapped yet
+        uint32_t forward = function.valueCount;
+        REQUIRE(function.remapper.TryGetSourceMapping(forward) == ~0u);
+
+        // Nullable forward reference
+        uint64_t operand = forward + 1;
+        function.remapper.Remap(operand, DXILIDRemapRule::Nullable);
+
+        // Resolve
+        uint32_t valueId = function.remapper.AllocSourceMapping(forward);
+        function.remapper.ResolveForwardReferences();
+        REQUIRE(operand == valueId + 1);
+
+        // Resolved references must not be visited again
+        operand = 0;
+        function.remapper.ResolveForwardReferences();
+        REQUIRE(operand == 0);
+    }
+
+    SECTION("Merge") {
+        DXILIDRemapper::CompileSnapshot snapshot = function.remapper.CreateCompileSnapshot();
+
+        // Branched user mappings
+        for (uint32_t i = 16; i < 64; i++) {
+            function.remapper.SetUserMapping(i, i * 3);
+        }
+
+        // Branch and merge back
+        DXILIDRemapper::CompileSegment segment = function.remapper.Branch(snapshot);
+        REQUIRE(function.remapper.TryGetUserMapping(16) == ~0u);
+        function.remapper.Merge(segment);
+
+        // All mappings must be intact
+        for (uint32_t i = 16; i < 64; i++) {
+            REQUIRE(function.remapper.TryGetUserMapping(i) == i * 3);
+        }
+    }
+}
+
+TEST_CASE("Backend.DX12.DXILIDRemapper.Benchmark", "[!benchmark]") {
+    // Large function with wide operand lists, kept cache resident so the remapping itself dominates
+    DXILIDRemapperFunction function(1u << 14u, 16, 1u << 13u);
+
+    // Keep source operands
+    std::vector<uint64_t> source = function.operands;
+
+    BENCHMARK("Relative") {
+        function.Reset(source);
+
+        for (LLVMRecord& record : function.records) {
+            DXILIDRemapper::Anchor anchor{record.result};
+
+            for (uint32_t i = 0; i < record.opCount; i++) {
+                function.remapper.RemapRelative(anchor, record, record.ops[i]);
+            }
+        }
+    };
+
+    BENCHMARK("Relative Array") {
+        function.Reset(source);
+
+        for (LLVMRecord& record : function.records) {
+            DXILIDRemapper::Anchor anchor{record.result};
+            function.remapper.RemapRelativeArray(anchor, record, record.ops, record.opCount);
+        }
+    };
+
+    BENCHMARK("Absolute") {
+        function.Reset(source);
+
+        for (LLVMRecord& record : function.records) {
+            for (uint32_t i = 0; i < record.opCount; i++) {
+                function.remapper.Remap(record.ops[i]);
+            }
+        }
+    };
+
+    BENCHMARK("Absolute Array") {
+        function.Reset(source);
+
+        for (LLVMRecord& record : function.records) {
+            function.remapper.RemapArray(record.ops, record.opCount);
+        }
+    };
+}
+
+TEST_CASE("Backend.DX12.DXILIDRemapper.Identity") {
+    Allocators allocators;
+    IL::Program program(allocators, 0);
+    DXILIDMap idMap(allocators, program);
+    DXILIDRemapper remapper(allocators, idMap);
+
+    // Untouched values
+    remapper.SetBound(8, 0);
+    for (uint32_t i = 0; i < 4; i++) {
+        REQUIRE(remapper.AllocSourceMapping(i) == i);
+    }
+
+    REQUIRE(remapper.GetIdentityBound() == 4);
+
+    // Injected value, shifts all subsequent values
+    REQUIRE(remapper.AllocUserMapping(0) == 4);
+    REQUIRE(remapper.AllocSourceMapping(4) == 5);
+    REQUIRE(remapper.AllocSourceMapping(5) == 6);
+    REQUIRE(remapper.GetIdentityBound() == 4);
+
+    SECTION("Relative Array") {
+        LLVMRecord record;
+        record.SetSource(true, 6);
+
+        // Mixed identity, shifted and user operands
+        uint64_t ops[] = {1, 2, 3, 6, DXILIDRemapper::EncodeUserOperand(0)};
+        remapper.RemapRelativeArray(DXILIDRemapper::Anchor{7}, record, ops, 5);
+
+        REQUIRE(ops[0] == 1);
+        REQUIRE(ops[1] == 2);
+        REQUIRE(ops[2] == 4);
+        REQUIRE(ops[3] == 7);
+        REQUIRE(ops[4] == 3);
+    }
+
+    SECTION("Absolute Array") {
+        uint64_t ops[] = {0, 3, 4, 5};
+        remapper.RemapArray(ops, 4);
+
+        REQUIRE(ops[0] == 0);
+        REQUIRE(ops[1] == 3);
+        REQUIRE(ops[2] == 5);
+        REQUIRE(ops[3] == 6);
+    }
+
+    SECTION("Nullable Array") {
+        uint64_t ops[] = {1, 4, 5, 6};
+        remapper.RemapArray(ops, 4, DXILIDRemapRule::Nullable);
+
+        REQUIRE(ops[0] == 1);
+        REQUIRE(ops[1] == 4);
+        REQUIRE(ops[2] == 6);
+        REQUIRE(ops[3] == 7);
+    }
+
+    SECTION("Reassign") {
+        // Remapping a prefix value shrinks the identity range
+        remapper.SetSourceMapping(1, 9);
+        REQUIRE(remapper.GetIdentityBound() == 1);
+
+        uint64_t ops[] = {0, 1, 2};
+        remapper.RemapArray(ops, 3);
+
+        REQUIRE(ops[0] == 0);
+        REQUIRE(ops[1] == 9);
+        REQUIRE(ops[2] == 2);
+    }
+
+    SECTION("Revert") {
+        DXILIDRemapper::StitchSnapshot snapshot{.allocationIndex = 2, .sourceMappingOffset = 2};
+
+        // Branched values beyond the snapshot are no longer identity mapped
+        DXILIDRemapper::StitchSegment segment = remapper.Branch(snapshot);
+        REQUIRE(remapper.GetIdentityBound() == 2);
+
+        // Merging restores the range
+        remapper.Merge(segment);
+        REQUIRE(remapper.GetIdentityBound() == 4);
+    }
+}
@@ -0,0 +1,177 @@
+// 
+// The MIT License (MIT)
+// 
+// Copyright (c) 2024 Advanced Micro Devices, Inc.,
+// Fatalist Development AB (Avalanche Studio Group),
+// and Miguel Petersen.
+// 
+// All Rights Reserved.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy 
+// of this software and associated documentation files (the "Software"), to deal 
+// in the Software without restriction, including without limitation the rights 
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies 
+// of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, 
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+// Catch2
+#include <catch2/catch.hpp>
+
+// Layer
+#include <Backends/DX12/Compiler/DXIL/DXILPhysicalBlockScan.h>
+#include <Backends/DX12/Compiler/DXIL/LLVM/LLVMBitStreamWriter.h>
+#include <Backends/DX12/Compiler/DXStream.h>
+
+// Std
+#include <vector>
+#include <cstring>
+#include <cstddef>
+
+/// Abbreviation width of all synthetic blocks
+static constexpr uint32_t kAbbreviationSize = 4;
+
+/// Write a block, contents are written by the functor
+template<typename F>
+static void WriteBlock(LLVMBitStreamWriter& writer, uint32_t id, F&& contents) {
+    writer.VBR<uint32_t>(id, 8);
+    writer.VBR<uint32_t>(kAbbreviationSize, 4);
+    writer.AlignDWord();
+
+    // Patched after the contents
+    LLVMBitStreamWriter::Position lengthPos = writer.Fixed<uint32_t>(0);
+
+    contents();
+
+    // End block
+    writer.Fixed<uint32_t>(static_cast<uint32_t>(LLVMReservedAbbreviation::EndBlock), kAbbreviationSize);
+    writer.AlignDWord();
+
+    // Exclude the length itself
+    writer.FixedPatch<uint32_t>(lengthPos, static_cast<uint32_t>(LLVMBitStreamWriter::Position::DWord(lengthPos, writer.Pos()) - 1));
+}
+
+/// Write a sub-block within a block
+template<typename F>
+static void WriteSubBlock(LLVMBitStreamWriter& writer, uint32_t id, F&& contents) {
+    writer.Fixed<uint32_t>(static_cast<uint32_t>(LLVMReservedAbbreviation::EnterSubBlock), kAbbreviationSize);
+    WriteBlock(writer, id, contents);
+}
+
+/// Write an unabbreviated record
+static void WriteRecord(LLVMBitStreamWriter& writer, uint32_t id, const std::vector<uint64_t>& ops) {
+    writer.Fixed<uint32_t>(static_cast<uint32_t>(LLVMReservedAbbreviation::UnabbreviatedRecord), kAbbreviationSize);
+    writer.VBR<uint32_t>(id, 6);
+    writer.VBR<uint32_t>(static_cast<uint32_t>(ops.size()), 6);
+
+    for (uint64_t op : ops) {
+        writer.VBR<uint64_t>(op, 6);
+    }
+}
+
+/// Synthetic module, a root record followed by nested blocks with multi-chunk operands
+static void WriteModule(DXStream& stream) {
+    DXILHeader header{};
+    header.identifier = 'LIXD';
+    header.codeOffset = sizeof(DXILHeader) - offsetof(DXILHeader, identifier);
+
+    uint64_t headerOffset = stream.Append(header);
+
+    LLVMBitStreamWriter writer(stream);
+    writer.AddHeaderValidation();
+    writer.FixedEnum<LLVMReservedAbbreviation>(LLVMReservedAbbreviation::EnterSubBlock, 2);
+
+    WriteBlock(writer, 8, [&] {
+        WriteRecord(writer, 1, {1, 2});
+
+        WriteSubBlock(writer, 13, [&] {
+            WriteRecord(writer, 1, {'D', 'X', 'I', 'L'});
+
+            WriteSubBlock(writer, 14, [&] {
+                WriteRecord(writer, 3, {1000, 70000, 3});
+            });
+        });
+
+        WriteSubBlock(writer, 23, [&] {
+            WriteRecord(writer, 1, {~0ull >> 1, 0, 31, 32});
+        });
+    });
+
+    writer.Close();
+
+    // Patch lengths, same as stitching
+    uint64_t byteLength = stream.GetOffset() - headerOffset;
+
+    auto* streamHeader = stream.GetMutableDataAt<DXILHeader>(headerOffset);
+    streamHeader->dwordCount = static_cast<uint32_t>(byteLength / sizeof(uint32_t));
+    streamHeader->codeSize = static_cast<uint32_t>(byteLength - sizeof(DXILHeader));
+}
+
+/// Check if two blocks are byte identical in their source streams
+static bool IsSourceIdentical(const LLVMBlock* lhs, const LLVMBlock* rhs) {
+    return lhs->id == rhs->id &&
+           lhs->blockLength == rhs->blockLength &&
+           !std::memcmp(lhs->sourceData, rhs->sourceData, lhs->blockLength * sizeof(uint32_t));
+}
+
+TEST_CASE("Backend.DX12.DXILPhysicalBlockScan") {
+    Allocators allocators;
+
+    // Source module
+    DXStream source(allocators);
+    WriteModule(source);
+
+    DXILPhysicalBlockScan scan(allocators);
+    REQUIRE(scan.Scan(source.GetData(), source.GetByteSize()));
+    REQUIRE(scan.GetRoot().blocks.size() == 2);
+
+    SECTION("Unmodified") {
+        DXStream out(allocators);
+        scan.Stitch(out);
+
+        // Entire module is written back as is
+        REQUIRE(out.GetByteSize() == source.GetByteSize());
+        REQUIRE(!std::memcmp(out.GetData(), source.GetData(), source.GetByteSize()));
+    }
+
+    SECTION("Modified Root") {
+        uint64_t ops[] = {42};
+
+        // Dirty the root, children remain untouched
+        LLVMRecord record;
+        record.id = 2;
+        record.opCount = 1;
+        record.ops = ops;
+        scan.GetRoot().AddRecord(record);
+
+        DXStream out(allocators);
+        scan.Stitch(out);
+
+        // Re-scan the stitched module
+        DXILPhysicalBlockScan stitched(allocators);
+        REQUIRE(stitched.Scan(out.GetData(), out.GetByteSize()));
+
+        // Root is re-encoded
+        const LLVMBlock& root = stitched.GetRoot();
+        REQUIRE(root.records.size() == 2);
+        REQUIRE(root.records[1].Op(0) == 42);
+
+        // Children are byte identical
+        REQUIRE(root.blocks.size() == 2);
+        REQUIRE(IsSourceIdentical(root.blocks[0], scan.GetRoot().blocks[0]));
+        REQUIRE(IsSourceIdentical(root.blocks[1], scan.GetRoot().blocks[1]));
+
+        // Including their contents
+        REQUIRE(root.blocks[0]->blocks[0]->records[0].Op(1) == 70000);
+        REQUIRE(root.blocks[1]->records[0].Op(0) == ~0ull >> 1);
+    }
+}
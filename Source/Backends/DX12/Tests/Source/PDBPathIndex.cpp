@@ -0,0 +1,220 @@
+// 
+// The MIT License (MIT)
+// 
+// Copyright (c) 2024 Advanced Micro Devices, Inc.,
+// Fatalist Development AB (Avalanche Studio Group),
+// and Miguel Petersen.
+// 
+// All Rights Reserved.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy 
+// of this software and associated documentation files (the "Software"), to deal 
+// in the Software without restriction, including without limitation the rights 
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies 
+// of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, 
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+// Catch2
+#include <catch2/catch.hpp>
+
+// Layer
+#include <Backends/DX12/Controllers/PDBPathIndex.h>
+
+// Std
+#include <fstream>
+#include <random>
+#include <chrono>
+
+/// Temporary directory tree, removed on destruction
+struct PDBPathIndexSandbox {
+    PDBPathIndexSandbox() {
+        root = std::filesystem::temp_directory_path() / ("GRS.PDBPathIndex." + std::to_string(std::random_device{}()));
+        symbols = root / "Symbols";
+        cache = root / "Cache";
+
+        std::filesystem::create_directories(symbols / "Sub" / "Deep");
+        std::filesystem::create_directories(cache);
+
+        Touch(symbols / "a.pdb");
+        Touch(symbols / "Sub" / "b.pdb");
+        Touch(symbols / "Sub" / "Deep" / "c.pdb");
+
+        // Settle all directories well outside the racy window
+        Age(symbols, 0);
+        Age(symbols / "Sub", 0);
+        Age(symbols / "Sub" / "Deep", 0);
+    }
+
+    ~PDBPathIndexSandbox() {
+        std::error_code error;
+        std::filesystem::remove_all(root, error);
+    }
+
+    /// Create an empty file
+    static void Touch(const std::filesystem::path& path) {
+        std::ofstream stream(path);
+    }
+
+    /// Set a directory modification time in the past
+    static void Age(const std::filesystem::path& path, uint32_t seconds) {
+        std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now() - std::chrono::hours(1) + std::chrono::seconds(seconds));
+    }
+
+    /// Check if a lookup finds a file
+    static bool Contains(const PDBPathIndex& index, const std::string_view& path, const std::filesystem::path& expected) {
+        PDBCandidateList candidates;
+        PDBCandidateReferences references;
+        index.GetCandidates(path, candidates, references);
+
+        for (const std::string_view& candidate : candidates) {
+            if (candidate == expected.string()) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    std::filesystem::path root;
+    std::filesystem::path symbols;
+    std::filesystem::path cache;
+};
+
+TEST_CASE("Backend.DX12.PDBPathIndex") {
+    PDBPathIndexSandbox sandbox;
+    std::vector<std::string> roots { sandbox.symbols.string() };
+
+    // Initial session walks everything
+    {
+        PDBPathIndex index(sandbox.cache);
+        index.Index(roots, true);
+
+        // First table is visible without waiting for the background refresh
+        REQUIRE(PDBPathIndexSandbox::Contains(index, "b.pdb", sandbox.symbols / "Sub" / "b.pdb"));
+
+        index.Wait();
+
+        // Built tables are persisted, not walked again
+        PDBPathIndex::Statistics statistics = index.GetStatistics();
+        REQUIRE(statistics.loadedTableCount == 0);
+        REQUIRE(statistics.enumeratedDirectoryCount == 3);
+        REQUIRE(statistics.reusedDirectoryCount == 0);
+
+        // By file name, stem, and unrelated directories
+        REQUIRE(PDBPathIndexSandbox::Contains(index, "b.pdb", sandbox.symbols / "Sub" / "b.pdb"));
+        REQUIRE(PDBPathIndexSandbox::Contains(index, "c", sandbox.symbols / "Sub" / "Deep" / "c.pdb"));
+        REQUIRE(PDBPathIndexSandbox::Contains(index, "D:/Build/Out/a.pdb", sandbox.symbols / "a.pdb"));
+        REQUIRE(!PDBPathIndexSandbox::Contains(index, "d.pdb", sandbox.symbols / "Sub" / "d.pdb"));
+    }
+
+    SECTION("Persistence") {
+        PDBPathIndex index(sandbox.cache);
+        index.Index(roots, true);
+
+        // Persisted table is visible before the refresh completes
+        REQUIRE(PDBPathIndexSandbox::Contains(index, "b.pdb", sandbox.symbols / "Sub" / "b.pdb"));
+
+        index.Wait();
+
+        // Unchanged trees are not enumerated
+        PDBPathIndex::Statistics statistics = index.GetStatistics();
+        REQUIRE(statistics.loadedTableCount == 1);
+        REQUIRE(statistics.enumeratedDirectoryCount == 0);
+        REQUIRE(statistics.reusedDirectoryCount == 3);
+        REQUIRE(PDBPathIndexSandbox::Contains(index, "b.pdb", sandbox.symbols / "Sub" / "b.pdb"));
+    }
+
+    SECTION("Incremental") {
+        PDBPathIndexSandbox::Touch(sandbox.symbols / "Sub" / "d.pdb");
+        PDBPathIndexSandbox::Age(sandbox.symbols / "Sub", 1);
+
+        PDBPathIndex index(sandbox.cache);
+        index.Index(roots, true);
+        index.Wait();
+
+        // Only the modified directory is enumerated
+        PDBPathIndex::Statistics statistics = index.GetStatistics();
+        REQUIRE(statistics.enumeratedDirectoryCount == 1);
+        REQUIRE(statistics.reusedDirectoryCount == 2);
+        REQUIRE(PDBPathIndexSandbox::Contains(index, "d.pdb", sandbox.symbols / "Sub" / "d.pdb"));
+        REQUIRE(PDBPathIndexSandbox::Contains(index, "c.pdb", sandbox.symbols / "Sub" / "Deep" / "c.pdb"));
+    }
+
+    SECTION("Racy") {
+        // Directories modified during a walk are always enumerated on the next
+        PDBPathIndexSandbox::Touch(sandbox.symbols / "Sub" / "d.pdb");
+
+        for (uint32_t i = 0; i < 2; i++) {
+            PDBPathIndex index(sandbox.cache);
+            index.Index(roots, true);
+            index.Wait();
+
+            REQUIRE(index.GetStatistics().enumeratedDirectoryCount == 1);
+            REQUIRE(PDBPathIndexSandbox::Contains(index, "d.pdb", sandbox.symbols / "Sub" / "d.pdb"));
+        }
+    }
+
+    SECTION("Non Recursive") {
+        PDBPathIndex index(sandbox.cache);
+        index.Index(roots, false);
+        index.Wait();
+
+        // Keyed separately from recursive tables
+        PDBPathIndex::Statistics statistics = index.GetStatistics();
+        REQUIRE(statistics.loadedTableCount == 0);
+        REQUIRE(statistics.enumeratedDirectoryCount == 1);
+        REQUIRE(PDBPathIndexSandbox::Contains(index, "a.pdb", sandbox.symbols / "a.pdb"));
+        REQUIRE(!PDBPathIndexSandbox::Contains(index, "b.pdb", sandbox.symbols / "Sub" / "b.pdb"));
+    }
+
+    SECTION("Retirement") {
+        PDBPathIndex index(sandbox.cache);
+        index.Index(roots, true);
+        index.Wait();
+
+        PDBCandidateList candidates;
+        PDBCandidateReferences references;
+        index.GetCandidates("b.pdb", candidates, references);
+        REQUIRE(candidates.Size() > 0);
+        REQUIRE(!references.empty());
+
+        // Retire the view and its tables several times over
+        for (uint32_t i = 0; i < 4; i++) {
+            index.Index(roots, true);
+            index.Wait();
+        }
+
+        // Referenced candidates outlive their view
+        for (const std::string_view& candidate : candidates) {
+            REQUIRE(candidate == (sandbox.symbols / "Sub" / "b.pdb").string());
+        }
+
+        REQUIRE(PDBPathIndexSandbox::Contains(index, "b.pdb", sandbox.symbols / "Sub" / "b.pdb"));
+    }
+
+    SECTION("Corruption") {
+        for (const auto& entry : std::filesystem::directory_iterator(sandbox.cache)) {
+            std::filesystem::resize_file(entry.path(), std::filesystem::file_size(entry.path()) / 2);
+        }
+
+        PDBPathIndex index(sandbox.cache);
+        index.Index(roots, true);
+        index.Wait();
+
+        // Malformed tables are discarded
+        PDBPathIndex::Statistics statistics = index.GetStatistics();
+        REQUIRE(statistics.loadedTableCount == 0);
+        REQUIRE(statistics.enumeratedDirectoryCount == 3);
+        REQUIRE(PDBPathIndexSandbox::Contains(index, "b.pdb", sandbox.symbols / "Sub" / "b.pdb"));
+    }
+}
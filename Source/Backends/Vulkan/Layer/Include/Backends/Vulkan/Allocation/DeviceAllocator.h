@@ -90,6 +90,20 @@ public:
     /// \param length byte length
     void FlushMappedRange(const Allocation& allocation, uint64_t offset, uint64_t length);
 
+    /// Check if the device exposes large host visible device memory
+    /// \return true if DeviceHostVisible allocations may succeed
+    bool IsResizableBAR() const {
+        return resizableBAR;
+    }
+
+private:
+    /// Detect large host visible device memory
+    /// \param table parent table
+    void DetectResizableBAR(DeviceDispatchTable* table);
+
 private:
     VmaAllocator allocator{nullptr};
+
+    /// Does the device expose host visible device memory beyond the legacy window?
+    bool resizableBAR{false};
 };
\ No newline at end of file
@@ -37,4 +37,9 @@ struct MirrorAllocation {
 
     /// Host object, cpu-readable, mapping behaviour up to allocation
     Allocation host;
+
+    /// Check if the host and device objects share the same memory, no copies required
+    bool IsShared() const {
+        return host.allocation == device.allocation;
+    }
 };
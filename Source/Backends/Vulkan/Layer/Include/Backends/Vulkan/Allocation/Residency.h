@@ -35,5 +35,9 @@ enum class AllocationResidency {
     Host,
 
     /// Visible to the host and device
-    HostVisible
+    HostVisible,
+
+    /// Resident on GPU memory and directly writable by the host, only available with large host visible
+    /// device memory (resizable BAR). Mirror allocations fall back to Device.
+    DeviceHostVisible
 };
\ No newline at end of file
@@ -42,7 +42,8 @@ struct ShaderCompilerDiagnostic {
     /// Copy constructor
     ShaderCompilerDiagnostic(const ShaderCompilerDiagnostic& other) :
         failedJobs(other.failedJobs.load()),
-        passedJobs(other.passedJobs.load())
+        passedJobs(other.passedJobs.load()),
+        elidedChecks(other.elidedChecks.load())
     {
         /** poof */
     }
@@ -63,4 +64,7 @@ struct ShaderCompilerDiagnostic {
 
     /// Total number of passed jobs
     std::atomic<uint64_t> totalJobs{0};
+
+    /// Total number of instrumentation checks statically proven redundant
+    std::atomic<uint64_t> elidedChecks{0};
 };
@@ -36,6 +36,8 @@
 // Common
 #include <Common/IComponent.h>
 #include <Common/ComRef.h>
+#include <Common/Allocator/ArenaAllocator.h>
+#include <Common/Containers/ObjectPool.h>
 
 // Std
 #include <mutex>
@@ -86,7 +88,9 @@ protected:
     };
 
     /// Compile a given job
-    void CompileShader(const ShaderJobEntry &job);
+    /// \param job the job to compile
+    /// \param jobAllocators allocators for all intermediate job state, either the shared or job arena allocators
+    void CompileShader(const ShaderJobEntry &job, const Allocators& jobAllocators);
 
     /// Worker entry
     void Worker(void *userData);
@@ -107,4 +111,10 @@ private:
 
     /// Number of exports
     uint32_t exportCount{0};
+
+    /// Shared lock for the arena pool
+    std::mutex arenaMutex;
+
+    /// All free job arenas, at most one per concurrent job
+    ObjectPool<ArenaAllocator> arenaPool;
 };
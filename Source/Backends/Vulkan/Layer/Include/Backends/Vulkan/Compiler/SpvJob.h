@@ -34,6 +34,9 @@
 // Backend
 #include <Backend/Diagnostic/DiagnosticBucketScope.h>
 
+// Forward declarations
+struct ShaderCompilerDiagnostic;
+
 /// Job description
 struct SpvJob {
     /// The instrumentation key
@@ -47,4 +50,7 @@ struct SpvJob {
 
     /// Diagnostic
     DiagnosticBucketScope<DiagnosticType, uint64_t> messages;
+
+    /// Optional, compiler diagnostic counters
+    ShaderCompilerDiagnostic* diagnostic{nullptr};
 };
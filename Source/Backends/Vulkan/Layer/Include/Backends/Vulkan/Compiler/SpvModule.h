@@ -66,6 +66,11 @@ public:
     /// \return
     SpvModule* Copy() const;
 
+    /// Copy this module
+    /// \param copyAllocators allocators of the copy, all copied state is allocated from these
+    /// \return
+    SpvModule* Copy(const Allocators& copyAllocators) const;
+
     /// Parse a module
     /// \param code the SPIRV module pointer
     /// \param wordCount number of words within the module stream
@@ -35,6 +35,10 @@
 #include <Backend/IL/Type.h>
 #include <Backend/IL/Program.h>
 #include <Backend/IL/ID.h>
+#include <Backend/IL/ValueRangeAnalysis.h>
+
+// Std
+#include <optional>
 
 // Forward declarations
 struct SpvJob;
@@ -89,6 +93,9 @@ private:
 
         /// Does the dynamic offset require bounds checking?
         bool checkOutOfBounds{false};
+
+        /// Was any dynamic offset proven to be within its binding?
+        bool provenInBounds{false};
     };
 
     /// Find the originating resource decoration
@@ -97,6 +104,13 @@ private:
     /// \return found decoration
     DynamicSpvValueDecoration GetSourceResourceDecoration(const SpvJob& job, SpvStream& stream, IL::ID resource);
 
+    /// Check if a dynamic index is statically proven to be within its binding
+    /// \param job source job
+    /// \param source source decoration of the indexed binding
+    /// \param index dynamic index
+    /// \return true if no bounds checking is required
+    bool IsProvenInBounds(const SpvJob& job, const SpvValueDecoration& source, IL::ID index);
+
 private:
     /// Shared allocators
     Allocators allocators;
@@ -113,4 +127,7 @@ private:
     /// Type map
     const Backend::IL::Type *buffer32UIPtr{nullptr};
     const Backend::IL::Type *buffer32UI{nullptr};
+
+    /// Lazily computed value ranges, used for bounds check elision
+    std::optional<IL::ValueRangeAnalysis> valueRangeAnalysis;
 };
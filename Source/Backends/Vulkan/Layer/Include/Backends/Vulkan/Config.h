@@ -77,3 +77,24 @@
 ///   An alternative implementations would extend each staged bit, and then append new stages if
 ///   needed. However, this complicates the user side updates.
 #define PIPELINE_MERGE_PC_RANGES 1
+
+/// Minimum byte size of a SPIR-V module for compilation with a job arena
+///   Smaller modules spend microseconds in allocations, not worth pinning an arena chunk per worker.
+#define SHADER_COMPILER_ARENA_MIN_CODE_SIZE (32u * 1024u)
+
+/// Optimize the instrumented program prior to compilation
+///   Merges redundant literals, folds constants and removes dead instrumentation code.
+#define SHADER_COMPILER_OPTIMIZE_INSTRUMENTATION 1
+
+/// Outline instrumentation exports into shared functions, greatly reduces the size of heavily instrumented programs
+#define SHADER_COMPILER_OUTLINE_EXPORTS 1
+
+/// Maximum number of consecutive submissions on a queue sharing a single export segment
+///   Shared segments are patched and read back once, amortizing the cost over many small submissions, at the
+///   expense of message latency. Segments are closed on frame boundaries and queue waits. One disables sharing.
+#define SHADER_EXPORT_MAX_SHARED_SUBMISSIONS 1
+
+/// Maximum number of committed descriptor data segments per chunk considered for reuse
+///   Repeated bind patterns produce identical descriptor data, which is then bound from the previously written segment
+///   instead of appending a copy. Zero disables reuse.
+#define DESCRIPTOR_DATA_SEGMENT_CACHE_SIZE 64
@@ -43,6 +43,7 @@
 
 // Std
 #include <vector>
+#include <mutex>
 
 // Forward declarations
 struct CommandBufferObject;
@@ -73,12 +74,26 @@ public:
     /// \param size the byte size of the new stream
     void SetStreamSize(ShaderExportID id, uint64_t size);
 
+    /// Report the observed usage of a stream, adapts the size of future streams
+    /// \param id the shader export id
+    /// \param requestedByteSize the number of bytes requested by the device, may exceed the stream size
+    void ReportStreamUsage(ShaderExportID id, uint64_t requestedByteSize);
+
+    /// Resize all streams of a free segment to their current sizes
+    ///   ! Segment must not be in flight
+    /// \param segment the segment to resize
+    void ResizeSegment(ShaderExportSegmentInfo* segment);
+
 private:
     /// Allocate a new stream
     /// \param id the export id
     /// \return stream info
     ShaderExportStreamInfo AllocateStreamInfo(const ShaderExportID& id);
 
+    /// Free a stream
+    /// \param info stream info
+    void FreeStreamInfo(const ShaderExportStreamInfo& info);
+
     /// Allocate a new counter
     /// \return counter info
     ShaderExportSegmentCounterInfo AllocateCounterInfo();
@@ -88,10 +103,19 @@ private:
         ShaderExportID id{0};
         ShaderExportTypeInfo typeInfo;
         uint64_t dataSize{0};
+
+        /// Largest requested size in the current usage window
+        uint64_t peakRequestedSize{0};
+
+        /// Number of reports in the current usage window
+        uint32_t reportCount{0};
     };
 
     std::vector<ExportInfo> exportInfos;
 
+    /// Shared lock for export infos
+    std::mutex mutex;
+
 private:
     ComRef<DeviceAllocator> deviceAllocator{};
 
@@ -100,9 +124,15 @@ private:
     TrivialObjectPool<ShaderExportSegmentCounterInfo> counterPool;
     TrivialObjectPool<ShaderExportStreamInfo> streamPool;
 
-    /// Initial allocation size for all streams
+    /// Initial allocation size for all streams, streams never shrink below this
     uint64_t baseDataSize = 10'000;
 
+    /// Largest allocation size for any stream, limited by the texel buffer views
+    uint64_t maxDataSize{0};
+
+    /// Number of reports before considering shrinking a stream
+    static constexpr uint32_t kShrinkReportWindow = 256;
+
     ShaderExportAllocationMode allocationMode{ShaderExportAllocationMode::GlobalCyclicBufferNoOverwrite};
 
 private:
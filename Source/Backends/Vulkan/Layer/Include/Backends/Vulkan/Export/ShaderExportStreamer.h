@@ -42,6 +42,7 @@
 
 // Std
 #include <mutex>
+#include <atomic>
 
 // Forward declarations
 class ShaderExportDescriptorAllocator;
@@ -79,6 +80,25 @@ public:
     /// \return the segment
     ShaderExportStreamSegment* AllocateSegment();
 
+    /// Acquire the segment for a submission, consecutive submissions may share the same segment
+    /// \param queue the queue state being submitted on
+    /// \param close if true, this is the last submission of the segment and must be patched and enqueued
+    /// \return the segment
+    ShaderExportStreamSegment* AcquireSubmissionSegment(ShaderExportQueueState* queue, bool& close);
+
+    /// Check if the shared segment of a queue was opened before the last frame boundary
+    /// \param queue the queue state
+    /// \return true if stale
+    bool IsSharedSegmentStale(ShaderExportQueueState* queue);
+
+    /// Release the shared segment of a queue, must be patched and enqueued
+    /// \param queue the queue state
+    /// \return nullptr if no segment is shared
+    ShaderExportStreamSegment* ReleaseSharedSegment(ShaderExportQueueState* queue);
+
+    /// Mark a frame boundary, shared segments opened before are closed on their next submission
+    void MarkFrameBoundary();
+
     /// Free a stream state
     /// \param state the state
     void Free(ShaderExportStreamState* state);
@@ -234,4 +254,7 @@ private:
 
     /// Does the device require push state tracking?
     bool requiresPushStateTracking{false};
+
+    /// Current frame, incremented on boundaries
+    std::atomic<uint64_t> frameIndex{0};
 };
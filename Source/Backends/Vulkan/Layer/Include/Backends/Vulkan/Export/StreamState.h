@@ -165,6 +165,16 @@ struct ShaderExportStreamSegment {
     /// Persistent version for the PRM-Table
     PhysicalResourceMappingTablePersistentVersion* prmtPersistentVersion{nullptr};
 
+    /// Patch command buffers and persistent versions of previous submissions sharing this segment
+    std::vector<VkCommandBuffer> sharedPrePatchCommandBuffers;
+    std::vector<PhysicalResourceMappingTablePersistentVersion*> sharedPrmtPersistentVersions;
+
+    /// Number of submissions sharing this segment
+    uint32_t submissionCount{0};
+
+    /// Frame during which this segment was opened
+    uint64_t frameIndex{0};
+
     /// Versioning segmentation point during submission
     VersionSegmentationPoint versionSegPoint{};
 };
@@ -175,4 +185,7 @@ struct ShaderExportQueueState {
 
     /// All submitted segments
     std::vector<ShaderExportStreamSegment*> liveSegments;
+
+    /// Segment shared by consecutive submissions, not yet submitted for readback
+    ShaderExportStreamSegment* sharedSegment{nullptr};
 };
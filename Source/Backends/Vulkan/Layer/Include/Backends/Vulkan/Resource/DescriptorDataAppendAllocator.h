@@ -27,6 +27,7 @@
 #pragma once
 
 // Layer
+#include <Backends/Vulkan/Config.h>
 #include <Backends/Vulkan/Allocation/DeviceAllocator.h>
 #include <Backends/Vulkan/Tables/DeviceDispatchTable.h>
 #include <Backends/Vulkan/Objects/CommandBufferObject.h>
@@ -35,9 +36,11 @@
 
 // Common
 #include <Common/ComRef.h>
+#include <Common/Hash.h>
 
 // Std
 #include <vector>
+#include <unordered_map>
 
 class DescriptorDataAppendAllocator {
 public:
@@ -58,9 +61,17 @@ public:
         // Set mapped
         mapped = static_cast<uint32_t*>(allocator->Map(segmentEntry.allocation.host));
 
+        // Cached segments are only valid for the chunk they were written to
+        ClearSegmentCache();
+
         // Clear mapped data
         std::memset(mapped, 0x0, segmentEntry.width);
 
+        // Directly written device memory, visible on submission
+        if (segmentEntry.allocation.IsShared()) {
+            return;
+        }
+
         // Guard against render passes
         CommandBufferRenderPassScope renderPassScope(table, commandBuffer, renderPass);
 
@@ -103,11 +114,17 @@ public:
     /// \param value value at root offset
     void Set(VkCommandBuffer commandBuffer, uint32_t offset, uint32_t value) {
         if (pendingRoll) {
+            // Identical data does not require a new segment
+            if (IsRedundantWrite(offset, value)) {
+                return;
+            }
+            
             RollChunk(commandBuffer);
         }
 
         ASSERT(offset < mappedSegmentLength, "Out of bounds descriptor segment offset");
         mapped[mappedOffset + offset] = value;
+        shadow[offset] = value;
     }
 
     /// Set a root value
@@ -123,11 +140,17 @@ public:
 
         // Roll! D2! (Never played DnD, sorry)
         if (pendingRoll) {
+            // Identical data does not require a new segment
+            if (IsRedundantWrite(offset, value)) {
+                return;
+            }
+            
             RollChunk(commandBuffer);
         }
 
         ASSERT(offset < mappedSegmentLength, "Chunk allocation failed");
         mapped[mappedOffset + offset] = value;
+        shadow[offset] = value;
     }
     
     /// Manually roll the chunk
@@ -143,6 +166,50 @@ public:
         return !pendingRoll;
     }
 
+    /// Reuse a previously written segment with identical data, must be invoked after a roll
+    /// \return true if the current segment was replaced by a previous one
+    bool DeduplicateSegment() {
+#if DESCRIPTOR_DATA_SEGMENT_CACHE_SIZE
+        ASSERT(!pendingRoll, "Deduplication requires a rolled segment");
+
+        // Hash the segment data
+        std::size_t hash = mappedSegmentLength;
+        for (uint32_t dword : shadow) {
+            CombineHash(hash, dword);
+        }
+
+        // Any previous segment?
+        if (auto it = segmentCache.find(hash); it != segmentCache.end()) {
+            const CachedSegment& cached = it->second;
+
+            // Collisions are possible, validate the data
+            if (cached.length == mappedSegmentLength && !std::memcmp(segmentCacheData.data() + cached.dataOffset, shadow.data(), sizeof(uint32_t) * mappedSegmentLength)) {
+                // The rolled segment is always at the tail, release it
+                tailOffset = mappedOffset;
+
+                // Bind against the previous segment instead, never written to after its commit
+                mappedOffset = cached.offset;
+                return true;
+            }
+
+            // Keep the existing entry
+            return false;
+        }
+
+        // Cache the segment if there's space left
+        if (segmentCache.size() < DESCRIPTOR_DATA_SEGMENT_CACHE_SIZE) {
+            CachedSegment& cached = segmentCache[hash];
+            cached.offset = mappedOffset;
+            cached.length = mappedSegmentLength;
+            cached.dataOffset = segmentCacheData.size();
+            segmentCacheData.insert(segmentCacheData.end(), shadow.begin(), shadow.end());
+        }
+#endif // DESCRIPTOR_DATA_SEGMENT_CACHE_SIZE
+
+        // Not deduplicated
+        return false;
+    }
+
     /// Commit all changes for the GPU
     void Commit() {
         if (!mapped) {
@@ -175,8 +242,11 @@ public:
         // Reset internal state
         mappedOffset = 0;
         mappedSegmentLength = 0;
+        tailOffset = 0;
         chunkSize = 0;
         mapped = nullptr;
+        shadow.clear();
+        ClearSegmentCache();
 
         // Release the segment
         return std::move(segment);
@@ -188,20 +258,29 @@ public:
     }
 
 private:
+    /// Check if a write is redundant against the current segment, only valid on pending rolls
+    /// \param offset current root offset
+    /// \param value value at root offset
+    /// \return true if redundant
+    bool IsRedundantWrite(uint32_t offset, uint32_t value) const {
+        return migrateLastSegment &&
+               pendingRootCount <= mappedSegmentLength &&
+               offset < mappedSegmentLength &&
+               shadow[offset] == value;
+    }
+
     /// Roll the current chunk
     /// \param commandBuffer upload command buffer
     void RollChunk(VkCommandBuffer commandBuffer) {
-        // Advance current offset
-        uint64_t nextMappedOffset = mappedOffset + mappedSegmentLength;
+        // Migrate the last segment if requested, otherwise start from empty data
+        if (migrateLastSegment) {
+            shadow.resize(pendingRootCount, 0u);
+        } else {
+            shadow.assign(pendingRootCount, 0u);
+        }
 
         // Out of memory?
-        if (nextMappedOffset + pendingRootCount >= chunkSize) {
-            // Copy last chunk if migration is requested
-            uint32_t* lastChunkDwords = ALLOCA_ARRAY(uint32_t, mappedSegmentLength);
-            if (migrateLastSegment) {
-                std::memcpy(lastChunkDwords, mapped + mappedOffset, sizeof(uint32_t) * mappedSegmentLength);
-            }
-
+        if (tailOffset + pendingRootCount >= chunkSize) {
             // Growth factor of 1.5
             chunkSize = std::max<size_t>(64'000, static_cast<size_t>(chunkSize * 1.5f));
 
@@ -209,31 +288,28 @@ private:
             chunkSize = std::min<size_t>(chunkSize, maxChunkSize / sizeof(uint32_t));
 
             // Create new chunk
-            uint64_t lastSegmentLength = mappedSegmentLength;
             CreateChunk(commandBuffer);
-
-            // Migrate last segment?
-            if (migrateLastSegment) {
-                size_t count = std::min<size_t>(pendingRootCount, lastSegmentLength);
-                std::memcpy(mapped + nextMappedOffset, lastChunkDwords, sizeof(uint32_t) * count);
-            }
-        } else {
-            // Migrate last segment?
-            if (migrateLastSegment) {
-                size_t count = std::min<size_t>(pendingRootCount, mappedSegmentLength);
-                std::memcpy(mapped + nextMappedOffset, mapped + mappedOffset, sizeof(uint32_t) * count);
-            }
-            
-            // Set new offset
-            mappedOffset = nextMappedOffset;
         }
 
-        // Set next roll length
+        // Allocate from the tail
+        mappedOffset = tailOffset;
         mappedSegmentLength = pendingRootCount;
+        tailOffset += pendingRootCount;
+
+        // Write the full segment, released tail segments may have left stale data
+        std::memcpy(mapped + mappedOffset, shadow.data(), sizeof(uint32_t) * mappedSegmentLength);
+
+        // Rolled
         pendingRoll = false;
         migrateLastSegment = false;
     }
 
+    /// Clear all cached segments
+    void ClearSegmentCache() {
+        segmentCache.clear();
+        segmentCacheData.clear();
+    }
+
     /// Create a new chunk
     /// \param commandBuffer upload command buffer
     void CreateChunk(VkCommandBuffer commandBuffer) {
@@ -245,6 +321,7 @@ private:
         // Reset
         mappedOffset = 0;
         mappedSegmentLength = 0;
+        tailOffset = 0;
 
         // Next entry
         DescriptorDataSegmentEntry segmentEntry;
@@ -261,21 +338,26 @@ private:
             return;
         }
 
-        // Attempt to create the host buffer
-        if (table->next_vkCreateBuffer(table->object, &bufferInfo, nullptr, &segmentEntry.bufferHost) != VK_SUCCESS) {
-            return;
-        }
-
         // Get the requirements
         VkMemoryRequirements requirements;
         table->next_vkGetBufferMemoryRequirements(table->object, segmentEntry.bufferDevice, &requirements);
 
-        // Create the allocation
-        segmentEntry.allocation = allocator->AllocateMirror(requirements);
+        // Create the allocation, written directly if the device memory is host visible
+        segmentEntry.allocation = allocator->AllocateMirror(requirements, AllocationResidency::DeviceHostVisible);
 
-        // Bind against the allocations
+        // Bind against the device allocation
         allocator->BindBuffer(segmentEntry.allocation.device, segmentEntry.bufferDevice);
-        allocator->BindBuffer(segmentEntry.allocation.host, segmentEntry.bufferHost);
+
+        // Staging is only required for non-shared allocations
+        if (!segmentEntry.allocation.IsShared()) {
+            // Attempt to create the host buffer
+            if (table->next_vkCreateBuffer(table->object, &bufferInfo, nullptr, &segmentEntry.bufferHost) != VK_SUCCESS) {
+                return;
+            }
+
+            // Bind against the host allocation
+            allocator->BindBuffer(segmentEntry.allocation.host, segmentEntry.bufferHost);
+        }
 
         // Set as current chunk
         SetChunk(commandBuffer, segmentEntry);
@@ -288,6 +370,9 @@ private:
     /// Current segment length
     size_t mappedSegmentLength{0};
 
+    /// End of all segments written to the current chunk
+    size_t tailOffset{0};
+
     /// Total chunk size
     size_t chunkSize{0};
 
@@ -318,4 +403,25 @@ private:
 
     /// Current mapped address of the segment
     uint32_t* mapped{nullptr};
+
+    /// Host copy of the current segment, avoids reading back from mapped memory
+    std::vector<uint32_t> shadow;
+
+private:
+    struct CachedSegment {
+        /// Offset of the segment in the current chunk
+        size_t offset{0};
+
+        /// Length of the segment
+        size_t length{0};
+
+        /// Offset into the cached data
+        size_t dataOffset{0};
+    };
+
+    /// All committed segments of the current chunk, keyed by data hash
+    std::unordered_map<std::size_t, CachedSegment> segmentCache;
+
+    /// Data of all cached segments
+    std::vector<uint32_t> segmentCacheData;
 };
@@ -243,3 +243,75 @@ static VirtualResourceMapping GetVirtualResourceMapping(DeviceDispatchTable* tab
     return mapping;
 }
 
+
+/// Get the virtual resource mappings of all descriptors written
+///   Equivalent to per descriptor queries, with the type dispatch hoisted out of the descriptor loop
+/// \param table parent table
+/// \param write the write information
+/// \param out destination mappings, length of write.descriptorCount
+static void GetVirtualResourceMappings(DeviceDispatchTable* table, const VkWriteDescriptorSet& write, VirtualResourceMapping* out) {
+    switch (write.descriptorType) {
+        default: {
+            // Buffer null descriptors keep the invalid mapping, defer to the per descriptor query
+            for (uint32_t i = 0; i < write.descriptorCount; i++) {
+                out[i] = GetVirtualResourceMapping(table, write, i);
+            }
+            break;
+        }
+        case VK_DESCRIPTOR_TYPE_SAMPLER:
+        case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+        case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+        case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:  {
+            for (uint32_t i = 0; i < write.descriptorCount; i++) {
+                out[i] = GetVirtualResourceMapping(table, write.descriptorType, write.pImageInfo[i]);
+            }
+            break;
+        }
+    }
+}
+
+/// Get the virtual resource mappings of all descriptors in a template entry
+///   Equivalent to per descriptor queries, with the type dispatch hoisted out of the descriptor loop
+/// \param table parent table
+/// \param descriptorType the descriptor type
+/// \param descriptorData opaque data of the first descriptor, must be for the type
+/// \param stride byte stride between descriptors
+/// \param count number of descriptors
+/// \param out destination mappings, length of count
+static void GetVirtualResourceMappings(DeviceDispatchTable* table, VkDescriptorType descriptorType, const void* descriptorData, size_t stride, uint32_t count, VirtualResourceMapping* out) {
+    auto* data = static_cast<const uint8_t*>(descriptorData);
+
+    switch (descriptorType) {
+        default: {
+            for (uint32_t i = 0; i < count; i++) {
+                out[i] = GetVirtualResourceMapping(table, descriptorType, data + i * stride);
+            }
+            break;
+        }
+        case VK_DESCRIPTOR_TYPE_SAMPLER:
+        case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+        case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+        case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE: {
+            for (uint32_t i = 0; i < count; i++) {
+                out[i] = GetVirtualResourceMapping(table, descriptorType, *reinterpret_cast<const VkDescriptorImageInfo*>(data + i * stride));
+            }
+            break;
+        }
+        case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER: {
+            for (uint32_t i = 0; i < count; i++) {
+                out[i] = GetVirtualResourceMapping(table, descriptorType, *reinterpret_cast<const VkBufferView*>(data + i * stride));
+            }
+            break;
+        }
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC: {
+            for (uint32_t i = 0; i < count; i++) {
+                out[i] = GetVirtualResourceMapping(table, descriptorType, *reinterpret_cast<const VkDescriptorBufferInfo*>(data + i * stride));
+            }
+            break;
+        }
+    }
+}
@@ -84,6 +84,14 @@ public:
     /// \param mapping mapping to write
     void WriteMapping(PhysicalResourceSegmentID id, uint32_t offset, const VirtualResourceMapping& mapping);
 
+    /// Write a contiguous range of mappings at a given offset
+    ///   Resolves the segment and acquires the table once for the entire range
+    /// \param id segment identifier
+    /// \param offset offset of the first mapping within the segment
+    /// \param count number of mappings
+    /// \param mappings all mappings to write, length of count
+    void WriteMappings(PhysicalResourceSegmentID id, uint32_t offset, uint32_t count, const VirtualResourceMapping* mappings);
+
     /// Get an existing mapping within a segment
     /// \param id segment identifier
     /// \param offset offset within the segment
@@ -101,15 +109,43 @@ public:
     /// \param dest destination segment
     void CopyMappings(PhysicalResourceSegmentID source, PhysicalResourceSegmentID dest);
 
+    /// Copy a contiguous range of mappings between segments
+    /// \param source source segment
+    /// \param sourceOffset offset of the first mapping within the source segment
+    /// \param dest destination segment
+    /// \param destOffset offset of the first mapping within the destination segment
+    /// \param count number of mappings
+    void CopyMappings(PhysicalResourceSegmentID source, uint32_t sourceOffset, PhysicalResourceSegmentID dest, uint32_t destOffset, uint32_t count);
+
 private:
     /// Allocate a new table with a given size
     /// \param count number of descriptors
     void AllocateTable(uint32_t count);
 
+    /// Mark a range of mappings as dirty at the current commit head
+    /// \param offset table offset of the first mapping
+    /// \param count number of mappings
+    void MarkDirty(uint32_t offset, uint32_t count);
+
 private:
+    /// Number of mappings per dirty page
+    static constexpr uint32_t kDirtyPageMappingCount = 1024;
+
+    /// Fraction of dirty pages after which the entire table is copied
+    static constexpr float kFullCopyDirtyThreshold = 0.5f;
+
+    /// Maximum number of copy regions before the entire table is copied
+    static constexpr uint32_t kMaxCopyRegions = 64;
+
     /// Table (global) commit head
     size_t commitHead{0};
 
+    /// Commit head at which each page was last written
+    std::vector<size_t> pageCommitHeads;
+
+    /// Cached copy regions
+    std::vector<VkBufferCopy> copyRegions;
+
     /// Number of mappings contained
     uint32_t virtualMappingCount{0};
 
@@ -33,14 +33,13 @@
 
 // Common
 #include <Common/Containers/ReferenceObject.h>
+#include <Common/Containers/PublishedHashMap.h>
 
 // Deep Copy
 #include <Backends/Vulkan/DeepCopyObjects.Gen.h>
 
 // Std
 #include <atomic>
-#include <map>
-#include <mutex>
 
 // Forward declarations
 struct DeviceDispatchTable;
@@ -56,21 +55,16 @@ struct PipelineState : public ReferenceObject {
     /// \param featureBitSet the enabled feature set
     /// \param pipeline the pipeline in question
     void AddInstrument(uint64_t featureBitSet, VkPipeline pipeline) {
-        std::lock_guard lock(mutex);
-        instrumentObjects[featureBitSet] = pipeline;
+        instrumentObjects.Set(featureBitSet, pipeline);
     }
 
     /// Get an instrument
     /// \param featureBitSet the enabled feature set
     /// \return nullptr if not found
     VkPipeline GetInstrument(uint64_t featureBitSet) {
-        std::lock_guard lock(mutex);
-        auto&& it = instrumentObjects.find(featureBitSet);
-        if (it == instrumentObjects.end()) {
-            return nullptr;
-        }
-
-        return it->second;
+        VkPipeline pipeline{VK_NULL_HANDLE};
+        instrumentObjects.Find(featureBitSet, pipeline);
+        return pipeline;
     }
 
     /// Check if there's an instrumentation request
@@ -107,12 +101,9 @@ struct PipelineState : public ReferenceObject {
     /// Shader dependent instrumentation info
     DependentInstrumentationInfo dependentInstrumentationInfo;
 
-    /// Instrumented objects lookup
+    /// Instrumented objects lookup, lock free reads
     /// TODO: How do we manage lifetimes here?
-    std::map<uint64_t, VkPipeline> instrumentObjects;
-
-    /// Module specific lock
-    std::mutex mutex;
+    PublishedHashMap<uint64_t, VkPipeline> instrumentObjects;
 
     /// Unique identifier, unique for the type
     uint64_t uid;
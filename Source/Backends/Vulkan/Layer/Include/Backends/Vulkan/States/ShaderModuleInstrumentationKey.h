@@ -42,6 +42,17 @@ struct ShaderModuleInstrumentationKey {
         return AsTuple() < key.AsTuple();
     }
 
+    bool operator==(const ShaderModuleInstrumentationKey& key) const {
+        return AsTuple() == key.AsTuple();
+    }
+
+    /// Lookup hasher, the combined hash is already well distributed
+    struct Hasher {
+        size_t operator()(const ShaderModuleInstrumentationKey& key) const {
+            return static_cast<size_t>(key.combinedHash ^ key.featureBitSet);
+        }
+    };
+
     /// Number of pipeline layout user bound descriptor sets
     uint32_t pipelineLayoutUserSlots{0};
 
@@ -33,6 +33,7 @@
 
 // Common
 #include <Common/Containers/ReferenceObject.h>
+#include <Common/Containers/PublishedHashMap.h>
 
 // Deep Copy
 #include <Backends/Vulkan/DeepCopyObjects.Gen.h>
@@ -40,7 +41,6 @@
 // Std
 #include <mutex>
 #include <atomic>
-#include <map>
 
 // Forward declarations
 struct DeviceDispatchTable;
@@ -56,9 +56,7 @@ struct ShaderModuleState : public ReferenceObject {
     /// \param module the module in question
     void AddInstrument(const ShaderModuleInstrumentationKey& key, VkShaderModule module) {
         ASSERT(key.featureBitSet, "Invalid instrument addition");
-
-        std::lock_guard lock(mutex);
-        instrumentObjects[key] = module;
+        instrumentObjects.Set(key, module);
     }
 
     /// Get an instrument
@@ -70,13 +68,9 @@ struct ShaderModuleState : public ReferenceObject {
         }
 
         // Instrumented request
-        std::lock_guard lock(mutex);
-        auto&& it = instrumentObjects.find(key);
-        if (it == instrumentObjects.end()) {
-            return nullptr;
-        }
-
-        return it->second;
+        VkShaderModule module{VK_NULL_HANDLE};
+        instrumentObjects.Find(key, module);
+        return module;
     }
 
     /// Check if instrument is present
@@ -86,22 +80,13 @@ struct ShaderModuleState : public ReferenceObject {
         if (!key.featureBitSet) {
             return true; 
         }
-        
-        std::lock_guard lock(mutex);
-        return instrumentObjects.count(key) > 0;
+
+        return instrumentObjects.Contains(key);
     }
 
     bool Reserve(const ShaderModuleInstrumentationKey& key) {
         ASSERT(key.featureBitSet, "Invalid instrument reservation");
-    
-        std::lock_guard lock(mutex);
-        auto&& it = instrumentObjects.find(key);
-        if (it == instrumentObjects.end()) {
-            instrumentObjects[key] = nullptr;
-            return true;
-        }
-
-        return false;
+        return instrumentObjects.TryInsert(key, VK_NULL_HANDLE);
     }
 
     /// User module
@@ -121,9 +106,9 @@ struct ShaderModuleState : public ReferenceObject {
     /// Instrumentation info
     InstrumentationInfo instrumentationInfo;
 
-    /// Instrumented objects lookup
+    /// Instrumented objects lookup, lock free reads
     /// TODO: How do we manage lifetimes here?
-    std::map<ShaderModuleInstrumentationKey, VkShaderModule> instrumentObjects;
+    PublishedHashMap<ShaderModuleInstrumentationKey, VkShaderModule, ShaderModuleInstrumentationKey::Hasher> instrumentObjects;
 
     /// Module specific lock
     std::mutex mutex;
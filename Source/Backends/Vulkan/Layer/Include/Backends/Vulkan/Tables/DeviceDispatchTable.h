@@ -290,7 +290,9 @@ struct DeviceDispatchTable {
 
     /// All features
     std::vector<ComRef<IFeature>> features;
-    std::vector<FeatureHookTable> featureHookTables;
+
+    /// Flattened submission hooks of all features
+    FeatureSubmissionHookTable submissionHookTable;
 
     /// Creation extensions
     std::vector<const char*> enabledLayers;
@@ -26,14 +26,23 @@
 
 #pragma once
 
+// Common
+#include <Common/Assert.h>
+#include <Common/Hash.h>
+
 // Std
 #include <map>
 #include <vector>
 #include <mutex>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <functional>
 
 /// Stores tracked objects with additional states
 ///  Additionally stores a unique identifier per state, as the key type may be recycled
 ///  at any moment.
+///  Handle lookups are lock free, all modifications are serialized.
 template<typename T, typename U>
 struct TrackedObject {
     struct LinearView {
@@ -73,6 +82,15 @@ struct TrackedObject {
         std::vector<U*>& object;
     };
 
+    TrackedObject() {
+        tables.push_back(CreateTable(kMinCapacity));
+        table.store(tables.back().get());
+    }
+
+    /// No copy
+    TrackedObject(const TrackedObject&) = delete;
+    TrackedObject& operator=(const TrackedObject&) = delete;
+
     /// Add a new tracked object
     U* Add(T object, U* state) {
         std::lock_guard<std::mutex> guard(mutex);
@@ -90,32 +108,37 @@ struct TrackedObject {
 
         // Append
         linear.push_back(state);
-        map[object] = state;
+        Insert(object, state);
         uidMap[state->uid] = entry;
         return state;
     }
 
     /// Get a tracked object
     U* Get(T object) {
-        std::lock_guard<std::mutex> guard(mutex);
-        return GetNoLock(object);
+        U* state = TryGet(object);
+        ASSERT(state, "Untracked object");
+        return state;
     }
 
     /// Get a tracked object
     U* TryGet(T object) {
-        std::lock_guard<std::mutex> guard(mutex);
-        return TryGetNoLock(object);
+        ReaderShard& shard = readerShards[GetReaderShardIndex()];
+
+        // Announce the read before acquiring the table, see Reclaim
+        shard.count.fetch_add(1);
+        U* state = Find(table.load(), object);
+        shard.count.fetch_sub(1);
+        return state;
     }
 
-    /// Get a tracked object, not thread safe
+    /// Get a tracked object, lookups never lock
     U* GetNoLock(T object) {
-        return map.at(object);
+        return Get(object);
     }
 
-    /// Get a tracked object, not thread safe
+    /// Get a tracked object, lookups never lock
     U* TryGetNoLock(T object) {
-        auto it = map.find(object);
-        return it != map.end() ? it->second : nullptr;
+        return TryGet(object);
     }
 
     /// Remove an object
@@ -134,8 +157,15 @@ struct TrackedObject {
     void RemoveLogical(T object) {
         std::lock_guard<std::mutex> guard(mutex);
 
-        // Remove from map
-        map.erase(object);
+        // Slots are never cleared, the key remains as a tombstone
+        Table* live = table.load(std::memory_order_relaxed);
+        if (Slot* slot = FindSlot(live, object); slot && slot->state.load(std::memory_order_relaxed)) {
+            slot->state.store(nullptr, std::memory_order_release);
+            liveCount--;
+        }
+
+        // Opportunistically release retired tables
+        Reclaim();
     }
 
     /// Remove an object
@@ -186,11 +216,193 @@ private:
         uint32_t slotRelocation;
     };
 
+    struct Slot {
+        /// Published key, null if the slot was never occupied
+        std::atomic<T> key{};
+
+        /// Current state, null if removed
+        std::atomic<U*> state{nullptr};
+    };
+
+    struct Table {
+        /// Power of two capacity
+        uint32_t capacity{0};
+
+        /// Slot selection shift, see HashSlot
+        uint32_t shift{0};
+
+        /// Number of slots with a key, including tombstones
+        uint32_t occupied{0};
+
+        /// All slots
+        std::unique_ptr<Slot[]> slots;
+    };
+
+    struct alignas(64) ReaderShard {
+        /// Number of readers in flight
+        std::atomic<uint32_t> count{0};
+    };
+
+    /// Create a new table
+    static std::unique_ptr<Table> CreateTable(uint32_t capacity) {
+        auto created = std::make_unique<Table>();
+        created->capacity = capacity;
+        created->shift = HashSlotShift(capacity);
+        created->slots = std::make_unique<Slot[]>(capacity);
+        return created;
+    }
+
+    /// Get the reader shard of the calling thread
+    static uint32_t GetReaderShardIndex() {
+        static thread_local uint32_t index = static_cast<uint32_t>(std::hash<std::thread::id>{}(std::this_thread::get_id()) % kReaderShardCount);
+        return index;
+    }
+
+    /// Find a state
+    U* Find(Table* live, T object) const {
+        if (Slot* slot = FindSlot(live, object)) {
+            return slot->state.load(std::memory_order_acquire);
+        }
+
+        return nullptr;
+    }
+
+    /// Get the first probed slot of a key
+    ///   Handles are commonly aligned addresses with an identity hash, select on the mixed high bits
+    static uint32_t GetSlot(Table* live, T object) {
+        return HashSlot(static_cast<uint64_t>(std::hash<T>{}(object)), live->shift);
+    }
+
+    /// Find the slot of a key
+    static Slot* FindSlot(Table* live, T object) {
+        uint32_t mask = live->capacity - 1;
+
+        // Linear probe until the first empty slot
+        for (uint32_t index = GetSlot(live, object);; index = (index + 1) & mask) {
+            Slot& slot = live->slots[index];
+
+            T key = slot.key.load(std::memory_order_acquire);
+            if (key == T{}) {
+                return nullptr;
+            }
+
+            if (key == object) {
+                return &slot;
+            }
+        }
+    }
+
+    /// Place a new key, table must have space
+    static void Place(Table* live, T object, U* state) {
+        uint32_t mask = live->capacity - 1;
+
+        // Find the first empty slot
+        uint32_t index = GetSlot(live, object);
+        while (live->slots[index].key.load(std::memory_order_relaxed) != T{}) {
+            index = (index + 1) & mask;
+        }
+
+        // State must be visible before the key
+        Slot& slot = live->slots[index];
+        slot.state.store(state, std::memory_order_relaxed);
+        slot.key.store(object, std::memory_order_release);
+        live->occupied++;
+    }
+
+    /// Insert or revive a key, writer lock must be held
+    void Insert(T object, U* state) {
+        ASSERT(object != T{}, "Tracking null object");
+
+        Table* live = table.load(std::memory_order_relaxed);
+
+        // Recycled handle, revive the tombstone
+        if (Slot* slot = FindSlot(live, object)) {
+            if (!slot->state.load(std::memory_order_relaxed)) {
+                liveCount++;
+            }
+
+            slot->state.store(state, std::memory_order_release);
+            return;
+        }
+
+        // Keep the load factor, including tombstones, at or below one half
+        if ((live->occupied + 1) * 2 > live->capacity) {
+            live = Rehash();
+        }
+
+        Place(live, object, state);
+        liveCount++;
+    }
+
+    /// Rehash all live keys into a new table, dropping tombstones
+    Table* Rehash() {
+        Table* previous = table.load(std::memory_order_relaxed);
+
+        // Size for the live keys with room to grow
+        uint32_t capacity = kMinCapacity;
+        while (capacity < (liveCount + 1) * 4) {
+            capacity *= 2;
+        }
+
+        std::unique_ptr<Table> next = CreateTable(capacity);
+        for (uint32_t i = 0; i < previous->capacity; i++) {
+            const Slot& slot = previous->slots[i];
+            if (U* state = slot.state.load(std::memory_order_relaxed)) {
+                Place(next.get(), slot.key.load(std::memory_order_relaxed), state);
+            }
+        }
+
+        // Publish, readers may still be on the previous table
+        Table* published = next.get();
+        table.store(published);
+        tables.push_back(std::move(next));
+
+        // Try to release now
+        Reclaim();
+        return published;
+    }
+
+    /// Release retired tables if no reader is in flight, writer lock must be held
+    void Reclaim() {
+        if (tables.size() == 1) {
+            return;
+        }
+
+        // Readers announce themselves before acquiring the table, so once all shards are observed
+        // idle any subsequent reader is guaranteed to see the live table
+        for (const ReaderShard& shard : readerShards) {
+            if (shard.count.load()) {
+                return;
+            }
+        }
+
+        // Keep the live table only
+        tables.erase(tables.begin(), tables.end() - 1);
+    }
+
+private:
+    /// Initial number of slots
+    static constexpr uint32_t kMinCapacity = 64;
+
+    /// Number of reader shards, spreads the reader announcements across cache lines
+    static constexpr uint32_t kReaderShardCount = 16;
+
     /// Separate uid counter
     uint64_t uidCounter{0};
 
+    /// Lock free handle lookup
+    std::atomic<Table*> table{nullptr};
+
+    /// All tables, the last one is live and the rest are retired
+    std::vector<std::unique_ptr<Table>> tables;
+
+    /// Number of live keys
+    uint32_t liveCount{0};
+
+    /// Reader announcements
+    ReaderShard readerShards[kReaderShardCount];
+
     /// Lookup
-    std::map<T, U*>  map;
     std::map<uint64_t, MapEntry> uidMap;
 
     /// Linear traversal
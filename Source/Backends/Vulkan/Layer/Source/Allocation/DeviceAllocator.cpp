@@ -67,6 +67,29 @@ void DeviceAllocator::Install(DeviceDispatchTable *table) {
     allocatorInfo.device = table->object;
     allocatorInfo.pVulkanFunctions = &vkFunctions;
     vmaCreateAllocator(&allocatorInfo, &allocator);
+
+    // Check for direct host writes
+    DetectResizableBAR(table);
+}
+
+void DeviceAllocator::DetectResizableBAR(DeviceDispatchTable *table) {
+    // Without resizable BAR, host visible device memory is limited to a small window
+    constexpr VkDeviceSize kLegacyWindowSize = 256ull * 1024 * 1024;
+
+    // Required flags for direct writes
+    constexpr VkMemoryPropertyFlags kFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+
+    // Get memory properties
+    VkPhysicalDeviceMemoryProperties properties;
+    table->parent->next_vkGetPhysicalDeviceMemoryProperties(table->physicalDevice, &properties);
+
+    // Any host visible device type backed by a large heap?
+    for (uint32_t i = 0; i < properties.memoryTypeCount; i++) {
+        const VkMemoryType& type = properties.memoryTypes[i];
+        if ((type.propertyFlags & kFlags) == kFlags && properties.memoryHeaps[type.heapIndex].size > kLegacyWindowSize) {
+            resizableBAR = true;
+        }
+    }
 }
 
 Allocation DeviceAllocator::Allocate(const VkMemoryRequirements& requirements, AllocationResidency residency) {
@@ -88,6 +111,17 @@ Allocation DeviceAllocator::Allocate(const VkMemoryRequirements& requirements, A
             createInfo.requiredFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
             createInfo.flags = VMA_ALLOCATION_CREATE_MAPPED_BIT;
             break;
+        case AllocationResidency::DeviceHostVisible:
+            // Not worth competing for the legacy window
+            if (!resizableBAR) {
+                return {};
+            }
+
+            // Coherent, avoids flushes on every host write
+            createInfo.usage = VMA_MEMORY_USAGE_UNKNOWN;
+            createInfo.requiredFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+            createInfo.flags = VMA_ALLOCATION_CREATE_MAPPED_BIT;
+            break;
     }
 
     // Attempt to allocate the memory
@@ -113,6 +147,16 @@ MirrorAllocation DeviceAllocator::AllocateMirror(const VkMemoryRequirements& req
             break;
         case AllocationResidency::HostVisible:
             allocation.device = Allocate(requirements, AllocationResidency::HostVisible);
+            allocation.host = allocation.device;
+            break;
+        case AllocationResidency::DeviceHostVisible:
+            allocation.device = Allocate(requirements, AllocationResidency::DeviceHostVisible);
+
+            // Fall back to a regular mirror if the memory is unavailable or exhausted
+            if (!allocation.device.allocation) {
+                return AllocateMirror(requirements, AllocationResidency::Device);
+            }
+
             allocation.host = allocation.device;
             break;
     }
@@ -148,6 +192,11 @@ void *DeviceAllocator::Map(const Allocation &allocation) {
 }
 
 void DeviceAllocator::Unmap(const Allocation &allocation) {
+    // Persistently mapped allocations are never unmapped
+    if (allocation.info.pMappedData) {
+        return;
+    }
+
     vmaUnmapMemory(allocator, allocation.allocation);
 }
 
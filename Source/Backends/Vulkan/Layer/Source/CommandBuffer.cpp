@@ -49,8 +49,8 @@ void CreateDeviceCommandProxies(DeviceDispatchTable *table) {
         // Get the hook table
         FeatureHookTable hookTable = feature->GetHookTable();
 
-        // Append
-        table->featureHookTables.push_back(hookTable);
+        // Append all valid submission hooks
+        table->submissionHookTable.Add(hookTable);
 
         /** Create all relevant proxies */
 
@@ -226,9 +226,7 @@ VKAPI_ATTR VkResult VKAPI_CALL Hook_vkBeginCommandBuffer(CommandBufferObject *co
     commandBuffer->streamState->commandContextHandle = commandBuffer->userContext.handle;
 
     // Invoke proxies
-    for (const FeatureHookTable &table: commandBuffer->table->featureHookTables) {
-        table.open.TryInvoke(&commandBuffer->userContext);
-    }
+    FeatureSubmissionHookTable::Invoke(commandBuffer->table->submissionHookTable.open, &commandBuffer->userContext);
 
     // OK
     return VK_SUCCESS;
@@ -631,9 +629,7 @@ VKAPI_ATTR VkResult VKAPI_CALL Hook_vkEndCommandBuffer(CommandBufferObject *comm
     commandBuffer->table->exportStreamer->EndCommandBuffer(commandBuffer->streamState, commandBuffer->object);
 
     // Invoke proxies
-    for (const FeatureHookTable &table: commandBuffer->table->featureHookTables) {
-        table.close.TryInvoke(commandBuffer->userContext.handle);
-    }
+    FeatureSubmissionHookTable::Invoke(commandBuffer->table->submissionHookTable.close, commandBuffer->userContext.handle);
 
     // Pass down callchain
     return commandBuffer->table->next_vkEndCommandBuffer(commandBuffer->object);
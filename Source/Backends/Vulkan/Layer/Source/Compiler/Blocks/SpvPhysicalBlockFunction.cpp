@@ -1685,6 +1685,30 @@ bool SpvPhysicalBlockFunction::CompileBasicBlock(const SpvJob& job, SpvIdMap &id
                 table.shaderExport.Export(stream, _export->exportID, values, _export->values.count);
                 break;
             }
+            case IL::OpCode::Call: {
+                auto *call = instr.As<IL::CallInstruction>();
+
+                SpvInstruction& spv = stream.TemplateOrAllocate(SpvOpFunctionCall, 4 + call->arguments.count, call->source);
+                spv[1] = table.typeConstantVariable.typeMap.GetSpvTypeId(resultType);
+                spv[2] = call->result;
+                spv[3] = call->target;
+
+                for (uint32_t i = 0; i < call->arguments.count; i++) {
+                    spv[4 + i] = idMap.Get(call->arguments[i]);
+                }
+                break;
+            }
+            case IL::OpCode::Return: {
+                auto *ret = instr.As<IL::ReturnInstruction>();
+
+                if (ret->value == IL::InvalidID) {
+                    stream.TemplateOrAllocate(SpvOpReturn, 1, ret->source);
+                } else {
+                    SpvInstruction& spv = stream.TemplateOrAllocate(SpvOpReturnValue, 2, ret->source);
+                    spv[1] = idMap.Get(ret->value);
+                }
+                break;
+            }
             case IL::OpCode::ResourceToken: {
                 auto *token = instr.As<IL::ResourceTokenInstruction>();
                 table.shaderPRMT.GetToken(job, stream, idMap.Get(token->resource), token->result);
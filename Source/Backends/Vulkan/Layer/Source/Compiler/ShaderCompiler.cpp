@@ -31,6 +31,7 @@
 #include <Backends/Vulkan/Export/ShaderExportDescriptorAllocator.h>
 #include <Backends/Vulkan/ShaderData/ShaderDataHost.h>
 #include <Backends/Vulkan/Compiler/Diagnostic/DiagnosticType.h>
+#include <Backends/Vulkan/Config.h>
 
 // Backend
 #include <Backend/IFeatureHost.h>
@@ -38,6 +39,8 @@
 #include <Backend/IShaderFeature.h>
 #include <Backend/IShaderExportHost.h>
 #include <Backend/IL/PrettyPrint.h>
+#include <Backend/IL/InstrumentationOptimizer.h>
+#include <Backend/IL/ExportOutliner.h>
 #include <Backend/Diagnostic/DiagnosticBucketScope.h>
 
 // Common
@@ -126,11 +129,37 @@ bool ShaderCompiler::InitializeModule(ShaderModuleState *state) {
 
 void ShaderCompiler::Worker(void *data) {
     auto *job = static_cast<ShaderJobEntry *>(data);
-    CompileShader(*job);
+
+    // Small modules are not allocation heavy, compile with the shared allocators
+    if (job->info.state->createInfoDeepCopy.createInfo.codeSize < SHADER_COMPILER_ARENA_MIN_CODE_SIZE) {
+        CompileShader(*job, allocators);
+        destroy(job, allocators);
+        return;
+    }
+
+    // Get a free arena for the job
+    ArenaAllocator* arena;
+    {
+        std::lock_guard guard(arenaMutex);
+        arena = arenaPool.Pop(allocators);
+    }
+
+    // Compile with job local allocations
+    CompileShader(*job, arena->GetAllocators());
+
+    // Release all job allocations at once, keeps the chunks for the next job
+    arena->Reset();
+
+    // Return the arena
+    {
+        std::lock_guard guard(arenaMutex);
+        arenaPool.Push(arena);
+    }
+    
     destroy(job, allocators);
 }
 
-void ShaderCompiler::CompileShader(const ShaderJobEntry &job) {
+void ShaderCompiler::CompileShader(const ShaderJobEntry &job, const Allocators& jobAllocators) {
 #if SHADER_COMPILER_SERIAL
     static std::mutex mutex;
     std::lock_guard guard(mutex);
@@ -176,7 +205,7 @@ void ShaderCompiler::CompileShader(const ShaderJobEntry &job) {
     }
 
     // Create a copy of the module, don't modify the source
-    SpvModule *module = job.info.state->spirvModule->Copy();
+    SpvModule *module = job.info.state->spirvModule->Copy(jobAllocators);
 
     // Get user map
     IL::ShaderDataMap& shaderDataMap = module->GetProgram()->GetShaderDataMap();
@@ -196,11 +225,26 @@ void ShaderCompiler::CompileShader(const ShaderJobEntry &job) {
         shaderFeatures[i]->Inject(*module->GetProgram(), *job.info.dependentSpecialization);
     }
 
+#if SHADER_COMPILER_OPTIMIZE_INSTRUMENTATION
+    // Clean up the injected instrumentation
+    if (job.info.instrumentationKey.featureBitSet) {
+        IL::InstrumentationOptimizer(*module->GetProgram()).Optimize();
+    }
+#endif // SHADER_COMPILER_OPTIMIZE_INSTRUMENTATION
+
+#if SHADER_COMPILER_OUTLINE_EXPORTS
+    // Share export sequences between instrumentation sites
+    if (job.info.instrumentationKey.featureBitSet) {
+        IL::ExportOutliner(*module->GetProgram()).Outline();
+    }
+#endif // SHADER_COMPILER_OUTLINE_EXPORTS
+
     // Spv job
     SpvJob spvJob;
     spvJob.instrumentationKey = job.info.instrumentationKey;
     spvJob.bindingInfo = shaderExportDescriptorAllocator->GetBindingInfo();
     spvJob.messages = scope;
+    spvJob.diagnostic = job.info.diagnostic;
 
     // Recompile the program
     if (!module->Recompile(
@@ -210,6 +254,7 @@ void ShaderCompiler::CompileShader(const ShaderJobEntry &job) {
     )) {
         scope.Add(DiagnosticType::ShaderInternalCompilerError);
         ++job.info.diagnostic->failedJobs;
+        destroy(module, jobAllocators);
         return;
     }
 
@@ -241,6 +286,7 @@ void ShaderCompiler::CompileShader(const ShaderJobEntry &job) {
     if (result != VK_SUCCESS) {
         scope.Add(DiagnosticType::ShaderCreationFailed);
         ++job.info.diagnostic->failedJobs;
+        destroy(module, jobAllocators);
         return;
     }
 
@@ -251,5 +297,6 @@ void ShaderCompiler::CompileShader(const ShaderJobEntry &job) {
     ++job.info.diagnostic->passedJobs;
 
     // Destroy the module
-    destroy(module, allocators);
+    //  Memory itself is released with the job arena, this releases any non-arena state
+    destroy(module, jobAllocators);
 }
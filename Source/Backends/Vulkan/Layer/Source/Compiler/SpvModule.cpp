@@ -44,15 +44,19 @@ SpvModule::~SpvModule() {
 }
 
 SpvModule *SpvModule::Copy() const {
-    auto *module = new(allocators) SpvModule(allocators, shaderGUID, instrumentationGUID);
+    return Copy(allocators);
+}
+
+SpvModule *SpvModule::Copy(const Allocators& copyAllocators) const {
+    auto *module = new(copyAllocators) SpvModule(copyAllocators, shaderGUID, instrumentationGUID);
     module->spirvProgram = spirvProgram;
     module->parent = this;
 
     // Copy program
-    module->program = program->Copy();
+    module->program = program->Copy(copyAllocators);
 
     // Create physical block table
-    module->physicalBlockTable = new(allocators) SpvPhysicalBlockTable(allocators, *module->program);
+    module->physicalBlockTable = new(copyAllocators) SpvPhysicalBlockTable(copyAllocators, *module->program);
     {
         physicalBlockTable->CopyTo(*module->physicalBlockTable);
     }
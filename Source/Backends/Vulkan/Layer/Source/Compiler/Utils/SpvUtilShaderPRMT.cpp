@@ -27,6 +27,7 @@
 #include <Backends/Vulkan/Compiler/Utils/SpvUtilShaderPRMT.h>
 #include <Backends/Vulkan/Compiler/SpvPhysicalBlockTable.h>
 #include <Backends/Vulkan/Compiler/SpvJob.h>
+#include <Backends/Vulkan/Compiler/Diagnostic/ShaderCompilerDiagnostic.h>
 #include <Backends/Vulkan/Resource/DescriptorData.h>
 
 // Backend
@@ -134,6 +135,9 @@ SpvUtilShaderPRMT::SpvPRMTOffset SpvUtilShaderPRMT::GetResourcePRMTOffset(const
         spv[2] = out.outOfBounds;
         spv[3] = valueDecoration.dynamicOffset;
         spv[4] = baseLengthId;
+    } else if (valueDecoration.provenInBounds && job.diagnostic) {
+        // Check was elided by range analysis
+        ++job.diagnostic->elidedChecks;
     }
 
     // Validate table binding
@@ -320,8 +324,12 @@ SpvUtilShaderPRMT::DynamicSpvValueDecoration SpvUtilShaderPRMT::GetSourceResourc
             // Get base decoration
             DynamicSpvValueDecoration dynamic = GetSourceResourceDecoration(job, stream, addressChain->composite);
 
-            // Address could be constant, but easier to just assume dynamic indexing at this point
-            dynamic.checkOutOfBounds = true;
+            // Indices proven to be within the binding never require bounds checking
+            if (IsProvenInBounds(job, dynamic.source, addressChain->chains[0].index)) {
+                dynamic.provenInBounds = true;
+            } else {
+                dynamic.checkOutOfBounds = true;
+            }
 
             // Allocate id
             IL::ID offsetId = table.scan.header.bound++;
@@ -345,6 +353,28 @@ SpvUtilShaderPRMT::DynamicSpvValueDecoration SpvUtilShaderPRMT::GetSourceResourc
     }
 }
 
+bool SpvUtilShaderPRMT::IsProvenInBounds(const SpvJob &job, const SpvValueDecoration &source, IL::ID index) {
+    // Get the sets physical mapping
+    const DescriptorLayoutPhysicalMapping& descriptorSetPhysicalMapping = job.instrumentationKey.physicalMapping->descriptorSets.at(source.descriptorSet);
+
+    // Get the binding
+    const BindingPhysicalMapping& binding = descriptorSetPhysicalMapping.bindings.at(source.descriptorOffset);
+
+    // Variable counts are only known at allocation
+    if (!binding.bindingCount || (binding.flags & VK_DESCRIPTOR_BINDING_VARIABLE_DESCRIPTOR_COUNT_BIT_EXT)) {
+        return false;
+    }
+
+    // Lazily analyze the program, the program is immutable at this point
+    if (!valueRangeAnalysis) {
+        valueRangeAnalysis.emplace(program);
+        valueRangeAnalysis->Compute();
+    }
+
+    // Must be within [0, count)
+    return valueRangeAnalysis->IsWithin(index, 0, static_cast<int64_t>(binding.bindingCount) - 1);
+}
+
 void SpvUtilShaderPRMT::CopyTo(SpvPhysicalBlockTable &remote, SpvUtilShaderPRMT &out) {
     out.prmTableId = prmTableId;
     out.buffer32UI = buffer32UI;
@@ -1032,6 +1032,7 @@ void InstrumentationController::CommitTable(DispatcherBucket* bucket, void *data
         message->messages.Set(diagnosticStream);
         message->passedShaders = static_cast<uint32_t>(batch->shaderCompilerDiagnostic.passedJobs.load());
         message->failedShaders = static_cast<uint32_t>(batch->shaderCompilerDiagnostic.failedJobs.load());
+        message->elidedChecks = static_cast<uint32_t>(batch->shaderCompilerDiagnostic.elidedChecks.load());
         message->passedPipelines = static_cast<uint32_t>(batch->pipelineCompilerDiagnostic.passedJobs.load());
         message->failedPipelines = static_cast<uint32_t>(batch->pipelineCompilerDiagnostic.failedJobs.load());
         message->millisecondsShaders = msShaders;
@@ -47,6 +47,7 @@
 
 // Common
 #include <Common/Hash.h>
+#include <Common/Containers/TrivialStackVector.h>
 
 VKAPI_ATTR VkResult VKAPI_PTR Hook_vkCreateDescriptorSetLayout(VkDevice device, const VkDescriptorSetLayoutCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorSetLayout* pSetLayout) {
     DeviceDispatchTable *table = DeviceDispatchTable::Get(GetInternalTable(device));
@@ -350,6 +351,9 @@ VKAPI_ATTR void VKAPI_CALL Hook_vkDestroyDescriptorPool(VkDevice device, VkDescr
 VKAPI_ATTR void VKAPI_CALL Hook_vkUpdateDescriptorSets(VkDevice device, uint32_t descriptorWriteCount, const VkWriteDescriptorSet* pDescriptorWrites, uint32_t descriptorCopyCount, const VkCopyDescriptorSet* pDescriptorCopies) {
     DeviceDispatchTable *table = DeviceDispatchTable::Get(GetInternalTable(device));
 
+    // Shared mapping storage
+    TrivialStackVector<VirtualResourceMapping, 64u> mappings;
+
     // Create PRM associations from writes
     for (uint32_t i = 0; i < descriptorWriteCount; i++) {
         const VkWriteDescriptorSet& write = pDescriptorWrites[i];
@@ -358,16 +362,14 @@ VKAPI_ATTR void VKAPI_CALL Hook_vkUpdateDescriptorSets(VkDevice device, uint32_t
         const DescriptorSetState* state = table->states_descriptorSet.Get(write.dstSet);
 
         // Create mappings for all descriptors written
-        for (uint32_t descriptorIndex = 0; descriptorIndex < write.descriptorCount; descriptorIndex++) {
-            // Default invalid mapping
-            VirtualResourceMapping mapping = GetVirtualResourceMapping(table, write, descriptorIndex);
-            
-            // Map current binding to an offset
-            const uint32_t prmtOffset = state->prmtOffsets.at(write.dstBinding);
+        mappings.Resize(write.descriptorCount);
+        GetVirtualResourceMappings(table, write, mappings.Data());
 
-            // Update the table
-            table->prmTable->WriteMapping(state->segmentID, prmtOffset + write.dstArrayElement + descriptorIndex, mapping);
-        }
+        // Map current binding to an offset
+        const uint32_t prmtOffset = state->prmtOffsets.at(write.dstBinding);
+
+        // Update the table, consecutive bindings are contiguous in the segment
+        table->prmTable->WriteMappings(state->segmentID, prmtOffset + write.dstArrayElement, write.descriptorCount, mappings.Data());
     }
 
     // Create PRM associations from copies
@@ -382,14 +384,12 @@ VKAPI_ATTR void VKAPI_CALL Hook_vkUpdateDescriptorSets(VkDevice device, uint32_t
         const uint32_t srcPrmtOffset = stateSrc->prmtOffsets.at(copy.srcBinding);
         const uint32_t dstPrmtOffset = stateDst->prmtOffsets.at(copy.dstBinding);
 
-        // Create mappings for all descriptors copied
-        for (uint32_t descriptorIndex = 0; descriptorIndex < copy.descriptorCount; descriptorIndex++) {
-            // Get the original mapping
-            VirtualResourceMapping srcMapping = table->prmTable->GetMapping(stateSrc->segmentID, srcPrmtOffset + copy.srcArrayElement + descriptorIndex);
-
-            // Write as new mapping
-            table->prmTable->WriteMapping(stateDst->segmentID, dstPrmtOffset + copy.dstArrayElement + descriptorIndex, srcMapping);
-        }
+        // Copy the mappings of all descriptors
+        table->prmTable->CopyMappings(
+            stateSrc->segmentID, srcPrmtOffset + copy.srcArrayElement,
+            stateDst->segmentID, dstPrmtOffset + copy.dstArrayElement,
+            copy.descriptorCount
+        );
     }
 
     // Pass down callchain
@@ -450,23 +450,22 @@ VKAPI_ATTR void VKAPI_PTR Hook_vkUpdateDescriptorSetWithTemplate(VkDevice device
     const DescriptorUpdateTemplateState* templateState = table->states_descriptorUpdateTemplateState.Get(descriptorUpdateTemplate);
     const DescriptorSetState*            setState      = table->states_descriptorSet.Get(descriptorSet);
 
+    // Shared mapping storage
+    TrivialStackVector<VirtualResourceMapping, 64u> mappings;
+
     // Handle each entry
     for (uint32_t i = 0; i < templateState->createInfo->descriptorUpdateEntryCount; i++) {
         const VkDescriptorUpdateTemplateEntry& entry = templateState->createInfo->pDescriptorUpdateEntries[i];
 
-        // Handle each binding write
-        for (uint32_t descriptorIndex = 0; descriptorIndex < entry.descriptorCount; descriptorIndex++) {
-            const void *descriptorData = static_cast<const uint8_t*>(pData) + entry.offset + descriptorIndex * entry.stride;
+        // Get mappings of all binding writes
+        mappings.Resize(entry.descriptorCount);
+        GetVirtualResourceMappings(table, entry.descriptorType, static_cast<const uint8_t*>(pData) + entry.offset, entry.stride, entry.descriptorCount, mappings.Data());
 
-            // Get mapping
-            VirtualResourceMapping mapping = GetVirtualResourceMapping(table, entry.descriptorType, descriptorData);
+        // Map current binding to an offset
+        const uint32_t prmtOffset = setState->prmtOffsets.at(entry.dstBinding);
 
-            // Map current binding to an offset
-            const uint32_t prmtOffset = setState->prmtOffsets.at(entry.dstBinding);
-
-            // Update the table
-            table->prmTable->WriteMapping(setState->segmentID, prmtOffset + entry.dstArrayElement + descriptorIndex, mapping);
-        }
+        // Update the table
+        table->prmTable->WriteMappings(setState->segmentID, prmtOffset + entry.dstArrayElement, entry.descriptorCount, mappings.Data());
     }
 }
 
@@ -59,6 +59,9 @@ bool ShaderExportStreamAllocator::Install() {
     std::vector<ShaderExportID> exportIDs(exportCount);
     host->Enumerate(&exportCount, exportIDs.data());
 
+    // Streams are viewed as R32 texel buffers
+    maxDataSize = static_cast<uint64_t>(table->physicalDeviceProperties.limits.maxTexelBufferElements) * sizeof(uint32_t);
+
     // Allocate features
     exportInfos.resize(host->GetBound());
 
@@ -77,9 +80,7 @@ ShaderExportStreamAllocator::~ShaderExportStreamAllocator() {
     for (ShaderExportSegmentInfo* segment : segmentPool) {
         // Release streams
         for (const ShaderExportStreamInfo& stream : segment->streams) {
-            table->next_vkDestroyBufferView(table->object, stream.view, nullptr);
-            table->next_vkDestroyBuffer(table->object, stream.buffer, nullptr);
-            deviceAllocator->Free(stream.allocation);
+            FreeStreamInfo(stream);
         }
 
         // Release counter
@@ -93,6 +94,7 @@ ShaderExportStreamAllocator::~ShaderExportStreamAllocator() {
 ShaderExportSegmentInfo *ShaderExportStreamAllocator::AllocateSegment() {
     // Try existing allocation
     if (ShaderExportSegmentInfo* segment = segmentPool.TryPop()) {
+        ResizeSegment(segment);
         return segment;
     }
 
@@ -106,6 +108,7 @@ ShaderExportSegmentInfo *ShaderExportStreamAllocator::AllocateSegment() {
     segment->streams.resize(exportInfos.size());
 
     // Allocate all streams
+    std::lock_guard guard(mutex);
     for (const ExportInfo& exportInfo : exportInfos) {
         segment->streams[exportInfo.id] = AllocateStreamInfo(exportInfo.id);
     }
@@ -123,7 +126,53 @@ void ShaderExportStreamAllocator::FreeSegment(ShaderExportSegmentInfo *segment)
 }
 
 void ShaderExportStreamAllocator::SetStreamSize(ShaderExportID id, uint64_t size) {
+    std::lock_guard guard(mutex);
+    exportInfos[id].dataSize = std::clamp(size, baseDataSize, maxDataSize);
+}
+
+void ShaderExportStreamAllocator::ReportStreamUsage(ShaderExportID id, uint64_t requestedByteSize) {
+    std::lock_guard guard(mutex);
+    ExportInfo& exportInfo = exportInfos[id];
+
+    // Track the peak of the current window
+    exportInfo.peakRequestedSize = std::max(exportInfo.peakRequestedSize, requestedByteSize);
+
+    // Overflown? Grow immediately, with headroom to avoid successive growths
+    if (requestedByteSize > exportInfo.dataSize) {
+        exportInfo.dataSize = std::min(std::max(requestedByteSize + requestedByteSize / 2, exportInfo.dataSize * 2), maxDataSize);
+        exportInfo.peakRequestedSize = 0;
+        exportInfo.reportCount = 0;
+        return;
+    }
+
+    // Wait for a full window before shrinking
+    if (++exportInfo.reportCount < kShrinkReportWindow) {
+        return;
+    }
 
+    // Largely unused? Shrink to twice the observed peak
+    if (exportInfo.peakRequestedSize * 4 < exportInfo.dataSize) {
+        exportInfo.dataSize = std::max(exportInfo.peakRequestedSize * 2, baseDataSize);
+    }
+
+    // Next window
+    exportInfo.peakRequestedSize = 0;
+    exportInfo.reportCount = 0;
+}
+
+void ShaderExportStreamAllocator::ResizeSegment(ShaderExportSegmentInfo *segment) {
+    std::lock_guard guard(mutex);
+
+    // Reallocate all streams whose size has changed
+    for (const ExportInfo& exportInfo : exportInfos) {
+        ShaderExportStreamInfo& info = segment->streams[exportInfo.id];
+        if (info.byteSize == exportInfo.dataSize) {
+            continue;
+        }
+
+        FreeStreamInfo(info);
+        info = AllocateStreamInfo(exportInfo.id);
+    }
 }
 
 ShaderExportSegmentCounterInfo ShaderExportStreamAllocator::AllocateCounterInfo() {
@@ -147,21 +196,26 @@ ShaderExportSegmentCounterInfo ShaderExportStreamAllocator::AllocateCounterInfo(
         return {};
     }
 
-    // Attempt to create the host buffer
-    if (table->next_vkCreateBuffer(table->object, &bufferInfo, nullptr, &info.bufferHost) != VK_SUCCESS) {
-        return {};
-    }
-
     // Get the requirements
     VkMemoryRequirements requirements;
     table->next_vkGetBufferMemoryRequirements(table->object, info.buffer, &requirements);
 
-    // Create the allocation
-    info.allocation = deviceAllocator->AllocateMirror(requirements);
+    // Create the allocation, read directly if the device memory is host visible
+    info.allocation = deviceAllocator->AllocateMirror(requirements, AllocationResidency::DeviceHostVisible);
 
-    // Bind against the allocations
+    // Bind against the device allocation
     deviceAllocator->BindBuffer(info.allocation.device, info.buffer);
-    deviceAllocator->BindBuffer(info.allocation.host, info.bufferHost);
+
+    // Readback is only required for non-shared allocations
+    if (!info.allocation.IsShared()) {
+        // Attempt to create the host buffer
+        if (table->next_vkCreateBuffer(table->object, &bufferInfo, nullptr, &info.bufferHost) != VK_SUCCESS) {
+            return {};
+        }
+
+        // Bind against the host allocation
+        deviceAllocator->BindBuffer(info.allocation.host, info.bufferHost);
+    }
 
     // View creation info
     VkBufferViewCreateInfo viewInfo{VK_STRUCTURE_TYPE_BUFFER_VIEW_CREATE_INFO};
@@ -182,10 +236,15 @@ ShaderExportStreamInfo ShaderExportStreamAllocator::AllocateStreamInfo(const Sha
     // Get the export info
     ExportInfo& exportInfo = exportInfos[id];
 
-    // Attempt to re-use an existing allocation
+    // Attempt to re-use an existing allocation of the same size
     ShaderExportStreamInfo info{};
     if (streamPool.TryPop(info)) {
-        return info;
+        if (info.byteSize == exportInfo.dataSize) {
+            return info;
+        }
+
+        FreeStreamInfo(info);
+        info = {};
     }
 
     // Inherit type info
@@ -231,3 +290,9 @@ ShaderExportStreamInfo ShaderExportStreamAllocator::AllocateStreamInfo(const Sha
     // OK
     return info;
 }
+
+void ShaderExportStreamAllocator::FreeStreamInfo(const ShaderExportStreamInfo &info) {
+    table->next_vkDestroyBufferView(table->object, info.view, nullptr);
+    table->next_vkDestroyBuffer(table->object, info.buffer, nullptr);
+    deviceAllocator->Free(info.allocation);
+}
@@ -52,6 +52,9 @@
 #include <Message/IMessageStorage.h>
 #include <Message/MessageStream.h>
 
+// Schemas
+#include <Schemas/Diagnostic.h>
+
 // Common
 #include <Common/Registry.h>
 #include <Backends/Vulkan/Translation.h>
@@ -84,6 +87,11 @@ ShaderExportStreamer::~ShaderExportStreamer() {
         for (ShaderExportStreamSegment* segment : queue->liveSegments) {
             FreeSegmentNoQueueLock(queue, segment);
         }
+
+        // Unsubmitted shared segments still hold the data of all previous submissions
+        if (ShaderExportStreamSegment* segment = ReleaseSharedSegment(queue)) {
+            FreeSegmentNoQueueLock(queue, segment);
+        }
     }
 
     // Free all segments
@@ -164,8 +172,9 @@ void ShaderExportStreamer::Free(ShaderExportQueueState *state) {
 ShaderExportStreamSegment *ShaderExportStreamer::AllocateSegment() {
     std::lock_guard guard(mutex);
 
-    // Try existing allocation
+    // Try existing allocation, streams may have been resized since
     if (ShaderExportStreamSegment* segment = segmentPool.TryPop()) {
+        streamAllocator->ResizeSegment(segment->allocation);
         return segment;
     }
 
@@ -177,6 +186,49 @@ ShaderExportStreamSegment *ShaderExportStreamer::AllocateSegment() {
     return segment;
 }
 
+ShaderExportStreamSegment *ShaderExportStreamer::AcquireSubmissionSegment(ShaderExportQueueState *queue, bool& close) {
+    ShaderExportStreamSegment* segment = queue->sharedSegment;
+
+    // Open a new segment if none is shared
+    if (!segment) {
+        segment = AllocateSegment();
+        segment->frameIndex = frameIndex.load();
+    }
+
+    // Inform the controller of the segmentation point
+    //   Shared segments report on the latest point, as it covers all resources of the previous submissions
+    VersionSegmentationPoint versionSegPoint = table->versioningController->BranchOnSegmentationPoint();
+    if (segment->versionSegPoint.id == UINT32_MAX) {
+        segment->versionSegPoint = versionSegPoint;
+    } else if (versionSegPoint.segmented) {
+        table->versioningController->CollapseOnFork(segment->versionSegPoint);
+        segment->versionSegPoint = versionSegPoint;
+    }
+
+    // Close when full, sharing is disabled with a single submission
+    close = ++segment->submissionCount >= SHADER_EXPORT_MAX_SHARED_SUBMISSIONS;
+
+    // Keep open for the next submission
+    queue->sharedSegment = close ? nullptr : segment;
+
+    // OK
+    return segment;
+}
+
+bool ShaderExportStreamer::IsSharedSegmentStale(ShaderExportQueueState *queue) {
+    return queue->sharedSegment && queue->sharedSegment->frameIndex != frameIndex.load();
+}
+
+ShaderExportStreamSegment *ShaderExportStreamer::ReleaseSharedSegment(ShaderExportQueueState *queue) {
+    ShaderExportStreamSegment* segment = queue->sharedSegment;
+    queue->sharedSegment = nullptr;
+    return segment;
+}
+
+void ShaderExportStreamer::MarkFrameBoundary() {
+    frameIndex++;
+}
+
 void ShaderExportStreamer::Enqueue(ShaderExportQueueState* queue, ShaderExportStreamSegment *segment, FenceState* fence) {
     ASSERT(!segment->fence, "Segment double submission");
     
@@ -385,9 +437,7 @@ void ShaderExportStreamer::Process() {
     
     // Invoke proxies for all handles
     for (CommandContextHandle handle : completedHandles) {
-        for (const FeatureHookTable &proxyTable: table->featureHookTables) {
-            proxyTable.join.TryInvoke(handle);
-        }
+        FeatureSubmissionHookTable::Invoke(table->submissionHookTable.join, handle);
     }
 }
 
@@ -407,9 +457,7 @@ void ShaderExportStreamer::Process(ShaderExportQueueState* queueState) {
     
     // Invoke proxies for all handles
     for (CommandContextHandle handle : completedHandles) {
-        for (const FeatureHookTable &proxyTable: table->featureHookTables) {
-            proxyTable.join.TryInvoke(handle);
-        }
+        FeatureSubmissionHookTable::Invoke(table->submissionHookTable.join, handle);
     }
 }
 
@@ -427,6 +475,9 @@ void ShaderExportStreamer::Commit(ShaderExportStreamState *state, VkPipelineBind
 
     // If the allocator has rolled, a new segment is pending binding
     if (bindState.descriptorDataAllocator->HasRolled()) {
+        // Bind against a previously written segment if the data is identical
+        bindState.descriptorDataAllocator->DeduplicateSegment();
+
         // The underlying chunk may have changed, recreate the export data if needed
         if (!bindState.currentSegment.descriptorRollChunk || bindState.currentSegment.descriptorRollChunk != bindState.descriptorDataAllocator->GetSegmentBuffer()) {
             // Get current chunk
@@ -695,6 +746,10 @@ bool ShaderExportStreamer::ProcessSegment(ShaderExportStreamSegment *segment, Tr
     const MirrorAllocation& counterMirror = segment->allocation->counter.allocation;
     auto* counters = static_cast<uint32_t*>(deviceAllocator->Map(counterMirror.host));
 
+    // Overflow diagnostics
+    MessageStream diagnosticStream;
+    MessageStreamView diagnosticView(diagnosticStream);
+
     // Process all streams
     for (size_t i = 0; i < segment->allocation->streams.size(); i++) {
         const ShaderExportStreamInfo& streamInfo = segment->allocation->streams[i];
@@ -702,6 +757,10 @@ bool ShaderExportStreamer::ProcessSegment(ShaderExportStreamSegment *segment, Tr
         // Get the written counter
         uint32_t elementCount = counters[i];
 
+        // Size requested by the device, adapts future stream sizes
+        uint64_t requestedSize = elementCount * sizeof(uint32_t);
+        streamAllocator->ReportStreamUsage(static_cast<ShaderExportID>(i), requestedSize);
+
         // Limit the counter by the physical size of the buffer (may exceed)
         elementCount = std::min(elementCount, static_cast<uint32_t>(streamInfo.byteSize / streamInfo.typeInfo.typeSize));
 
@@ -711,6 +770,14 @@ bool ShaderExportStreamer::ProcessSegment(ShaderExportStreamSegment *segment, Tr
         // Size of the stream
         size_t size = elementCount * sizeof(uint32_t);
 
+        // Report any dropped messages
+        if (requestedSize > size) {
+            auto* diagnostic = diagnosticView.Add<ExportOverflowDiagnosticMessage>();
+            diagnostic->exportID = static_cast<uint32_t>(i);
+            diagnostic->droppedMessages = static_cast<uint32_t>((requestedSize - size) / streamInfo.typeInfo.typeSize);
+            diagnostic->streamByteSize = streamInfo.byteSize;
+        }
+
         // Copy into stream
         MessageStream messageStream;
         messageStream.SetSchema(streamInfo.typeInfo.messageSchema);
@@ -724,9 +791,19 @@ bool ShaderExportStreamer::ProcessSegment(ShaderExportStreamSegment *segment, Tr
         deviceAllocator->Unmap(streamInfo.allocation.host);
     }
 
+    // Directly read device counters are not cleared on the device
+    if (counterMirror.IsShared()) {
+        std::memset(counters, 0x0, sizeof(ShaderExportCounter) * segment->allocation->streams.size());
+    }
+
     // Unmap host
     deviceAllocator->Unmap(counterMirror.host);
 
+    // Commit any diagnostics
+    if (diagnosticStream.GetCount()) {
+        output->AddStream(diagnosticStream);
+    }
+
     // Inform the versioning controller of a collapse
     ASSERT(segment->versionSegPoint.id != UINT32_MAX, "Untracked versioning");
     table->versioningController->CollapseOnFork(segment->versionSegPoint);
@@ -745,7 +822,8 @@ void ShaderExportStreamer::FreeSegmentNoQueueLock(ShaderExportQueueState* queue,
     QueueState* queueState = table->states_queue.GetNoLock(queue->queue);
 
     // Move ownership to queue (don't release the reference count, queue owns it now)
-    if (segment->fence->isImmediate) {
+    //   Unsubmitted shared segments are never fenced
+    if (segment->fence && segment->fence->isImmediate) {
         queueState->pools_fences.Push(segment->fence);
     }
 
@@ -777,13 +855,32 @@ void ShaderExportStreamer::FreeSegmentNoQueueLock(ShaderExportQueueState* queue,
     // Reset versioning
     segment->versionSegPoint = {};
 
-    // Release command buffer
+    // Release command buffer, unsubmitted shared segments have no post patching
     queueState->PushCommandBuffer(segment->prePatchCommandBuffer);
-    queueState->PushCommandBuffer(segment->postPatchCommandBuffer);
+    if (segment->postPatchCommandBuffer) {
+        queueState->PushCommandBuffer(segment->postPatchCommandBuffer);
+    }
 
     // Release persistent version
     destroyRef(segment->prmtPersistentVersion, allocators);
 
+    // Release all shared submission data
+    for (VkCommandBuffer commandBuffer : segment->sharedPrePatchCommandBuffers) {
+        queueState->PushCommandBuffer(commandBuffer);
+    }
+
+    for (PhysicalResourceMappingTablePersistentVersion* persistentVersion : segment->sharedPrmtPersistentVersions) {
+        destroyRef(persistentVersion, allocators);
+    }
+
+    // Reset sharing
+    segment->sharedPrePatchCommandBuffers.clear();
+    segment->sharedPrmtPersistentVersions.clear();
+    segment->prePatchCommandBuffer = VK_NULL_HANDLE;
+    segment->postPatchCommandBuffer = VK_NULL_HANDLE;
+    segment->prmtPersistentVersion = nullptr;
+    segment->submissionCount = 0;
+
     // Add back to pool
     segmentPool.Push(segment);
 }
@@ -808,6 +905,11 @@ VkCommandBuffer ShaderExportStreamer::RecordPreCommandBuffer(ShaderExportQueueSt
     // Get queue
     QueueState* queueState = table->states_queue.Get(state->queue);
 
+    // Shared segments keep the patching of previous submissions alive
+    if (segment->prePatchCommandBuffer) {
+        segment->sharedPrePatchCommandBuffers.push_back(segment->prePatchCommandBuffer);
+    }
+
     // Pop a new command buffer
     segment->prePatchCommandBuffer = queueState->PopCommandBuffer();
 
@@ -852,6 +954,11 @@ VkCommandBuffer ShaderExportStreamer::RecordPreCommandBuffer(ShaderExportQueueSt
         segment->allocation->pendingInitialization = false;
     }
 
+    // Previous submissions may still reference their persistent version
+    if (segment->prmtPersistentVersion) {
+        segment->sharedPrmtPersistentVersions.push_back(segment->prmtPersistentVersion);
+    }
+
     // Update all PRM data
     segment->prmtPersistentVersion = table->prmTable->GetPersistentVersion(segment->prePatchCommandBuffer, prmtState);
 
@@ -895,6 +1002,12 @@ VkCommandBuffer ShaderExportStreamer::RecordPostCommandBuffer(ShaderExportQueueS
         0, nullptr
     );
 
+    // Directly read device counters, cleared on the host after processing
+    if (counter.allocation.IsShared()) {
+        table->next_vkEndCommandBuffer(segment->postPatchCommandBuffer);
+        return segment->postPatchCommandBuffer;
+    }
+
     // Copy the counter from device to host
     VkBufferCopy copy{};
     copy.size = sizeof(ShaderExportCounter) * segment->allocation->streams.size();
@@ -963,6 +1076,16 @@ void ShaderExportStreamer::BindDescriptorSets(ShaderExportStreamState* state, Vk
         // Clear the mask
         bindState.deviceDescriptorOverwriteMask &= ~(1u << slot);
 
+        // Identical to the current state? Avoids re-allocating the dynamic offsets
+        const ShaderExportDescriptorState& currentState = bindState.persistentDescriptorState[slot];
+        if (currentState.set == sets[i] &&
+            currentState.compatabilityHash == layoutState->compatabilityHashes[slot] &&
+            currentState.dynamicOffsets.count == slotDynamicCount &&
+            (!slotDynamicCount || !std::memcmp(currentState.dynamicOffsets.data, pDynamicOffsets + dynamicOffset, sizeof(uint32_t) * slotDynamicCount))) {
+            dynamicOffset += slotDynamicCount;
+            continue;
+        }
+
         // Push back to pool if needed
         if (bindState.persistentDescriptorState[slot].dynamicOffsets) {
             std::lock_guard guard(mutex);
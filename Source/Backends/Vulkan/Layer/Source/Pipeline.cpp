@@ -178,9 +178,9 @@ PipelineState::~PipelineState() {
     }
 
     // Release all instrumented objects
-    for (auto&& kv : instrumentObjects) {
-        table->next_vkDestroyPipeline(table->object, kv.second, nullptr);
-    }
+    instrumentObjects.ForEach([&](auto&&, VkPipeline object) {
+        table->next_vkDestroyPipeline(table->object, object, nullptr);
+    });
 
     // Release all references to the shader modules
     for (ShaderModuleState* module : shaderModules) {
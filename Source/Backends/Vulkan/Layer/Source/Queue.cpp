@@ -158,6 +158,42 @@ static FenceState* AcquireOrCreateFence(DeviceDispatchTable* table, QueueState*
     return state;
 }
 
+static VkResult SubmitSharedSegment(DeviceDispatchTable* table, QueueState* queueState) {
+    // Anything shared?
+    ShaderExportStreamSegment* segment = table->exportStreamer->ReleaseSharedSegment(queueState->exportState);
+    if (!segment) {
+        return VK_SUCCESS;
+    }
+
+    // Acquire fence
+    FenceState* fenceState = AcquireOrCreateFence(table, queueState, VK_NULL_HANDLE);
+
+    // Record the streaming patching
+    VkCommandBuffer postPatchCommandBuffer = table->exportStreamer->RecordPostCommandBuffer(queueState->exportState, segment);
+
+    // Fill patch submission info
+    VkSubmitInfo postPatchInfo{VK_STRUCTURE_TYPE_SUBMIT_INFO};
+    postPatchInfo.commandBufferCount = 1;
+    postPatchInfo.pCommandBuffers = &postPatchCommandBuffer;
+
+    // Serialize queue access
+    {
+        std::lock_guard guard(queueState->mutex);
+
+        // Pass down callchain
+        VkResult result = table->next_vkQueueSubmit(queueState->object, 1u, &postPatchInfo, fenceState->object);
+        if (result != VK_SUCCESS) {
+            return result;
+        }
+    }
+
+    // Notify streamer of submission, enqueue increments reference count
+    table->exportStreamer->Enqueue(queueState->exportState, segment, fenceState);
+
+    // OK
+    return VK_SUCCESS;
+}
+
 VKAPI_ATTR VkResult VKAPI_CALL Hook_vkQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, VkFence userFence) {
     DeviceDispatchTable* table = DeviceDispatchTable::Get(GetInternalTable(queue));
 
@@ -167,14 +203,19 @@ VKAPI_ATTR VkResult VKAPI_CALL Hook_vkQueueSubmit(VkQueue queue, uint32_t submit
     // Check all in-flight streams
     table->exportStreamer->Process(queueState->exportState);
 
-    // Acquire fence
-    FenceState* fenceState = AcquireOrCreateFence(table, queueState, userFence);
+    // Shared segments do not cross frame boundaries
+    if (table->exportStreamer->IsSharedSegmentStale(queueState->exportState)) {
+        if (VkResult result = SubmitSharedSegment(table, queueState); result != VK_SUCCESS) {
+            return result;
+        }
+    }
 
-    // Create streamer allocation
-    ShaderExportStreamSegment* segment = table->exportStreamer->AllocateSegment();
+    // Get the streamer allocation, may be shared with previous submissions
+    bool closeSegment{false};
+    ShaderExportStreamSegment* segment = table->exportStreamer->AcquireSubmissionSegment(queueState->exportState, closeSegment);
 
-    // Inform the controller of the segmentation point
-    segment->versionSegPoint = table->versioningController->BranchOnSegmentationPoint();
+    // Acquire fence, shared submissions only need the user fence
+    FenceState* fenceState = closeSegment ? AcquireOrCreateFence(table, queueState, userFence) : nullptr;
 
     // Unwrapped submits
     TrivialStackVector<VkSubmitInfo, 32u> vkSubmits;
@@ -229,39 +270,44 @@ VKAPI_ATTR VkResult VKAPI_CALL Hook_vkQueueSubmit(VkQueue queue, uint32_t submit
         vkCommandBuffers += submit.commandBufferCount;
     }
 
-    // Record the streaming patching
-    VkCommandBuffer postPatchCommandBuffer = table->exportStreamer->RecordPostCommandBuffer(queueState->exportState, segment);
+    // Record the streaming patching, only once per segment
+    VkCommandBuffer postPatchCommandBuffer{VK_NULL_HANDLE};
+    if (closeSegment) {
+        postPatchCommandBuffer = table->exportStreamer->RecordPostCommandBuffer(queueState->exportState, segment);
 
-    // Fill patch submission info
-    VkSubmitInfo& postPatchInfo = vkSubmits.Add({VK_STRUCTURE_TYPE_SUBMIT_INFO});
-    postPatchInfo.commandBufferCount = 1;
-    postPatchInfo.pCommandBuffers = &postPatchCommandBuffer;
+        // Fill patch submission info
+        VkSubmitInfo& postPatchInfo = vkSubmits.Add({VK_STRUCTURE_TYPE_SUBMIT_INFO});
+        postPatchInfo.commandBufferCount = 1;
+        postPatchInfo.pCommandBuffers = &postPatchCommandBuffer;
+    }
 
     // Serialize queue access
     {
         std::lock_guard guard(queueState->mutex);
 
         // Pass down callchain
-        VkResult result = table->next_vkQueueSubmit(queue, static_cast<uint32_t>(vkSubmits.Size()), vkSubmits.Data(), fenceState->object);
+        VkResult result = table->next_vkQueueSubmit(queue, static_cast<uint32_t>(vkSubmits.Size()), vkSubmits.Data(), fenceState ? fenceState->object : userFence);
         if (result != VK_SUCCESS) {
             return result;
         }
     }
 
-    // Unwrap once again for proxies
-    for (uint32_t i = 0; i < submitCount; i++) {
-        for (uint32_t bufferIndex = 0; bufferIndex < pSubmits[i].commandBufferCount; bufferIndex++) {
-            auto *unwrapped = reinterpret_cast<CommandBufferObject *>(pSubmits[i].pCommandBuffers[bufferIndex]);
+    // Unwrap once again for proxies, skipped entirely if no feature subscribes
+    if (!table->submissionHookTable.submit.empty()) {
+        for (uint32_t i = 0; i < submitCount; i++) {
+            for (uint32_t bufferIndex = 0; bufferIndex < pSubmits[i].commandBufferCount; bufferIndex++) {
+                auto *unwrapped = reinterpret_cast<CommandBufferObject *>(pSubmits[i].pCommandBuffers[bufferIndex]);
 
-            // Invoke all proxies
-            for (const FeatureHookTable &proxyTable: table->featureHookTables) {
-                proxyTable.submit.TryInvoke(unwrapped->userContext.handle);
+                // Invoke all proxies
+                FeatureSubmissionHookTable::Invoke(table->submissionHookTable.submit, unwrapped->userContext.handle);
             }
         }
     }
 
     // Notify streamer of submission, enqueue increments reference count
-    table->exportStreamer->Enqueue(queueState->exportState, segment, fenceState);
+    if (closeSegment) {
+        table->exportStreamer->Enqueue(queueState->exportState, segment, fenceState);
+    }
 
     // OK
     return VK_SUCCESS;
@@ -273,6 +319,11 @@ VKAPI_ATTR VkResult VKAPI_CALL Hook_vkQueueWaitIdle(VkQueue queue) {
     // Get the state
     QueueState* queueState = table->states_queue.Get(queue);
 
+    // Close any shared segment, the wait should cover it
+    if (VkResult result = SubmitSharedSegment(table, queueState); result != VK_SUCCESS) {
+        return result;
+    }
+
     // Pass down callchain
     VkResult result = table->next_vkQueueWaitIdle(queue);
     if (result != VK_SUCCESS) {
@@ -292,6 +343,19 @@ VKAPI_ATTR VkResult VKAPI_CALL Hook_vkQueueWaitIdle(VkQueue queue) {
 VKAPI_ATTR VkResult VKAPI_CALL Hook_vkDeviceWaitIdle(VkDevice device) {
     DeviceDispatchTable* table = DeviceDispatchTable::Get(GetInternalTable(device));
 
+    // Gather all queues, the linear view lock must not be held while submitting (streamer -> queue)
+    TrivialStackVector<QueueState*, 16u> queueStates;
+    for (QueueState* queueState : table->states_queue.GetLinear()) {
+        queueStates.Add(queueState);
+    }
+
+    // Close all shared segments, all queues are externally synchronized
+    for (QueueState* queueState : queueStates) {
+        if (VkResult result = SubmitSharedSegment(table, queueState); result != VK_SUCCESS) {
+            return result;
+        }
+    }
+
     // Pass down callchain
     VkResult result = table->next_vkDeviceWaitIdle(device);
     if (result != VK_SUCCESS) {
@@ -340,6 +404,14 @@ VKAPI_ATTR void VKAPI_CALL Hook_vkGetDeviceQueue2(VkDevice device, const VkDevic
 VkResult Hook_vkQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR *pPresentInfo) {
     DeviceDispatchTable* table = DeviceDispatchTable::Get(GetInternalTable(queue));
 
+    // Close the shared segment of the presenting queue, other queues close on their next submission
+    if (VkResult result = SubmitSharedSegment(table, table->states_queue.Get(queue)); result != VK_SUCCESS) {
+        return result;
+    }
+
+    // Mark the frame boundary
+    table->exportStreamer->MarkFrameBoundary();
+
     // Pass down callchain
     VkResult result = table->next_vkQueuePresentKHR(queue, pPresentInfo);
     if (result != VK_SUCCESS) {
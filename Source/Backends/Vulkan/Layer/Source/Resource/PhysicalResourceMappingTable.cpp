@@ -158,6 +158,21 @@ void PhysicalResourceMappingTable::AllocateTable(uint32_t count) {
             .srb = 0
         };
     }
+
+    // The device buffer is new, all pages must be uploaded on every queue
+    commitHead++;
+    pageCommitHeads.assign((virtualMappingCount + kDirtyPageMappingCount - 1) / kDirtyPageMappingCount, commitHead);
+}
+
+void PhysicalResourceMappingTable::MarkDirty(uint32_t offset, uint32_t count) {
+    if (!count) {
+        return;
+    }
+
+    // Mark all pages spanned
+    for (uint32_t page = offset / kDirtyPageMappingCount; page <= (offset + count - 1) / kDirtyPageMappingCount; page++) {
+        pageCommitHeads[page] = commitHead;
+    }
 }
 
 PhysicalResourceMappingTablePersistentVersion* PhysicalResourceMappingTable::GetPersistentVersion(VkCommandBuffer commandBuffer, PhysicalResourceMappingTableQueueState* queueState) {
@@ -171,12 +186,47 @@ PhysicalResourceMappingTablePersistentVersion* PhysicalResourceMappingTable::Get
         return persistentVersion;
     }
 
+    // Number of pages written since the last update on this queue
+    auto pageCount = static_cast<uint32_t>(pageCommitHeads.size());
+    uint32_t dirtyPageCount = 0;
+
+    // Collect the dirty pages, contiguous pages are merged into a single region
+    copyRegions.clear();
+    for (uint32_t page = 0; page < pageCount; page++) {
+        if (pageCommitHeads[page] <= queueState->commitHead) {
+            continue;
+        }
+
+        // The last page may be partial
+        uint32_t pageOffset = page * kDirtyPageMappingCount;
+        uint32_t pageLength = std::min(kDirtyPageMappingCount, virtualMappingCount - pageOffset);
+
+        // Extend the previous region if adjacent
+        VkDeviceSize byteOffset = pageOffset * sizeof(VirtualResourceMapping);
+        if (!copyRegions.empty() && copyRegions.back().srcOffset + copyRegions.back().size == byteOffset) {
+            copyRegions.back().size += pageLength * sizeof(VirtualResourceMapping);
+        } else {
+            VkBufferCopy& copyRegion = copyRegions.emplace_back();
+            copyRegion.size = pageLength * sizeof(VirtualResourceMapping);
+            copyRegion.srcOffset = byteOffset;
+            copyRegion.dstOffset = byteOffset;
+        }
+
+        dirtyPageCount++;
+    }
+
+    // Heavily fragmented or mostly dirty, just copy everything
+    if (copyRegions.size() > kMaxCopyRegions || dirtyPageCount > static_cast<uint32_t>(pageCount * kFullCopyDirtyThreshold)) {
+        copyRegions.clear();
+
+        VkBufferCopy& copyRegion = copyRegions.emplace_back();
+        copyRegion.size = virtualMappingCount * sizeof(VirtualResourceMapping);
+        copyRegion.srcOffset = 0;
+        copyRegion.dstOffset = 0;
+    }
+
     // Copy host to device
-    VkBufferCopy copyRegion;
-    copyRegion.size = virtualMappingCount * sizeof(VirtualResourceMapping);
-    copyRegion.srcOffset = 0;
-    copyRegion.dstOffset = 0;
-    table->commandBufferDispatchTable.next_vkCmdCopyBuffer(commandBuffer, persistentVersion->hostBuffer, persistentVersion->deviceBuffer, 1u, &copyRegion);
+    table->commandBufferDispatchTable.next_vkCmdCopyBuffer(commandBuffer, persistentVersion->hostBuffer, persistentVersion->deviceBuffer, static_cast<uint32_t>(copyRegions.size()), copyRegions.data());
 
     // Flush the copy for shader reads
     VkMemoryBarrier barrier{VK_STRUCTURE_TYPE_MEMORY_BARRIER};
@@ -209,6 +259,30 @@ void PhysicalResourceMappingTable::WriteMapping(PhysicalResourceSegmentID id, ui
 
     // Advance head
     commitHead++;
+
+    // Mark the written page
+    MarkDirty(segment.offset + offset, 1u);
+}
+
+void PhysicalResourceMappingTable::WriteMappings(PhysicalResourceSegmentID id, uint32_t offset, uint32_t count, const VirtualResourceMapping *mappings) {
+    if (!count) {
+        return;
+    }
+
+    std::lock_guard guard(mutex);
+
+    // Get the underlying segment
+    const PhysicalResourceMappingTableSegment& segment = segments.at(indices.at(id));
+
+    // Write all mappings
+    ASSERT(offset + count <= segment.length, "Physical segment offset out of bounds");
+    std::memcpy(persistentVersion->virtualMappings + segment.offset + offset, mappings, sizeof(VirtualResourceMapping) * count);
+
+    // Advance head
+    commitHead++;
+
+    // Mark the written range
+    MarkDirty(segment.offset + offset, count);
 }
 
 size_t PhysicalResourceMappingTable::GetMappingOffset(PhysicalResourceSegmentID id, uint32_t offset) {
@@ -241,6 +315,38 @@ void PhysicalResourceMappingTable::CopyMappings(PhysicalResourceSegmentID source
     
     // Advance head
     commitHead++;
+
+    // Mark the written range
+    MarkDirty(sourceSegment.offset, sourceSegment.length);
+}
+
+void PhysicalResourceMappingTable::CopyMappings(PhysicalResourceSegmentID source, uint32_t sourceOffset, PhysicalResourceSegmentID dest, uint32_t destOffset, uint32_t count) {
+    if (!count) {
+        return;
+    }
+
+    std::lock_guard guard(mutex);
+
+    // Get the underlying segment
+    const PhysicalResourceMappingTableSegment& sourceSegment = segments.at(indices.at(source));
+    const PhysicalResourceMappingTableSegment& destSegment   = segments.at(indices.at(dest));
+
+    // Validation
+    ASSERT(sourceOffset + count <= sourceSegment.length, "Physical segment offset out of bounds");
+    ASSERT(destOffset + count <= destSegment.length, "Physical segment offset out of bounds");
+
+    // Copy range, may overlap if copying within the same segment
+    std::memmove(
+        persistentVersion->virtualMappings + destSegment.offset + destOffset,
+        persistentVersion->virtualMappings + sourceSegment.offset + sourceOffset,
+        sizeof(VirtualResourceMapping) * count
+    );
+
+    // Advance head
+    commitHead++;
+
+    // Mark the written range
+    MarkDirty(destSegment.offset + destOffset, count);
 }
 
 PhysicalResourceMappingTableSegment PhysicalResourceMappingTable::GetSegmentShader(PhysicalResourceSegmentID id) {
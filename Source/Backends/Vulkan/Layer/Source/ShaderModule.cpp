@@ -84,9 +84,9 @@ ShaderModuleState::~ShaderModuleState() {
     table->states_shaderModule.RemoveState(this);
 
     // Release instrumented modules
-    for (auto&& kv : instrumentObjects) {
-        table->next_vkDestroyShaderModule(table->object, kv.second, nullptr);
-    }
+    instrumentObjects.ForEach([&](auto&&, VkShaderModule object) {
+        table->next_vkDestroyShaderModule(table->object, object, nullptr);
+    });
 
     // Release spirv module
     if (spirvModule) {
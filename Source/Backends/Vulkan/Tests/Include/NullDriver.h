@@ -0,0 +1,49 @@
+// 
+// The MIT License (MIT)
+// 
+// Copyright (c) 2024 Advanced Micro Devices, Inc.,
+// Fatalist Development AB (Avalanche Studio Group),
+// and Miguel Petersen.
+// 
+// All Rights Reserved.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy 
+// of this software and associated documentation files (the "Software"), to deal 
+// in the Software without restriction, including without limitation the rights 
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies 
+// of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, 
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma once
+
+// Vulkan
+#include <vulkan/vulkan_core.h>
+
+/**
+ * Null driver, terminates the layer chain without any hardware backing
+ *
+ * All objects are fake, all commands are no-ops and all queries report a generous device.
+ * Chained under the layer it leaves only the cost of the layer itself, see NullLoader.
+ */
+
+/// Get a null driver instance function
+/// \param instance parent instance, may be null
+/// \param pName name of the function
+/// \return never null, unknown functions are no-ops returning VK_SUCCESS
+VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL NullDriver_vkGetInstanceProcAddr(VkInstance instance, const char* pName);
+
+/// Get a null driver device function
+/// \param device parent device
+/// \param pName name of the function
+/// \return never null, unknown functions are no-ops returning VK_SUCCESS
+VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL NullDriver_vkGetDeviceProcAddr(VkDevice device, const char* pName);
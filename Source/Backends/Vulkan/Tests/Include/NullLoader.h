@@ -0,0 +1,114 @@
+// 
+// The MIT License (MIT)
+// 
+// Copyright (c) 2024 Advanced Micro Devices, Inc.,
+// Fatalist Development AB (Avalanche Studio Group),
+// and Miguel Petersen.
+// 
+// All Rights Reserved.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy 
+// of this software and associated documentation files (the "Software"), to deal 
+// in the Software without restriction, including without limitation the rights 
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies 
+// of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, 
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma once
+
+// Third party
+#include <catch2/catch.hpp>
+#include <vulkan/vulkan.h>
+
+// Backend
+#include <Backend/Environment.h>
+
+/// Test loader chaining the layer directly on top of the null driver
+///   ? Bypasses the system loader, no GPU or installed driver is required
+class NullLoader {
+public:
+    NullLoader();
+    ~NullLoader();
+
+    /// Create an instance through the layer
+    void CreateInstance();
+
+    /// Create a device through the layer, instance must be created
+    void CreateDevice();
+
+    /// Get an instance function through the layer
+    template<typename T>
+    T GetInstanceProcAddr(const char* name) const {
+        auto function = reinterpret_cast<T>(layerGetInstanceProcAddr(instance, name));
+        REQUIRE(function);
+        return function;
+    }
+
+    /// Get a device function through the layer
+    template<typename T>
+    T GetDeviceProcAddr(const char* name) const {
+        auto function = reinterpret_cast<T>(layerGetDeviceProcAddr(device, name));
+        REQUIRE(function);
+        return function;
+    }
+
+    /// Get the physical device
+    [[nodiscard]]
+    VkPhysicalDevice GetPhysicalDevice() const {
+        return physicalDevice;
+    }
+
+    /// Get the instance
+    [[nodiscard]]
+    VkInstance GetInstance() const {
+        return instance;
+    }
+
+    /// Get the device
+    [[nodiscard]]
+    VkDevice GetDevice() const {
+        return device;
+    }
+
+    /// Get the primary queue family
+    [[nodiscard]]
+    uint32_t GetPrimaryQueueFamily() const {
+        return 0u;
+    }
+
+    /// Get the primary queue
+    [[nodiscard]]
+    VkQueue GetPrimaryQueue() const {
+        return queue;
+    }
+
+    /// Get the registry
+    [[nodiscard]]
+    Registry* GetRegistry() {
+        return environment.GetRegistry();
+    }
+
+private:
+    VkInstance       instance      {VK_NULL_HANDLE};
+    VkPhysicalDevice physicalDevice{VK_NULL_HANDLE};
+    VkDevice         device        {VK_NULL_HANDLE};
+    VkQueue          queue         {VK_NULL_HANDLE};
+
+private:
+    /// Layer entry points
+    PFN_vkGetInstanceProcAddr layerGetInstanceProcAddr{nullptr};
+    PFN_vkGetDeviceProcAddr   layerGetDeviceProcAddr{nullptr};
+
+private:
+    Backend::Environment environment;
+};
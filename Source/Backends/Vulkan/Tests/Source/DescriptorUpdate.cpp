@@ -0,0 +1,209 @@
+// 
+// The MIT License (MIT)
+// 
+// Copyright (c) 2024 Advanced Micro Devices, Inc.,
+// Fatalist Development AB (Avalanche Studio Group),
+// and Miguel Petersen.
+// 
+// All Rights Reserved.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy 
+// of this software and associated documentation files (the "Software"), to deal 
+// in the Software without restriction, including without limitation the rights 
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies 
+// of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, 
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+// Catch2
+#include <catch2/catch.hpp>
+
+// Tests
+#include "Loader.h"
+
+// Std
+#include <vector>
+#include <random>
+
+/// Recorded descriptor update
+struct DescriptorUpdateRecord {
+    /// First element written
+    uint32_t arrayElement;
+
+    /// Number of elements written
+    uint32_t count;
+};
+
+/// Record a deterministic update stream
+/// \param descriptorCount number of descriptors in the binding
+/// \param updateCount number of updates
+/// \param maxRange maximum number of contiguous elements per update
+static std::vector<DescriptorUpdateRecord> RecordUpdateStream(uint32_t descriptorCount, uint32_t updateCount, uint32_t maxRange) {
+    std::mt19937 engine(0x1u);
+    std::uniform_int_distribution<uint32_t> rangeDistribution(1u, maxRange);
+
+    std::vector<DescriptorUpdateRecord> records;
+    for (uint32_t i = 0; i < updateCount; i++) {
+        uint32_t count = rangeDistribution(engine);
+        records.push_back(DescriptorUpdateRecord {
+            .arrayElement = std::uniform_int_distribution<uint32_t>(0u, descriptorCount - count)(engine),
+            .count = count
+        });
+    }
+
+    return records;
+}
+
+TEST_CASE_METHOD(Loader, "Layer.DescriptorUpdate.Performance", "[Vulkan]") {
+    REQUIRE(AddInstanceLayer("VK_LAYER_GPUOPEN_GRS"));
+
+    // Create the instance & device
+    CreateInstance();
+    CreateDevice();
+
+    // Bindless sized binding
+    constexpr uint32_t kDescriptorCount = 16384;
+
+    // Number of updates per replay
+    constexpr uint32_t kUpdateCount = 4096;
+
+    VkDescriptorSetLayoutBinding binding{};
+    binding.binding = 0;
+    binding.descriptorType = VK_DESCRIPTOR_TYPE_SAMPLER;
+    binding.descriptorCount = kDescriptorCount;
+    binding.stageFlags = VK_SHADER_STAGE_ALL;
+
+    VkDescriptorSetLayoutCreateInfo layoutInfo{};
+    layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+    layoutInfo.bindingCount = 1;
+    layoutInfo.pBindings = &binding;
+
+    VkDescriptorSetLayout layout;
+    REQUIRE(vkCreateDescriptorSetLayout(GetDevice(), &layoutInfo, nullptr, &layout) == VK_SUCCESS);
+
+    VkDescriptorPoolSize poolSize{};
+    poolSize.type = VK_DESCRIPTOR_TYPE_SAMPLER;
+    poolSize.descriptorCount = kDescriptorCount;
+
+    VkDescriptorPoolCreateInfo poolInfo{};
+    poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    poolInfo.maxSets = 1;
+    poolInfo.poolSizeCount = 1;
+    poolInfo.pPoolSizes = &poolSize;
+
+    VkDescriptorPool pool;
+    REQUIRE(vkCreateDescriptorPool(GetDevice(), &poolInfo, nullptr, &pool) == VK_SUCCESS);
+
+    VkDescriptorSetAllocateInfo allocateInfo{};
+    allocateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    allocateInfo.descriptorPool = pool;
+    allocateInfo.descriptorSetCount = 1;
+    allocateInfo.pSetLayouts = &layout;
+
+    VkDescriptorSet set;
+    REQUIRE(vkAllocateDescriptorSets(GetDevice(), &allocateInfo, &set) == VK_SUCCESS);
+
+    VkSamplerCreateInfo samplerInfo{};
+    samplerInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+
+    VkSampler sampler;
+    REQUIRE(vkCreateSampler(GetDevice(), &samplerInfo, nullptr, &sampler) == VK_SUCCESS);
+
+    // Shared descriptor data, large enough for any update
+    std::vector<VkDescriptorImageInfo> imageInfos(kDescriptorCount, VkDescriptorImageInfo {
+        .sampler = sampler
+    });
+
+    // Translate a recorded stream to writes
+    auto getWrites = [&](const std::vector<DescriptorUpdateRecord>& records) {
+        std::vector<VkWriteDescriptorSet> writes;
+        for (const DescriptorUpdateRecord& record : records) {
+            VkWriteDescriptorSet& write = writes.emplace_back();
+            write = VkWriteDescriptorSet{VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET};
+            write.dstSet = set;
+            write.dstBinding = 0;
+            write.dstArrayElement = record.arrayElement;
+            write.descriptorCount = record.count;
+            write.descriptorType = VK_DESCRIPTOR_TYPE_SAMPLER;
+            write.pImageInfo = imageInfos.data();
+        }
+
+        return writes;
+    };
+
+    // Single element updates, typical of streaming engines
+    std::vector<VkWriteDescriptorSet> singleWrites = getWrites(RecordUpdateStream(kDescriptorCount, kUpdateCount, 1u));
+
+    // Contiguous array updates, typical of bindless engines
+    std::vector<VkWriteDescriptorSet> rangeWrites = getWrites(RecordUpdateStream(kDescriptorCount, kUpdateCount, 256u));
+
+    BENCHMARK("Single Element Writes") {
+        for (const VkWriteDescriptorSet& write : singleWrites) {
+            vkUpdateDescriptorSets(GetDevice(), 1u, &write, 0u, nullptr);
+        }
+    };
+
+    BENCHMARK("Batched Single Element Writes") {
+        vkUpdateDescriptorSets(GetDevice(), static_cast<uint32_t>(singleWrites.size()), singleWrites.data(), 0u, nullptr);
+    };
+
+    BENCHMARK("Contiguous Range Writes") {
+        vkUpdateDescriptorSets(GetDevice(), static_cast<uint32_t>(rangeWrites.size()), rangeWrites.data(), 0u, nullptr);
+    };
+
+    // Copies from the first half to the second half
+    std::vector<VkCopyDescriptorSet> copies;
+    for (const DescriptorUpdateRecord& record : RecordUpdateStream(kDescriptorCount / 2u, kUpdateCount, 256u)) {
+        VkCopyDescriptorSet& copy = copies.emplace_back();
+        copy = VkCopyDescriptorSet{VK_STRUCTURE_TYPE_COPY_DESCRIPTOR_SET};
+        copy.srcSet = set;
+        copy.srcBinding = 0;
+        copy.srcArrayElement = record.arrayElement;
+        copy.dstSet = set;
+        copy.dstBinding = 0;
+        copy.dstArrayElement = record.arrayElement + kDescriptorCount / 2u;
+        copy.descriptorCount = record.count;
+    }
+
+    BENCHMARK("Contiguous Range Copies") {
+        vkUpdateDescriptorSets(GetDevice(), 0u, nullptr, static_cast<uint32_t>(copies.size()), copies.data());
+    };
+
+    // Template covering the entire binding
+    VkDescriptorUpdateTemplateEntry templateEntry{};
+    templateEntry.dstBinding = 0;
+    templateEntry.dstArrayElement = 0;
+    templateEntry.descriptorCount = kDescriptorCount;
+    templateEntry.descriptorType = VK_DESCRIPTOR_TYPE_SAMPLER;
+    templateEntry.offset = 0;
+    templateEntry.stride = sizeof(VkDescriptorImageInfo);
+
+    VkDescriptorUpdateTemplateCreateInfo templateInfo{};
+    templateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO;
+    templateInfo.descriptorUpdateEntryCount = 1;
+    templateInfo.pDescriptorUpdateEntries = &templateEntry;
+    templateInfo.templateType = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET;
+    templateInfo.descriptorSetLayout = layout;
+
+    VkDescriptorUpdateTemplate updateTemplate;
+    REQUIRE(vkCreateDescriptorUpdateTemplate(GetDevice(), &templateInfo, nullptr, &updateTemplate) == VK_SUCCESS);
+
+    BENCHMARK("Template Writes") {
+        vkUpdateDescriptorSetWithTemplate(GetDevice(), set, updateTemplate, imageInfos.data());
+    };
+
+    // Release handles
+    vkDestroyDescriptorUpdateTemplate(GetDevice(), updateTemplate, nullptr);
+    vkDestroySampler(GetDevice(), sampler, nullptr);
+    vkDestroyDescriptorPool(GetDevice(), pool, nullptr);
+    vkDestroyDescriptorSetLayout(GetDevice(), layout, nullptr);
+}
@@ -0,0 +1,559 @@
+// 
+// The MIT License (MIT)
+// 
+// Copyright (c) 2024 Advanced Micro Devices, Inc.,
+// Fatalist Development AB (Avalanche Studio Group),
+// and Miguel Petersen.
+// 
+// All Rights Reserved.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy 
+// of this software and associated documentation files (the "Software"), to deal 
+// in the Software without restriction, including without limitation the rights 
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies 
+// of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, 
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+// Catch2
+#include <catch2/catch.hpp>
+
+// Tests
+#include <NullLoader.h>
+
+// Message
+#include <Message/MessageStream.h>
+
+// Schemas
+#include <Schemas/Instrumentation.h>
+#include <Schemas/Config.h>
+
+// Common
+#include <Common/ComponentTemplate.h>
+
+// Backend
+#include <Backend/IFeatureHost.h>
+#include <Backend/IFeature.h>
+
+// Bridge
+#include <Bridge/IBridge.h>
+
+// HLSL
+#include <Data/WriteUAVVulkan.h>
+
+// Std
+#include <vector>
+
+/// Number of commands per recorded pattern
+static constexpr uint32_t kPatternCommandCount = 1024;
+
+/// Number of descriptor sets cycled by the churn pattern
+static constexpr uint32_t kChurnSetCount = 256;
+
+/// Number of descriptors in the bindless binding
+static constexpr uint32_t kBindlessDescriptorCount = 4096;
+
+/// Empty vertex shader, SPIRV
+static constexpr uint32_t kVertexCode[] =
+{
+    0x07230203,0x00010000,0x000d000a,0x00000006,
+    0x00000000,0x00020011,0x00000001,0x0003000e,
+    0x00000000,0x00000001,0x0005000f,0x00000000,
+    0x00000004,0x6e69616d,0x00000000,0x00020013,
+    0x00000002,0x00030021,0x00000003,0x00000002,
+    0x00050036,0x00000002,0x00000004,0x00000000,
+    0x00000003,0x000200f8,0x00000005,0x000100fd,
+    0x00010038
+};
+
+/// Feature subscribing to all command hooks, measures the hook dispatch cost
+class OverheadFeature : public IFeature {
+public:
+    COMPONENT(OverheadFeature);
+
+    bool Install() override {
+        return true;
+    }
+
+    FeatureInfo GetInfo() override {
+        return FeatureInfo();
+    }
+
+    FeatureHookTable GetHookTable() override {
+        FeatureHookTable table{};
+        table.drawInstanced = BindDelegate(this, OverheadFeature::OnDrawInstanced);
+        table.drawIndexedInstanced = BindDelegate(this, OverheadFeature::OnDrawIndexedInstanced);
+        table.dispatch = BindDelegate(this, OverheadFeature::OnDispatch);
+        table.open = BindDelegate(this, OverheadFeature::OnOpen);
+        table.close = BindDelegate(this, OverheadFeature::OnClose);
+        table.submit = BindDelegate(this, OverheadFeature::OnSubmit);
+        table.join = BindDelegate(this, OverheadFeature::OnJoin);
+        return table;
+    }
+
+    void OnDrawInstanced(CommandContext* context, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) {
+        invocationCount++;
+    }
+
+    void OnDrawIndexedInstanced(CommandContext* context, uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance) {
+        invocationCount++;
+    }
+
+    void OnDispatch(CommandContext* context, uint32_t threadGroupX, uint32_t threadGroupY, uint32_t threadGroupZ) {
+        invocationCount++;
+    }
+
+    void OnOpen(CommandContext* context) {
+        invocationCount++;
+    }
+
+    void OnClose(CommandContextHandle contextHandle) {
+        invocationCount++;
+    }
+
+    void OnSubmit(CommandContextHandle contextHandle) {
+        invocationCount++;
+    }
+
+    void OnJoin(CommandContextHandle contextHandle) {
+        invocationCount++;
+    }
+
+    void *QueryInterface(ComponentID id) override {
+        switch (id) {
+            case IComponent::kID:
+                return static_cast<IComponent*>(this);
+            case IFeature::kID:
+                return static_cast<IFeature*>(this);
+        }
+
+        return nullptr;
+    }
+
+private:
+    /// Number of hook invocations
+    uint64_t invocationCount{0};
+};
+
+/// All layer functions used by the benchmarks
+struct OverheadDispatch {
+    OverheadDispatch(const NullLoader& loader) {
+        createCommandPool = loader.GetDeviceProcAddr<PFN_vkCreateCommandPool>("vkCreateCommandPool");
+        destroyCommandPool = loader.GetDeviceProcAddr<PFN_vkDestroyCommandPool>("vkDestroyCommandPool");
+        allocateCommandBuffers = loader.GetDeviceProcAddr<PFN_vkAllocateCommandBuffers>("vkAllocateCommandBuffers");
+        freeCommandBuffers = loader.GetDeviceProcAddr<PFN_vkFreeCommandBuffers>("vkFreeCommandBuffers");
+        beginCommandBuffer = loader.GetDeviceProcAddr<PFN_vkBeginCommandBuffer>("vkBeginCommandBuffer");
+        endCommandBuffer = loader.GetDeviceProcAddr<PFN_vkEndCommandBuffer>("vkEndCommandBuffer");
+        createDescriptorSetLayout = loader.GetDeviceProcAddr<PFN_vkCreateDescriptorSetLayout>("vkCreateDescriptorSetLayout");
+        destroyDescriptorSetLayout = loader.GetDeviceProcAddr<PFN_vkDestroyDescriptorSetLayout>("vkDestroyDescriptorSetLayout");
+        createPipelineLayout = loader.GetDeviceProcAddr<PFN_vkCreatePipelineLayout>("vkCreatePipelineLayout");
+        destroyPipelineLayout = loader.GetDeviceProcAddr<PFN_vkDestroyPipelineLayout>("vkDestroyPipelineLayout");
+        createDescriptorPool = loader.GetDeviceProcAddr<PFN_vkCreateDescriptorPool>("vkCreateDescriptorPool");
+        destroyDescriptorPool = loader.GetDeviceProcAddr<PFN_vkDestroyDescriptorPool>("vkDestroyDescriptorPool");
+        allocateDescriptorSets = loader.GetDeviceProcAddr<PFN_vkAllocateDescriptorSets>("vkAllocateDescriptorSets");
+        updateDescriptorSets = loader.GetDeviceProcAddr<PFN_vkUpdateDescriptorSets>("vkUpdateDescriptorSets");
+        createShaderModule = loader.GetDeviceProcAddr<PFN_vkCreateShaderModule>("vkCreateShaderModule");
+        destroyShaderModule = loader.GetDeviceProcAddr<PFN_vkDestroyShaderModule>("vkDestroyShaderModule");
+        createComputePipelines = loader.GetDeviceProcAddr<PFN_vkCreateComputePipelines>("vkCreateComputePipelines");
+        createGraphicsPipelines = loader.GetDeviceProcAddr<PFN_vkCreateGraphicsPipelines>("vkCreateGraphicsPipelines");
+        destroyPipeline = loader.GetDeviceProcAddr<PFN_vkDestroyPipeline>("vkDestroyPipeline");
+        createBuffer = loader.GetDeviceProcAddr<PFN_vkCreateBuffer>("vkCreateBuffer");
+        destroyBuffer = loader.GetDeviceProcAddr<PFN_vkDestroyBuffer>("vkDestroyBuffer");
+        createBufferView = loader.GetDeviceProcAddr<PFN_vkCreateBufferView>("vkCreateBufferView");
+        destroyBufferView = loader.GetDeviceProcAddr<PFN_vkDestroyBufferView>("vkDestroyBufferView");
+        createSampler = loader.GetDeviceProcAddr<PFN_vkCreateSampler>("vkCreateSampler");
+        destroySampler = loader.GetDeviceProcAddr<PFN_vkDestroySampler>("vkDestroySampler");
+        cmdBindPipeline = loader.GetDeviceProcAddr<PFN_vkCmdBindPipeline>("vkCmdBindPipeline");
+        cmdBindDescriptorSets = loader.GetDeviceProcAddr<PFN_vkCmdBindDescriptorSets>("vkCmdBindDescriptorSets");
+        cmdDraw = loader.GetDeviceProcAddr<PFN_vkCmdDraw>("vkCmdDraw");
+        cmdDispatch = loader.GetDeviceProcAddr<PFN_vkCmdDispatch>("vkCmdDispatch");
+        queueSubmit = loader.GetDeviceProcAddr<PFN_vkQueueSubmit>("vkQueueSubmit");
+        queueWaitIdle = loader.GetDeviceProcAddr<PFN_vkQueueWaitIdle>("vkQueueWaitIdle");
+    }
+
+    PFN_vkCreateCommandPool            createCommandPool;
+    PFN_vkDestroyCommandPool           destroyCommandPool;
+    PFN_vkAllocateCommandBuffers       allocateCommandBuffers;
+    PFN_vkFreeCommandBuffers           freeCommandBuffers;
+    PFN_vkBeginCommandBuffer           beginCommandBuffer;
+    PFN_vkEndCommandBuffer             endCommandBuffer;
+    PFN_vkCreateDescriptorSetLayout    createDescriptorSetLayout;
+    PFN_vkDestroyDescriptorSetLayout   destroyDescriptorSetLayout;
+    PFN_vkCreatePipelineLayout         createPipelineLayout;
+    PFN_vkDestroyPipelineLayout        destroyPipelineLayout;
+    PFN_vkCreateDescriptorPool         createDescriptorPool;
+    PFN_vkDestroyDescriptorPool        destroyDescriptorPool;
+    PFN_vkAllocateDescriptorSets       allocateDescriptorSets;
+    PFN_vkUpdateDescriptorSets         updateDescriptorSets;
+    PFN_vkCreateShaderModule           createShaderModule;
+    PFN_vkDestroyShaderModule          destroyShaderModule;
+    PFN_vkCreateComputePipelines       createComputePipelines;
+    PFN_vkCreateGraphicsPipelines      createGraphicsPipelines;
+    PFN_vkDestroyPipeline              destroyPipeline;
+    PFN_vkCreateBuffer                 createBuffer;
+    PFN_vkDestroyBuffer                destroyBuffer;
+    PFN_vkCreateBufferView             createBufferView;
+    PFN_vkDestroyBufferView            destroyBufferView;
+    PFN_vkCreateSampler                createSampler;
+    PFN_vkDestroySampler               destroySampler;
+    PFN_vkCmdBindPipeline              cmdBindPipeline;
+    PFN_vkCmdBindDescriptorSets        cmdBindDescriptorSets;
+    PFN_vkCmdDraw                      cmdDraw;
+    PFN_vkCmdDispatch                  cmdDispatch;
+    PFN_vkQueueSubmit                  queueSubmit;
+    PFN_vkQueueWaitIdle                queueWaitIdle;
+};
+
+/// Replay all recording patterns against the current device
+static void BenchmarkOverhead(NullLoader& loader) {
+    OverheadDispatch vk(loader);
+
+    // Device shorthand
+    VkDevice device = loader.GetDevice();
+
+    VkBufferCreateInfo bufferInfo{};
+    bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    bufferInfo.size = sizeof(uint32_t) * 64;
+    bufferInfo.usage = VK_BUFFER_USAGE_STORAGE_TEXEL_BUFFER_BIT;
+
+    VkBuffer buffer;
+    REQUIRE(vk.createBuffer(device, &bufferInfo, nullptr, &buffer) == VK_SUCCESS);
+
+    VkBufferViewCreateInfo bufferViewInfo{};
+    bufferViewInfo.sType = VK_STRUCTURE_TYPE_BUFFER_VIEW_CREATE_INFO;
+    bufferViewInfo.buffer = buffer;
+    bufferViewInfo.format = VK_FORMAT_R32_UINT;
+    bufferViewInfo.range = bufferInfo.size;
+
+    VkBufferView bufferView;
+    REQUIRE(vk.createBufferView(device, &bufferViewInfo, nullptr, &bufferView) == VK_SUCCESS);
+
+    VkSamplerCreateInfo samplerInfo{};
+    samplerInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+
+    VkSampler sampler;
+    REQUIRE(vk.createSampler(device, &samplerInfo, nullptr, &sampler) == VK_SUCCESS);
+
+    // Set 0, per dispatch resources
+    VkDescriptorSetLayoutBinding resourceBinding{};
+    resourceBinding.binding = 0;
+    resourceBinding.descriptorCount = 1;
+    resourceBinding.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER;
+    resourceBinding.stageFlags = VK_SHADER_STAGE_ALL;
+
+    VkDescriptorSetLayoutCreateInfo resourceLayoutInfo{};
+    resourceLayoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+    resourceLayoutInfo.bindingCount = 1;
+    resourceLayoutInfo.pBindings = &resourceBinding;
+
+    // Set 1, bindless samplers
+    VkDescriptorSetLayoutBinding bindlessBinding{};
+    bindlessBinding.binding = 0;
+    bindlessBinding.descriptorCount = kBindlessDescriptorCount;
+    bindlessBinding.descriptorType = VK_DESCRIPTOR_TYPE_SAMPLER;
+    bindlessBinding.stageFlags = VK_SHADER_STAGE_ALL;
+
+    VkDescriptorSetLayoutCreateInfo bindlessLayoutInfo{};
+    bindlessLayoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+    bindlessLayoutInfo.bindingCount = 1;
+    bindlessLayoutInfo.pBindings = &bindlessBinding;
+
+    VkDescriptorSetLayout setLayouts[2];
+    REQUIRE(vk.createDescriptorSetLayout(device, &resourceLayoutInfo, nullptr, &setLayouts[0]) == VK_SUCCESS);
+    REQUIRE(vk.createDescriptorSetLayout(device, &bindlessLayoutInfo, nullptr, &setLayouts[1]) == VK_SUCCESS);
+
+    VkPipelineLayoutCreateInfo layoutInfo{};
+    layoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    layoutInfo.setLayoutCount = 2;
+    layoutInfo.pSetLayouts = setLayouts;
+
+    VkPipelineLayout pipelineLayout;
+    REQUIRE(vk.createPipelineLayout(device, &layoutInfo, nullptr, &pipelineLayout) == VK_SUCCESS);
+
+    VkDescriptorPoolSize poolSizes[2];
+    poolSizes[0].type = VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER;
+    poolSizes[0].descriptorCount = kChurnSetCount;
+    poolSizes[1].type = VK_DESCRIPTOR_TYPE_SAMPLER;
+    poolSizes[1].descriptorCount = kBindlessDescriptorCount;
+
+    VkDescriptorPoolCreateInfo descriptorPoolInfo{};
+    descriptorPoolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    descriptorPoolInfo.maxSets = kChurnSetCount + 1;
+    descriptorPoolInfo.poolSizeCount = 2;
+    descriptorPoolInfo.pPoolSizes = poolSizes;
+
+    VkDescriptorPool descriptorPool;
+    REQUIRE(vk.createDescriptorPool(device, &descriptorPoolInfo, nullptr, &descriptorPool) == VK_SUCCESS);
+
+    // Allocate all churned sets
+    std::vector<VkDescriptorSetLayout> churnLayouts(kChurnSetCount, setLayouts[0]);
+    std::vector<VkDescriptorSet> churnSets(kChurnSetCount);
+
+    VkDescriptorSetAllocateInfo setInfo{};
+    setInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    setInfo.descriptorPool = descriptorPool;
+    setInfo.descriptorSetCount = kChurnSetCount;
+    setInfo.pSetLayouts = churnLayouts.data();
+    REQUIRE(vk.allocateDescriptorSets(device, &setInfo, churnSets.data()) == VK_SUCCESS);
+
+    // Allocate the bindless set
+    VkDescriptorSet bindlessSet;
+    setInfo.descriptorSetCount = 1;
+    setInfo.pSetLayouts = &setLayouts[1];
+    REQUIRE(vk.allocateDescriptorSets(device, &setInfo, &bindlessSet) == VK_SUCCESS);
+
+    // Churn writes, one per set
+    std::vector<VkWriteDescriptorSet> churnWrites(kChurnSetCount);
+    for (uint32_t i = 0; i < kChurnSetCount; i++) {
+        VkWriteDescriptorSet& write = churnWrites[i];
+        write = VkWriteDescriptorSet{VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET};
+        write.dstSet = churnSets[i];
+        write.dstBinding = 0;
+        write.descriptorCount = 1;
+        write.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER;
+        write.pTexelBufferView = &bufferView;
+    }
+
+    // Populate all sets
+    std::vector<VkDescriptorImageInfo> imageInfos(kBindlessDescriptorCount, VkDescriptorImageInfo {
+        .sampler = sampler
+    });
+
+    VkWriteDescriptorSet bindlessWrite{VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET};
+    bindlessWrite.dstSet = bindlessSet;
+    bindlessWrite.dstBinding = 0;
+    bindlessWrite.descriptorCount = kBindlessDescriptorCount;
+    bindlessWrite.descriptorType = VK_DESCRIPTOR_TYPE_SAMPLER;
+    bindlessWrite.pImageInfo = imageInfos.data();
+    vk.updateDescriptorSets(device, 1u, &bindlessWrite, 0u, nullptr);
+    vk.updateDescriptorSets(device, kChurnSetCount, churnWrites.data(), 0u, nullptr);
+
+    VkShaderModuleCreateInfo computeModuleInfo{};
+    computeModuleInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+    computeModuleInfo.codeSize = sizeof(kSPIRVWriteUAVVulkan);
+    computeModuleInfo.pCode = reinterpret_cast<const uint32_t*>(kSPIRVWriteUAVVulkan);
+
+    VkShaderModule computeModule;
+    REQUIRE(vk.createShaderModule(device, &computeModuleInfo, nullptr, &computeModule) == VK_SUCCESS);
+
+    VkShaderModuleCreateInfo vertexModuleInfo{};
+    vertexModuleInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+    vertexModuleInfo.codeSize = sizeof(kVertexCode);
+    vertexModuleInfo.pCode = kVertexCode;
+
+    VkShaderModule vertexModule;
+    REQUIRE(vk.createShaderModule(device, &vertexModuleInfo, nullptr, &vertexModule) == VK_SUCCESS);
+
+    VkComputePipelineCreateInfo computePipelineInfo{};
+    computePipelineInfo.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+    computePipelineInfo.layout = pipelineLayout;
+    computePipelineInfo.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    computePipelineInfo.stage.pName = "main";
+    computePipelineInfo.stage.module = computeModule;
+    computePipelineInfo.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+
+    VkPipeline computePipeline;
+    REQUIRE(vk.createComputePipelines(device, VK_NULL_HANDLE, 1, &computePipelineInfo, nullptr, &computePipeline) == VK_SUCCESS);
+
+    VkPipelineShaderStageCreateInfo vertexStageInfo{};
+    vertexStageInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    vertexStageInfo.pName = "main";
+    vertexStageInfo.module = vertexModule;
+    vertexStageInfo.stage = VK_SHADER_STAGE_VERTEX_BIT;
+
+    VkPipelineVertexInputStateCreateInfo vertexInputInfo{};
+    vertexInputInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+
+    VkPipelineInputAssemblyStateCreateInfo inputAssemblyInfo{};
+    inputAssemblyInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+    inputAssemblyInfo.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+
+    // No rasterization, keeps the remaining states optional
+    VkPipelineRasterizationStateCreateInfo rasterizationInfo{};
+    rasterizationInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+    rasterizationInfo.rasterizerDiscardEnable = VK_TRUE;
+    rasterizationInfo.lineWidth = 1.0f;
+
+    VkGraphicsPipelineCreateInfo graphicsPipelineInfo{};
+    graphicsPipelineInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    graphicsPipelineInfo.stageCount = 1;
+    graphicsPipelineInfo.pStages = &vertexStageInfo;
+    graphicsPipelineInfo.pVertexInputState = &vertexInputInfo;
+    graphicsPipelineInfo.pInputAssemblyState = &inputAssemblyInfo;
+    graphicsPipelineInfo.pRasterizationState = &rasterizationInfo;
+    graphicsPipelineInfo.layout = pipelineLayout;
+
+    VkPipeline graphicsPipeline;
+    REQUIRE(vk.createGraphicsPipelines(device, VK_NULL_HANDLE, 1, &graphicsPipelineInfo, nullptr, &graphicsPipeline) == VK_SUCCESS);
+
+    VkCommandPoolCreateInfo poolInfo{};
+    poolInfo.sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    poolInfo.flags            = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    poolInfo.queueFamilyIndex = loader.GetPrimaryQueueFamily();
+
+    VkCommandPool commandPool;
+    REQUIRE(vk.createCommandPool(device, &poolInfo, nullptr, &commandPool) == VK_SUCCESS);
+
+    VkCommandBufferAllocateInfo allocateInfo{};
+    allocateInfo.sType              = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    allocateInfo.level              = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    allocateInfo.commandPool        = commandPool;
+    allocateInfo.commandBufferCount = 1;
+
+    VkCommandBuffer commandBuffer;
+    REQUIRE(vk.allocateCommandBuffers(device, &allocateInfo, &commandBuffer) == VK_SUCCESS);
+
+    VkCommandBufferBeginInfo beginInfo{};
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+
+    VkSubmitInfo submitInfo{};
+    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submitInfo.commandBufferCount = 1;
+    submitInfo.pCommandBuffers = &commandBuffer;
+
+    // Per call costs, recorded into a single open command buffer
+    {
+        REQUIRE(vk.beginCommandBuffer(commandBuffer, &beginInfo) == VK_SUCCESS);
+
+        BENCHMARK("vkCmdBindPipeline") {
+            vk.cmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, computePipeline);
+        };
+
+        BENCHMARK("vkCmdBindDescriptorSets") {
+            vk.cmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipelineLayout, 0, 1, &churnSets[0], 0, nullptr);
+        };
+
+        BENCHMARK("vkCmdDispatch") {
+            vk.cmdDispatch(commandBuffer, 1, 1, 1);
+        };
+
+        vk.cmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, graphicsPipeline);
+        vk.cmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout, 0, 1, &churnSets[0], 0, nullptr);
+
+        BENCHMARK("vkCmdDraw") {
+            vk.cmdDraw(commandBuffer, 3, 1, 0, 0);
+        };
+
+        REQUIRE(vk.endCommandBuffer(commandBuffer) == VK_SUCCESS);
+    }
+
+    BENCHMARK("vkUpdateDescriptorSets") {
+        vk.updateDescriptorSets(device, 1u, &churnWrites[0], 0u, nullptr);
+    };
+
+    BENCHMARK("vkQueueSubmit") {
+        return vk.queueSubmit(loader.GetPrimaryQueue(), 1u, &submitInfo, VK_NULL_HANDLE);
+    };
+
+    // Retire all submissions before re-recording
+    REQUIRE(vk.queueWaitIdle(loader.GetPrimaryQueue()) == VK_SUCCESS);
+
+    // Many small draws against the same state
+    BENCHMARK("Pattern, Small Draws (x1024)") {
+        vk.beginCommandBuffer(commandBuffer, &beginInfo);
+        vk.cmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, graphicsPipeline);
+        vk.cmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout, 0, 1, &churnSets[0], 0, nullptr);
+
+        for (uint32_t i = 0; i < kPatternCommandCount; i++) {
+            vk.cmdDraw(commandBuffer, 3, 1, 0, i);
+        }
+
+        return vk.endCommandBuffer(commandBuffer);
+    };
+
+    // Bindless, all resources bound once and indexed in shaders
+    BENCHMARK("Pattern, Bindless Dispatches (x1024)") {
+        VkDescriptorSet sets[] = { churnSets[0], bindlessSet };
+
+        vk.beginCommandBuffer(commandBuffer, &beginInfo);
+        vk.cmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, computePipeline);
+        vk.cmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipelineLayout, 0, 2, sets, 0, nullptr);
+
+        for (uint32_t i = 0; i < kPatternCommandCount; i++) {
+            vk.cmdDispatch(commandBuffer, 1, 1, 1);
+        }
+
+        return vk.endCommandBuffer(commandBuffer);
+    };
+
+    // Heavy descriptor churn, every dispatch rewrites and rebinds its resources
+    BENCHMARK("Pattern, Descriptor Churn (x256)") {
+        vk.updateDescriptorSets(device, kChurnSetCount, churnWrites.data(), 0u, nullptr);
+
+        vk.beginCommandBuffer(commandBuffer, &beginInfo);
+        vk.cmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, computePipeline);
+
+        for (uint32_t i = 0; i < kChurnSetCount; i++) {
+            vk.cmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipelineLayout, 0, 1, &churnSets[i], 0, nullptr);
+            vk.cmdDispatch(commandBuffer, 1, 1, 1);
+        }
+
+        return vk.endCommandBuffer(commandBuffer);
+    };
+
+    // Release handles
+    vk.freeCommandBuffers(device, commandPool, 1, &commandBuffer);
+    vk.destroyCommandPool(device, commandPool, nullptr);
+    vk.destroyPipeline(device, graphicsPipeline, nullptr);
+    vk.destroyPipeline(device, computePipeline, nullptr);
+    vk.destroyShaderModule(device, vertexModule, nullptr);
+    vk.destroyShaderModule(device, computeModule, nullptr);
+    vk.destroyDescriptorPool(device, descriptorPool, nullptr);
+    vk.destroyPipelineLayout(device, pipelineLayout, nullptr);
+    vk.destroyDescriptorSetLayout(device, setLayouts[0], nullptr);
+    vk.destroyDescriptorSetLayout(device, setLayouts[1], nullptr);
+    vk.destroySampler(device, sampler, nullptr);
+    vk.destroyBufferView(device, bufferView, nullptr);
+    vk.destroyBuffer(device, buffer, nullptr);
+}
+
+TEST_CASE_METHOD(NullLoader, "Layer.Overhead.Performance", "[Vulkan]") {
+    SECTION("Features Off")
+    {
+        CreateInstance();
+        CreateDevice();
+
+        BenchmarkOverhead(*this);
+    }
+
+    SECTION("Features On")
+    {
+        Registry* registry = GetRegistry();
+
+        // Subscribe to all hooks
+        auto host = registry->Get<IFeatureHost>();
+        host->Register(registry->New<ComponentTemplate<OverheadFeature>>());
+
+        CreateInstance();
+        CreateDevice();
+
+        MessageStream stream;
+        {
+            MessageStreamView view(stream);
+
+            // Make the recording wait for compilation
+            auto config = view.Add<SetApplicationInstrumentationConfigMessage>();
+            config->synchronousRecording = 1;
+
+            // Global instrumentation
+            auto msg = view.Add<SetGlobalInstrumentationMessage>();
+            msg->featureBitSet = ~0ull;
+        }
+
+        // Commit instrumentation
+        auto bridge = registry->Get<IBridge>();
+        bridge->GetOutput()->AddStream(stream);
+        bridge->Commit();
+
+        BenchmarkOverhead(*this);
+    }
+}
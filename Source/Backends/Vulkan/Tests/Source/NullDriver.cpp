@@ -0,0 +1,567 @@
+// 
+// The MIT License (MIT)
+// 
+// Copyright (c) 2024 Advanced Micro Devices, Inc.,
+// Fatalist Development AB (Avalanche Studio Group),
+// and Miguel Petersen.
+// 
+// All Rights Reserved.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy 
+// of this software and associated documentation files (the "Software"), to deal 
+// in the Software without restriction, including without limitation the rights 
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies 
+// of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, 
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#include <NullDriver.h>
+
+// Std
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <mutex>
+
+/// Number of exposed memory types
+static constexpr uint32_t kNullMemoryTypeCount = 3;
+
+/// Size of each memory heap, kept small for small allocator blocks
+static constexpr VkDeviceSize kNullHeapSize = 512ull * 1024 * 1024;
+
+/// Fake non-dispatchable handle allocator, zero is reserved
+static std::atomic<uint64_t> NullHandleCounter{1};
+
+/// Physical device, dispatches through the instance
+struct NullPhysicalDevice {
+    void* key;
+};
+
+/// Instance, all dispatchable objects reserve the first word for the dispatch key
+struct NullInstance {
+    void* key;
+
+    /// Single physical device
+    NullPhysicalDevice physicalDevice;
+};
+
+/// Queue, dispatches through the device
+struct NullQueue {
+    void* key;
+};
+
+/// Command buffer, dispatches through the device
+struct NullCommandBuffer {
+    void* key;
+};
+
+/// Device
+struct NullDevice {
+    void* key;
+
+    /// All queues, (family, index) packed
+    std::mutex mutex;
+    std::map<uint64_t, NullQueue*> queues;
+};
+
+/// Buffer, sized for the memory requirements
+struct NullBuffer {
+    VkDeviceSize size;
+};
+
+/// Image, sized for the memory requirements
+struct NullImage {
+    VkDeviceSize size;
+};
+
+/// Memory, host backed on first map
+struct NullMemory {
+    VkDeviceSize size;
+    void* data{nullptr};
+};
+
+/// Enable all features of a feature structure
+template<typename T>
+static void EnableAllFeatures(T* features) {
+    auto* begin = reinterpret_cast<VkBool32*>(reinterpret_cast<uint8_t*>(features) + sizeof(VkBaseOutStructure));
+    auto* end   = reinterpret_cast<VkBool32*>(reinterpret_cast<uint8_t*>(features) + sizeof(T));
+    std::fill(begin, end, VK_TRUE);
+}
+
+/// Fill the memory requirements of a resource
+static void FillMemoryRequirements(VkDeviceSize size, VkMemoryRequirements* pMemoryRequirements) {
+    pMemoryRequirements->size = std::max<VkDeviceSize>(size, 256u);
+    pMemoryRequirements->alignment = 256u;
+    pMemoryRequirements->memoryTypeBits = (1u << kNullMemoryTypeCount) - 1u;
+}
+
+/// Default function, returned for all functions without outputs
+///   ? Parameters are caller cleaned on all supported x64 conventions, so a parameterless
+///     function may stand in for any signature, void functions ignore the result
+static VKAPI_ATTR VkResult VKAPI_CALL NullDriver_Success() {
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL NullDriver_vkCreateInstance(const VkInstanceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkInstance* pInstance) {
+    auto* instance = new NullInstance;
+    instance->key = instance;
+    instance->physicalDevice.key = instance;
+
+    // OK
+    *pInstance = reinterpret_cast<VkInstance>(instance);
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL NullDriver_vkDestroyInstance(VkInstance instance, const VkAllocationCallbacks* pAllocator) {
+    delete reinterpret_cast<NullInstance*>(instance);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL NullDriver_vkEnumeratePhysicalDevices(VkInstance instance, uint32_t* pPhysicalDeviceCount, VkPhysicalDevice* pPhysicalDevices) {
+    if (!pPhysicalDevices) {
+        *pPhysicalDeviceCount = 1u;
+        return VK_SUCCESS;
+    }
+
+    // Enough space?
+    if (*pPhysicalDeviceCount < 1u) {
+        return VK_INCOMPLETE;
+    }
+
+    // OK
+    *pPhysicalDeviceCount = 1u;
+    pPhysicalDevices[0] = reinterpret_cast<VkPhysicalDevice>(&reinterpret_cast<NullInstance*>(instance)->physicalDevice);
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL NullDriver_vkGetPhysicalDeviceProperties(VkPhysicalDevice physicalDevice, VkPhysicalDeviceProperties* pProperties) {
+    *pProperties = {};
+    pProperties->apiVersion = VK_API_VERSION_1_2;
+    pProperties->driverVersion = 1u;
+    pProperties->deviceType = VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU;
+    strcpy_s(pProperties->deviceName, "Null Driver");
+
+    // Generous limits
+    VkPhysicalDeviceLimits& limits = pProperties->limits;
+    limits.maxImageDimension1D = 16384u;
+    limits.maxImageDimension2D = 16384u;
+    limits.maxImageDimension3D = 2048u;
+    limits.maxImageDimensionCube = 16384u;
+    limits.maxImageArrayLayers = 2048u;
+    limits.maxTexelBufferElements = 1u << 27u;
+    limits.maxUniformBufferRange = 1u << 16u;
+    limits.maxStorageBufferRange = UINT32_MAX;
+    limits.maxPushConstantsSize = 256u;
+    limits.maxMemoryAllocationCount = UINT32_MAX;
+    limits.maxSamplerAllocationCount = UINT32_MAX;
+    limits.bufferImageGranularity = 1u;
+    limits.maxBoundDescriptorSets = 32u;
+    limits.maxPerStageDescriptorSamplers = UINT32_MAX;
+    limits.maxPerStageDescriptorUniformBuffers = UINT32_MAX;
+    limits.maxPerStageDescriptorStorageBuffers = UINT32_MAX;
+    limits.maxPerStageDescriptorSampledImages = UINT32_MAX;
+    limits.maxPerStageDescriptorStorageImages = UINT32_MAX;
+    limits.maxPerStageResources = UINT32_MAX;
+    limits.maxDescriptorSetSamplers = UINT32_MAX;
+    limits.maxDescriptorSetUniformBuffers = UINT32_MAX;
+    limits.maxDescriptorSetUniformBuffersDynamic = 64u;
+    limits.maxDescriptorSetStorageBuffers = UINT32_MAX;
+    limits.maxDescriptorSetStorageBuffersDynamic = 64u;
+    limits.maxDescriptorSetSampledImages = UINT32_MAX;
+    limits.maxDescriptorSetStorageImages = UINT32_MAX;
+    limits.maxComputeWorkGroupCount[0] = limits.maxComputeWorkGroupCount[1] = limits.maxComputeWorkGroupCount[2] = UINT32_MAX;
+    limits.maxComputeWorkGroupInvocations = 1024u;
+    limits.maxComputeWorkGroupSize[0] = limits.maxComputeWorkGroupSize[1] = 1024u;
+    limits.maxComputeWorkGroupSize[2] = 64u;
+    limits.maxDrawIndexedIndexValue = UINT32_MAX;
+    limits.maxDrawIndirectCount = UINT32_MAX;
+    limits.maxViewports = 16u;
+    limits.maxViewportDimensions[0] = limits.maxViewportDimensions[1] = 16384u;
+    limits.maxFramebufferWidth = limits.maxFramebufferHeight = 16384u;
+    limits.maxFramebufferLayers = 2048u;
+    limits.maxColorAttachments = 8u;
+    limits.minMemoryMapAlignment = 64u;
+    limits.minTexelBufferOffsetAlignment = 16u;
+    limits.minUniformBufferOffsetAlignment = 256u;
+    limits.minStorageBufferOffsetAlignment = 16u;
+    limits.optimalBufferCopyOffsetAlignment = 1u;
+    limits.optimalBufferCopyRowPitchAlignment = 1u;
+    limits.nonCoherentAtomSize = 64u;
+    limits.timestampPeriod = 1.0f;
+}
+
+static VKAPI_ATTR void VKAPI_CALL NullDriver_vkGetPhysicalDeviceProperties2(VkPhysicalDevice physicalDevice, VkPhysicalDeviceProperties2* pProperties) {
+    NullDriver_vkGetPhysicalDeviceProperties(physicalDevice, &pProperties->properties);
+}
+
+static VKAPI_ATTR void VKAPI_CALL NullDriver_vkGetPhysicalDeviceFeatures(VkPhysicalDevice physicalDevice, VkPhysicalDeviceFeatures* pFeatures) {
+    std::fill(reinterpret_cast<VkBool32*>(pFeatures), reinterpret_cast<VkBool32*>(pFeatures + 1), VK_TRUE);
+}
+
+static VKAPI_ATTR void VKAPI_CALL NullDriver_vkGetPhysicalDeviceFeatures2(VkPhysicalDevice physicalDevice, VkPhysicalDeviceFeatures2* pFeatures) {
+    NullDriver_vkGetPhysicalDeviceFeatures(physicalDevice, &pFeatures->features);
+
+    // Enable all known extended features
+    for (auto* it = static_cast<VkBaseOutStructure*>(pFeatures->pNext); it; it = it->pNext) {
+        switch (it->sType) {
+            default:
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES:
+                EnableAllFeatures(reinterpret_cast<VkPhysicalDeviceDescriptorIndexingFeatures*>(it));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ROBUSTNESS_2_FEATURES_EXT:
+                EnableAllFeatures(reinterpret_cast<VkPhysicalDeviceRobustness2FeaturesEXT*>(it));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_FEATURES:
+                EnableAllFeatures(reinterpret_cast<VkPhysicalDeviceVulkan11Features*>(it));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES:
+                EnableAllFeatures(reinterpret_cast<VkPhysicalDeviceVulkan12Features*>(it));
+                break;
+        }
+    }
+}
+
+static VKAPI_ATTR void VKAPI_CALL NullDriver_vkGetPhysicalDeviceMemoryProperties(VkPhysicalDevice physicalDevice, VkPhysicalDeviceMemoryProperties* pMemoryProperties) {
+    *pMemoryProperties = {};
+
+    // Device and host heaps
+    pMemoryProperties->memoryHeapCount = 2u;
+    pMemoryProperties->memoryHeaps[0] = {kNullHeapSize, VK_MEMORY_HEAP_DEVICE_LOCAL_BIT};
+    pMemoryProperties->memoryHeaps[1] = {kNullHeapSize, 0u};
+
+    // Device local, host coherent and host cached
+    pMemoryProperties->memoryTypeCount = kNullMemoryTypeCount;
+    pMemoryProperties->memoryTypes[0] = {VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, 0u};
+    pMemoryProperties->memoryTypes[1] = {VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, 1u};
+    pMemoryProperties->memoryTypes[2] = {VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT, 1u};
+}
+
+static VKAPI_ATTR void VKAPI_CALL NullDriver_vkGetPhysicalDeviceMemoryProperties2(VkPhysicalDevice physicalDevice, VkPhysicalDeviceMemoryProperties2* pMemoryProperties) {
+    NullDriver_vkGetPhysicalDeviceMemoryProperties(physicalDevice, &pMemoryProperties->memoryProperties);
+}
+
+static VKAPI_ATTR void VKAPI_CALL NullDriver_vkGetPhysicalDeviceQueueFamilyProperties(VkPhysicalDevice physicalDevice, uint32_t* pQueueFamilyPropertyCount, VkQueueFamilyProperties* pQueueFamilyProperties) {
+    if (!pQueueFamilyProperties) {
+        *pQueueFamilyPropertyCount = 1u;
+        return;
+    }
+
+    // Single universal family
+    *pQueueFamilyPropertyCount = std::min(*pQueueFamilyPropertyCount, 1u);
+    if (*pQueueFamilyPropertyCount) {
+        pQueueFamilyProperties[0] = {};
+        pQueueFamilyProperties[0].queueFlags = VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT;
+        pQueueFamilyProperties[0].queueCount = 16u;
+        pQueueFamilyProperties[0].timestampValidBits = 64u;
+        pQueueFamilyProperties[0].minImageTransferGranularity = {1u, 1u, 1u};
+    }
+}
+
+static VKAPI_ATTR void VKAPI_CALL NullDriver_vkGetPhysicalDeviceFormatProperties(VkPhysicalDevice physicalDevice, VkFormat format, VkFormatProperties* pFormatProperties) {
+    pFormatProperties->linearTilingFeatures = ~0u;
+    pFormatProperties->optimalTilingFeatures = ~0u;
+    pFormatProperties->bufferFeatures = ~0u;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL NullDriver_vkEnumerateDeviceLayerProperties(VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkLayerProperties* pProperties) {
+    *pPropertyCount = 0u;
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL NullDriver_vkEnumerateDeviceExtensionProperties(VkPhysicalDevice physicalDevice, const char* pLayerName, uint32_t* pPropertyCount, VkExtensionProperties* pProperties) {
+    *pPropertyCount = 0u;
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL NullDriver_vkCreateDevice(VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDevice* pDevice) {
+    auto* device = new NullDevice;
+    device->key = device;
+
+    // OK
+    *pDevice = reinterpret_cast<VkDevice>(device);
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL NullDriver_vkDestroyDevice(VkDevice device, const VkAllocationCallbacks* pAllocator) {
+    auto* nullDevice = reinterpret_cast<NullDevice*>(device);
+
+    // Release all queues
+    for (auto&& [key, queue] : nullDevice->queues) {
+        delete queue;
+    }
+
+    delete nullDevice;
+}
+
+static VKAPI_ATTR void VKAPI_CALL NullDriver_vkGetDeviceQueue(VkDevice device, uint32_t queueFamilyIndex, uint32_t queueIndex, VkQueue* pQueue) {
+    auto* nullDevice = reinterpret_cast<NullDevice*>(device);
+    std::lock_guard guard(nullDevice->mutex);
+
+    // Create on first request
+    NullQueue*& queue = nullDevice->queues[(static_cast<uint64_t>(queueFamilyIndex) << 32u) | queueIndex];
+    if (!queue) {
+        queue = new NullQueue;
+        queue->key = nullDevice->key;
+    }
+
+    // OK
+    *pQueue = reinterpret_cast<VkQueue>(queue);
+}
+
+static VKAPI_ATTR void VKAPI_CALL NullDriver_vkGetDeviceQueue2(VkDevice device, const VkDeviceQueueInfo2* pQueueInfo, VkQueue* pQueue) {
+    NullDriver_vkGetDeviceQueue(device, pQueueInfo->queueFamilyIndex, pQueueInfo->queueIndex, pQueue);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL NullDriver_vkAllocateCommandBuffers(VkDevice device, const VkCommandBufferAllocateInfo* pAllocateInfo, VkCommandBuffer* pCommandBuffers) {
+    for (uint32_t i = 0; i < pAllocateInfo->commandBufferCount; i++) {
+        auto* commandBuffer = new NullCommandBuffer;
+        commandBuffer->key = reinterpret_cast<NullDevice*>(device)->key;
+        pCommandBuffers[i] = reinterpret_cast<VkCommandBuffer>(commandBuffer);
+    }
+
+    // OK
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL NullDriver_vkFreeCommandBuffers(VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount, const VkCommandBuffer* pCommandBuffers) {
+    for (uint32_t i = 0; i < commandBufferCount; i++) {
+        delete reinterpret_cast<NullCommandBuffer*>(pCommandBuffers[i]);
+    }
+}
+
+/// Generic object creation, shared by all create functions of the form (device, info, allocator, handle)
+///   ? Non-dispatchable handles are 64 bit on all supported targets
+static VKAPI_ATTR VkResult VKAPI_CALL NullDriver_CreateHandle(VkDevice device, const void* pCreateInfo, const VkAllocationCallbacks* pAllocator, uint64_t* pHandle) {
+    *pHandle = NullHandleCounter++;
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL NullDriver_vkAllocateDescriptorSets(VkDevice device, const VkDescriptorSetAllocateInfo* pAllocateInfo, VkDescriptorSet* pDescriptorSets) {
+    for (uint32_t i = 0; i < pAllocateInfo->descriptorSetCount; i++) {
+        pDescriptorSets[i] = reinterpret_cast<VkDescriptorSet>(NullHandleCounter++);
+    }
+
+    // OK
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL NullDriver_vkCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkGraphicsPipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) {
+    for (uint32_t i = 0; i < createInfoCount; i++) {
+        pPipelines[i] = reinterpret_cast<VkPipeline>(NullHandleCounter++);
+    }
+
+    // OK
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL NullDriver_vkCreateComputePipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkComputePipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) {
+    for (uint32_t i = 0; i < createInfoCount; i++) {
+        pPipelines[i] = reinterpret_cast<VkPipeline>(NullHandleCounter++);
+    }
+
+    // OK
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL NullDriver_vkCreateBuffer(VkDevice device, const VkBufferCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkBuffer* pBuffer) {
+    *pBuffer = reinterpret_cast<VkBuffer>(new NullBuffer{pCreateInfo->size});
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL NullDriver_vkDestroyBuffer(VkDevice device, VkBuffer buffer, const VkAllocationCallbacks* pAllocator) {
+    delete reinterpret_cast<NullBuffer*>(buffer);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL NullDriver_vkCreateImage(VkDevice device, const VkImageCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkImage* pImage) {
+    // Conservative size, assume the widest texel
+    VkDeviceSize size = 16u;
+    size *= pCreateInfo->extent.width;
+    size *= pCreateInfo->extent.height;
+    size *= pCreateInfo->extent.depth;
+    size *= pCreateInfo->arrayLayers;
+
+    // OK
+    *pImage = reinterpret_cast<VkImage>(new NullImage{size * 2u});
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL NullDriver_vkDestroyImage(VkDevice device, VkImage image, const VkAllocationCallbacks* pAllocator) {
+    delete reinterpret_cast<NullImage*>(image);
+}
+
+static VKAPI_ATTR void VKAPI_CALL NullDriver_vkGetBufferMemoryRequirements(VkDevice device, VkBuffer buffer, VkMemoryRequirements* pMemoryRequirements) {
+    FillMemoryRequirements(reinterpret_cast<NullBuffer*>(buffer)->size, pMemoryRequirements);
+}
+
+static VKAPI_ATTR void VKAPI_CALL NullDriver_vkGetBufferMemoryRequirements2(VkDevice device, const VkBufferMemoryRequirementsInfo2* pInfo, VkMemoryRequirements2* pMemoryRequirements) {
+    FillMemoryRequirements(reinterpret_cast<NullBuffer*>(pInfo->buffer)->size, &pMemoryRequirements->memoryRequirements);
+}
+
+static VKAPI_ATTR void VKAPI_CALL NullDriver_vkGetImageMemoryRequirements(VkDevice device, VkImage image, VkMemoryRequirements* pMemoryRequirements) {
+    FillMemoryRequirements(reinterpret_cast<NullImage*>(image)->size, pMemoryRequirements);
+}
+
+static VKAPI_ATTR void VKAPI_CALL NullDriver_vkGetImageMemoryRequirements2(VkDevice device, const VkImageMemoryRequirementsInfo2* pInfo, VkMemoryRequirements2* pMemoryRequirements) {
+    FillMemoryRequirements(reinterpret_cast<NullImage*>(pInfo->image)->size, &pMemoryRequirements->memoryRequirements);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL NullDriver_vkAllocateMemory(VkDevice device, const VkMemoryAllocateInfo* pAllocateInfo, const VkAllocationCallbacks* pAllocator, VkDeviceMemory* pMemory) {
+    *pMemory = reinterpret_cast<VkDeviceMemory>(new NullMemory{pAllocateInfo->allocationSize});
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL NullDriver_vkFreeMemory(VkDevice device, VkDeviceMemory memory, const VkAllocationCallbacks* pAllocator) {
+    auto* nullMemory = reinterpret_cast<NullMemory*>(memory);
+    if (!nullMemory) {
+        return;
+    }
+
+    // Release host backing
+    std::free(nullMemory->data);
+    delete nullMemory;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL NullDriver_vkMapMemory(VkDevice device, VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize size, VkMemoryMapFlags flags, void** ppData) {
+    auto* nullMemory = reinterpret_cast<NullMemory*>(memory);
+
+    // Back on first map, most device memory is never mapped
+    if (!nullMemory->data) {
+        nullMemory->data = std::calloc(1u, static_cast<size_t>(nullMemory->size));
+        if (!nullMemory->data) {
+            return VK_ERROR_OUT_OF_HOST_MEMORY;
+        }
+    }
+
+    // OK
+    *ppData = static_cast<uint8_t*>(nullMemory->data) + offset;
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL NullDriver_vkGetSwapchainImagesKHR(VkDevice device, VkSwapchainKHR swapchain, uint32_t* pSwapchainImageCount, VkImage* pSwapchainImages) {
+    *pSwapchainImageCount = 0u;
+    return VK_SUCCESS;
+}
+
+/// Named function entry
+struct NullDriverEntry {
+    const char* name;
+    PFN_vkVoidFunction function;
+};
+
+/// Helper for entry declarations
+#define NULL_DRIVER_ENTRY(NAME, FUNCTION) NullDriverEntry { NAME, reinterpret_cast<PFN_vkVoidFunction>(&FUNCTION) }
+
+/// All instance functions with outputs
+static const NullDriverEntry kInstanceEntries[] = {
+    NULL_DRIVER_ENTRY("vkCreateInstance", NullDriver_vkCreateInstance),
+    NULL_DRIVER_ENTRY("vkDestroyInstance", NullDriver_vkDestroyInstance),
+    NULL_DRIVER_ENTRY("vkEnumeratePhysicalDevices", NullDriver_vkEnumeratePhysicalDevices),
+    NULL_DRIVER_ENTRY("vkGetPhysicalDeviceProperties", NullDriver_vkGetPhysicalDeviceProperties),
+    NULL_DRIVER_ENTRY("vkGetPhysicalDeviceProperties2", NullDriver_vkGetPhysicalDeviceProperties2),
+    NULL_DRIVER_ENTRY("vkGetPhysicalDeviceProperties2KHR", NullDriver_vkGetPhysicalDeviceProperties2),
+    NULL_DRIVER_ENTRY("vkGetPhysicalDeviceFeatures", NullDriver_vkGetPhysicalDeviceFeatures),
+    NULL_DRIVER_ENTRY("vkGetPhysicalDeviceFeatures2", NullDriver_vkGetPhysicalDeviceFeatures2),
+    NULL_DRIVER_ENTRY("vkGetPhysicalDeviceFeatures2KHR", NullDriver_vkGetPhysicalDeviceFeatures2),
+    NULL_DRIVER_ENTRY("vkGetPhysicalDeviceMemoryProperties", NullDriver_vkGetPhysicalDeviceMemoryProperties),
+    NULL_DRIVER_ENTRY("vkGetPhysicalDeviceMemoryProperties2", NullDriver_vkGetPhysicalDeviceMemoryProperties2),
+    NULL_DRIVER_ENTRY("vkGetPhysicalDeviceMemoryProperties2KHR", NullDriver_vkGetPhysicalDeviceMemoryProperties2),
+    NULL_DRIVER_ENTRY("vkGetPhysicalDeviceQueueFamilyProperties", NullDriver_vkGetPhysicalDeviceQueueFamilyProperties),
+    NULL_DRIVER_ENTRY("vkGetPhysicalDeviceFormatProperties", NullDriver_vkGetPhysicalDeviceFormatProperties),
+    NULL_DRIVER_ENTRY("vkEnumerateDeviceLayerProperties", NullDriver_vkEnumerateDeviceLayerProperties),
+    NULL_DRIVER_ENTRY("vkEnumerateDeviceExtensionProperties", NullDriver_vkEnumerateDeviceExtensionProperties),
+    NULL_DRIVER_ENTRY("vkCreateDevice", NullDriver_vkCreateDevice),
+    NULL_DRIVER_ENTRY("vkGetInstanceProcAddr", NullDriver_vkGetInstanceProcAddr),
+};
+
+/// All device functions with outputs
+static const NullDriverEntry kDeviceEntries[] = {
+    NULL_DRIVER_ENTRY("vkGetDeviceProcAddr", NullDriver_vkGetDeviceProcAddr),
+    NULL_DRIVER_ENTRY("vkDestroyDevice", NullDriver_vkDestroyDevice),
+    NULL_DRIVER_ENTRY("vkGetDeviceQueue", NullDriver_vkGetDeviceQueue),
+    NULL_DRIVER_ENTRY("vkGetDeviceQueue2", NullDriver_vkGetDeviceQueue2),
+    NULL_DRIVER_ENTRY("vkAllocateCommandBuffers", NullDriver_vkAllocateCommandBuffers),
+    NULL_DRIVER_ENTRY("vkFreeCommandBuffers", NullDriver_vkFreeCommandBuffers),
+    NULL_DRIVER_ENTRY("vkAllocateDescriptorSets", NullDriver_vkAllocateDescriptorSets),
+    NULL_DRIVER_ENTRY("vkCreateGraphicsPipelines", NullDriver_vkCreateGraphicsPipelines),
+    NULL_DRIVER_ENTRY("vkCreateComputePipelines", NullDriver_vkCreateComputePipelines),
+    NULL_DRIVER_ENTRY("vkCreateBuffer", NullDriver_vkCreateBuffer),
+    NULL_DRIVER_ENTRY("vkDestroyBuffer", NullDriver_vkDestroyBuffer),
+    NULL_DRIVER_ENTRY("vkCreateImage", NullDriver_vkCreateImage),
+    NULL_DRIVER_ENTRY("vkDestroyImage", NullDriver_vkDestroyImage),
+    NULL_DRIVER_ENTRY("vkGetBufferMemoryRequirements", NullDriver_vkGetBufferMemoryRequirements),
+    NULL_DRIVER_ENTRY("vkGetBufferMemoryRequirements2", NullDriver_vkGetBufferMemoryRequirements2),
+    NULL_DRIVER_ENTRY("vkGetBufferMemoryRequirements2KHR", NullDriver_vkGetBufferMemoryRequirements2),
+    NULL_DRIVER_ENTRY("vkGetImageMemoryRequirements", NullDriver_vkGetImageMemoryRequirements),
+    NULL_DRIVER_ENTRY("vkGetImageMemoryRequirements2", NullDriver_vkGetImageMemoryRequirements2),
+    NULL_DRIVER_ENTRY("vkGetImageMemoryRequirements2KHR", NullDriver_vkGetImageMemoryRequirements2),
+    NULL_DRIVER_ENTRY("vkAllocateMemory", NullDriver_vkAllocateMemory),
+    NULL_DRIVER_ENTRY("vkFreeMemory", NullDriver_vkFreeMemory),
+    NULL_DRIVER_ENTRY("vkMapMemory", NullDriver_vkMapMemory),
+    NULL_DRIVER_ENTRY("vkGetSwapchainImagesKHR", NullDriver_vkGetSwapchainImagesKHR),
+
+    // Generic creation
+    NULL_DRIVER_ENTRY("vkCreateCommandPool", NullDriver_CreateHandle),
+    NULL_DRIVER_ENTRY("vkCreateShaderModule", NullDriver_CreateHandle),
+    NULL_DRIVER_ENTRY("vkCreateFence", NullDriver_CreateHandle),
+    NULL_DRIVER_ENTRY("vkCreateSemaphore", NullDriver_CreateHandle),
+    NULL_DRIVER_ENTRY("vkCreateEvent", NullDriver_CreateHandle),
+    NULL_DRIVER_ENTRY("vkCreateQueryPool", NullDriver_CreateHandle),
+    NULL_DRIVER_ENTRY("vkCreateBufferView", NullDriver_CreateHandle),
+    NULL_DRIVER_ENTRY("vkCreateImageView", NullDriver_CreateHandle),
+    NULL_DRIVER_ENTRY("vkCreateSampler", NullDriver_CreateHandle),
+    NULL_DRIVER_ENTRY("vkCreateDescriptorPool", NullDriver_CreateHandle),
+    NULL_DRIVER_ENTRY("vkCreateDescriptorSetLayout", NullDriver_CreateHandle),
+    NULL_DRIVER_ENTRY("vkCreateDescriptorUpdateTemplate", NullDriver_CreateHandle),
+    NULL_DRIVER_ENTRY("vkCreateDescriptorUpdateTemplateKHR", NullDriver_CreateHandle),
+    NULL_DRIVER_ENTRY("vkCreatePipelineLayout", NullDriver_CreateHandle),
+    NULL_DRIVER_ENTRY("vkCreatePipelineCache", NullDriver_CreateHandle),
+    NULL_DRIVER_ENTRY("vkCreateRenderPass", NullDriver_CreateHandle),
+    NULL_DRIVER_ENTRY("vkCreateRenderPass2", NullDriver_CreateHandle),
+    NULL_DRIVER_ENTRY("vkCreateRenderPass2KHR", NullDriver_CreateHandle),
+    NULL_DRIVER_ENTRY("vkCreateFramebuffer", NullDriver_CreateHandle),
+    NULL_DRIVER_ENTRY("vkCreateSwapchainKHR", NullDriver_CreateHandle),
+    NULL_DRIVER_ENTRY("vkCreatePrivateDataSlot", NullDriver_CreateHandle),
+    NULL_DRIVER_ENTRY("vkCreatePrivateDataSlotEXT", NullDriver_CreateHandle),
+};
+
+/// Find an entry
+template<size_t N>
+static PFN_vkVoidFunction FindEntry(const NullDriverEntry (&entries)[N], const char* pName) {
+    for (const NullDriverEntry& entry : entries) {
+        if (!std::strcmp(entry.name, pName)) {
+            return entry.function;
+        }
+    }
+
+    // Not found
+    return nullptr;
+}
+
+VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL NullDriver_vkGetInstanceProcAddr(VkInstance instance, const char* pName) {
+    if (PFN_vkVoidFunction function = FindEntry(kInstanceEntries, pName)) {
+        return function;
+    }
+
+    // Instances may query device functions
+    return NullDriver_vkGetDeviceProcAddr(VK_NULL_HANDLE, pName);
+}
+
+VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL NullDriver_vkGetDeviceProcAddr(VkDevice device, const char* pName) {
+    if (PFN_vkVoidFunction function = FindEntry(kDeviceEntries, pName)) {
+        return function;
+    }
+
+    // Everything else is a no-op
+    return reinterpret_cast<PFN_vkVoidFunction>(&NullDriver_Success);
+}
@@ -0,0 +1,141 @@
+// 
+// The MIT License (MIT)
+// 
+// Copyright (c) 2024 Advanced Micro Devices, Inc.,
+// Fatalist Development AB (Avalanche Studio Group),
+// and Miguel Petersen.
+// 
+// All Rights Reserved.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy 
+// of this software and associated documentation files (the "Software"), to deal 
+// in the Software without restriction, including without limitation the rights 
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies 
+// of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, 
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#include <NullLoader.h>
+#include <NullDriver.h>
+
+// Backend
+#include <Backend/EnvironmentInfo.h>
+
+// Layer
+#include <Backends/Vulkan/Layer.h>
+
+// Vulkan
+#include <vulkan/vk_layer.h>
+
+// Layer exports, linked directly
+extern "C" {
+    VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL Hook_vkGetInstanceProcAddr(VkInstance instance, const char *pName);
+    VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL Hook_vkGetDeviceProcAddr(VkDevice device, const char *pName);
+}
+
+NullLoader::NullLoader() {
+    layerGetInstanceProcAddr = Hook_vkGetInstanceProcAddr;
+    layerGetDeviceProcAddr = Hook_vkGetDeviceProcAddr;
+
+    // Load the environment
+    Backend::EnvironmentInfo info{};
+    info.loadPlugins = false;
+    info.memoryBridge = true;
+    environment.Install(info);
+}
+
+void NullLoader::CreateInstance() {
+    // General app info
+    VkApplicationInfo applicationInfo{};
+    applicationInfo.sType            = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+    applicationInfo.apiVersion       = VK_API_VERSION_1_2;
+    applicationInfo.pApplicationName = "GPUOpen GRS";
+    applicationInfo.pEngineName      = "GPUOpen GRS";
+
+    // Pass down the environment
+    VkGPUOpenGPUReshapeCreateInfo gpuOpenInfo{};
+    gpuOpenInfo.sType    = VK_STRUCTURE_TYPE_GPUOPEN_GPURESHAPE_CREATE_INFO;
+    gpuOpenInfo.registry = environment.GetRegistry();
+
+    // Terminate the chain on the null driver
+    VkLayerInstanceLink link{};
+    link.pfnNextGetInstanceProcAddr = NullDriver_vkGetInstanceProcAddr;
+
+    // Layer chain info, normally provided by the loader
+    VkLayerInstanceCreateInfo chainInfo{};
+    chainInfo.sType        = VK_STRUCTURE_TYPE_LOADER_INSTANCE_CREATE_INFO;
+    chainInfo.pNext        = &gpuOpenInfo;
+    chainInfo.function     = VK_LAYER_LINK_INFO;
+    chainInfo.u.pLayerInfo = &link;
+
+    // Instance info
+    VkInstanceCreateInfo instanceCreateInfo{};
+    instanceCreateInfo.sType            = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+    instanceCreateInfo.pNext            = &chainInfo;
+    instanceCreateInfo.pApplicationInfo = &applicationInfo;
+
+    // Create through the layer
+    auto createInstance = reinterpret_cast<PFN_vkCreateInstance>(layerGetInstanceProcAddr(VK_NULL_HANDLE, "vkCreateInstance"));
+    REQUIRE(createInstance(&instanceCreateInfo, nullptr, &instance) == VK_SUCCESS);
+
+    // Null driver has a single physical device
+    uint32_t physicalDeviceCount = 1;
+    REQUIRE(GetInstanceProcAddr<PFN_vkEnumeratePhysicalDevices>("vkEnumeratePhysicalDevices")(instance, &physicalDeviceCount, &physicalDevice) == VK_SUCCESS);
+}
+
+void NullLoader::CreateDevice() {
+    // Enable the selected set of features
+    VkPhysicalDeviceFeatures enabledFeatures{};
+
+    // Default queue priority
+    float queuePriorities = 1.0f;
+
+    // Queue creation
+    VkDeviceQueueCreateInfo primaryQueueInfo{};
+    primaryQueueInfo.sType            = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+    primaryQueueInfo.queueCount       = 1;
+    primaryQueueInfo.queueFamilyIndex = GetPrimaryQueueFamily();
+    primaryQueueInfo.pQueuePriorities = &queuePriorities;
+
+    // Terminate the chain on the null driver
+    VkLayerDeviceLink link{};
+    link.pfnNextGetInstanceProcAddr = NullDriver_vkGetInstanceProcAddr;
+    link.pfnNextGetDeviceProcAddr   = NullDriver_vkGetDeviceProcAddr;
+
+    // Layer chain info, normally provided by the loader
+    VkLayerDeviceCreateInfo chainInfo{};
+    chainInfo.sType        = VK_STRUCTURE_TYPE_LOADER_DEVICE_CREATE_INFO;
+    chainInfo.function     = VK_LAYER_LINK_INFO;
+    chainInfo.u.pLayerInfo = &link;
+
+    // Create the device
+    VkDeviceCreateInfo deviceCreateInfo{};
+    deviceCreateInfo.sType                = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+    deviceCreateInfo.pNext                = &chainInfo;
+    deviceCreateInfo.pEnabledFeatures     = &enabledFeatures;
+    deviceCreateInfo.queueCreateInfoCount = 1;
+    deviceCreateInfo.pQueueCreateInfos    = &primaryQueueInfo;
+    REQUIRE(GetInstanceProcAddr<PFN_vkCreateDevice>("vkCreateDevice")(physicalDevice, &deviceCreateInfo, nullptr, &device) == VK_SUCCESS);
+
+    // Get the allocated queue
+    GetDeviceProcAddr<PFN_vkGetDeviceQueue>("vkGetDeviceQueue")(device, GetPrimaryQueueFamily(), 0, &queue);
+}
+
+NullLoader::~NullLoader() {
+    if (device) {
+        GetDeviceProcAddr<PFN_vkDestroyDevice>("vkDestroyDevice")(device, nullptr);
+    }
+
+    if (instance) {
+        GetInstanceProcAddr<PFN_vkDestroyInstance>("vkDestroyInstance")(instance, nullptr);
+    }
+}
@@ -0,0 +1,150 @@
+// 
+// The MIT License (MIT)
+// 
+// Copyright (c) 2024 Advanced Micro Devices, Inc.,
+// Fatalist Development AB (Avalanche Studio Group),
+// and Miguel Petersen.
+// 
+// All Rights Reserved.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy 
+// of this software and associated documentation files (the "Software"), to deal 
+// in the Software without restriction, including without limitation the rights 
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies 
+// of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, 
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+// Catch2
+#include <catch2/catch.hpp>
+
+// Layer
+#include <Backends/Vulkan/TrackedObject.h>
+
+// Common Tests
+#include <Common/Tests/ReaderContention.h>
+
+// Std
+#include <thread>
+#include <vector>
+
+/// Minimal tracked state
+struct TrackedTestState {
+    uint64_t uid{0};
+};
+
+TEST_CASE("TrackedObject") {
+    TrackedObject<uint64_t, TrackedTestState> tracked;
+
+    std::vector<TrackedTestState> states(1024);
+
+    SECTION("Lookup") {
+        for (uint64_t i = 0; i < states.size(); i++) {
+            tracked.Add(i + 1, &states[i]);
+        }
+
+        // Unique identifiers are assigned in order
+        for (uint64_t i = 0; i < states.size(); i++) {
+            REQUIRE(tracked.Get(i + 1) == &states[i]);
+            REQUIRE(tracked.GetFromUID(i) == &states[i]);
+            REQUIRE(states[i].uid == i);
+        }
+
+        REQUIRE(tracked.TryGet(states.size() + 1) == nullptr);
+        REQUIRE(tracked.GetCount() == states.size());
+    }
+
+    SECTION("Recycling") {
+        // Handles are recycled far more often than the table is sized for
+        for (uint32_t iteration = 0; iteration < 64; iteration++) {
+            for (uint64_t i = 0; i < states.size(); i++) {
+                tracked.Add(i + 1 + iteration * 16, &states[i]);
+            }
+
+            for (uint64_t i = 0; i < states.size(); i++) {
+                REQUIRE(tracked.TryGet(i + 1 + iteration * 16) == &states[i]);
+                tracked.Remove(i + 1 + iteration * 16, &states[i]);
+            }
+        }
+
+        REQUIRE(tracked.TryGet(1) == nullptr);
+        REQUIRE(tracked.GetCount() == 0);
+
+        // Identifiers keep increasing across recycled handles
+        tracked.Add(1, &states[0]);
+        REQUIRE(states[0].uid == 64 * states.size());
+    }
+
+    SECTION("Concurrent Modification") {
+        std::atomic<bool> done{false};
+        std::atomic<uint32_t> mismatches{0};
+
+        // Persistent objects must remain visible while others churn
+        for (uint64_t i = 0; i < 16; i++) {
+            tracked.Add(i + 1, &states[i]);
+        }
+
+        std::thread reader([&] {
+            while (!done.load()) {
+                for (uint64_t i = 0; i < 16; i++) {
+                    if (tracked.TryGet(i + 1) != &states[i]) {
+                        mismatches++;
+                    }
+                }
+            }
+        });
+
+        for (uint32_t iteration = 0; iteration < 256; iteration++) {
+            for (uint64_t i = 16; i < states.size(); i++) {
+                tracked.Add(i + 1 + iteration * 4096, &states[i]);
+            }
+
+            for (uint64_t i = 16; i < states.size(); i++) {
+                tracked.Remove(i + 1 + iteration * 4096, &states[i]);
+            }
+        }
+
+        done.store(true);
+        reader.join();
+
+        REQUIRE(mismatches.load() == 0);
+    }
+}
+
+TEST_CASE("TrackedObject.Contention") {
+    // Typical number of live objects
+    constexpr uint64_t kObjectCount = 4096;
+
+    std::vector<TrackedTestState> states(kObjectCount);
+
+    LockedContentionMap<uint64_t, TrackedTestState*> lockedMap;
+    TrackedObject<uint64_t, TrackedTestState> tracked;
+
+    for (uint64_t i = 0; i < kObjectCount; i++) {
+        lockedMap.Set(i + 1, &states[i]);
+        tracked.Add(i + 1, &states[i]);
+    }
+
+    BENCHMARK("Locked Map") {
+        return RunContentionLookups([&](uint32_t reader, uint32_t i) {
+            return lockedMap.Read([&](const auto& entries) {
+                return entries.at((reader * 7919 + i) % kObjectCount + 1)->uid;
+            });
+        });
+    };
+
+    BENCHMARK("Tracked Object") {
+        return RunContentionLookups([&](uint32_t reader, uint32_t i) {
+            return tracked.Get((reader * 7919 + i) % kObjectCount + 1)->uid;
+        });
+    };
+}
@@ -31,4 +31,5 @@ namespace Backend {
     static constexpr const char* kStartupEnvironmentKey = "GPUOpen.GRS.StartupEnvironment";
     static constexpr const char* kReservedEnvironmentTokenKey = "GPUOpen.GRS.ReservedEnvironmentToken";
     static constexpr const char* kNoServiceTrapKey = "GPUOpen.GRS.NoServiceTrap";
+    static constexpr const char* kValidatorSigningKey = "GPUOpen.GRS.ValidatorSigning";
 }
@@ -34,6 +34,7 @@
 
 // Std
 #include <cstdint>
+#include <vector>
 
 // Forward declarations
 class CommandContext;
@@ -90,3 +91,44 @@ public:
     Hooks::Submit submit;
     Hooks::Join join;
 };
+
+/// Flattened submission hooks of all features, only contains valid delegates
+/// Built once on feature installation, so the hot paths iterate subscribers only
+class FeatureSubmissionHookTable {
+public:
+    /// Append all valid submission hooks of a feature
+    /// \param table feature hook table
+    void Add(const FeatureHookTable& table) {
+        if (table.open.IsValid()) {
+            open.push_back(table.open);
+        }
+
+        if (table.close.IsValid()) {
+            close.push_back(table.close);
+        }
+
+        if (table.submit.IsValid()) {
+            submit.push_back(table.submit);
+        }
+
+        if (table.join.IsValid()) {
+            join.push_back(table.join);
+        }
+    }
+
+    /// Invoke all hooks of a flattened list
+    /// \param hooks all hooks, assumed valid
+    /// \param args all hook arguments
+    template<typename T, typename... A>
+    static void Invoke(const std::vector<T>& hooks, A... args) {
+        for (const T& hook : hooks) {
+            hook.Invoke(args...);
+        }
+    }
+
+    /// Submission
+    std::vector<Hooks::Open> open;
+    std::vector<Hooks::Close> close;
+    std::vector<Hooks::Submit> submit;
+    std::vector<Hooks::Join> join;
+};
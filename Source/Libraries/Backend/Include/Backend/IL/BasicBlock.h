@@ -529,31 +529,30 @@ namespace IL {
             return Append(static_cast<const Instruction*>(&instruction), static_cast<uint32_t>(IL::GetSize(&instruction)));
         }
 
-        /// Append an instruction at a given point
+        /// Insert an instruction at a given point
         /// \param insertion the insertion point, inserted before this iterator
-        /// \param instr the instruction to be inserted
+        /// \param instruction the instruction to be inserted
         /// \return the inserted reference
-        template<typename T>
-        TypedIterator<T> Insert(const ConstOpaqueInstructionRef &insertion, const T &instr) {
+        Iterator Insert(const ConstOpaqueInstructionRef &insertion, const Instruction* instruction) {
             ASSERT(insertion.basicBlock == this, "Instruction offset not from the same basic block");
 
             MarkAsDirty();
 
             size_t offset = insertion.relocationOffset->offset;
 
-            auto *newPtr = reinterpret_cast<const uint8_t *>(&instr);
-            data.insert(data.begin() + offset, newPtr, newPtr + IL::GetSize(&instr));
+            auto *newPtr = reinterpret_cast<const uint8_t *>(instruction);
+            data.insert(data.begin() + offset, newPtr, newPtr + IL::GetSize(instruction));
 
-            InstructionRef<T> ref;
+            InstructionRef<> ref;
             ref.basicBlock = this;
             ref.relocationOffset = relocationAllocator.Allocate();
             ref.relocationOffset->offset = static_cast<uint32_t>(offset);
 
-            if (instr.result != InvalidID) {
-                map.AddInstruction(ref, instr.result);
+            if (instruction->result != InvalidID) {
+                map.AddInstruction(ref, instruction->result);
             }
 
-            AddInstructionReferences(&instr, ref);
+            AddInstructionReferences(instruction, ref);
 
             count++;
 
@@ -564,6 +563,15 @@ namespace IL {
             return InsertRelocationOffset(insertion.relocationOffset, ref.relocationOffset);
         }
 
+        /// Append an instruction at a given point
+        /// \param insertion the insertion point, inserted before this iterator
+        /// \param instr the instruction to be inserted
+        /// \return the inserted reference
+        template<typename T, typename = std::enable_if_t<!std::is_pointer_v<T>>>
+        TypedIterator<T> Insert(const ConstOpaqueInstructionRef &insertion, const T &instr) {
+            return Insert(insertion, static_cast<const Instruction*>(&instr));
+        }
+
         /// Remove an instruction
         /// \param instruction the instruction reference
         void Remove(const OpaqueInstructionRef &instruction) {
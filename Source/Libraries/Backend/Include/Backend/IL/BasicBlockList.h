@@ -138,7 +138,7 @@ namespace IL {
 
             // Copy all basic blocks
             for (const BasicBlock* bb : basicBlocks) {
-                auto* copy = new (allocators) BasicBlock(allocators, out.map, bb->GetID());
+                auto* copy = new (out.allocators) BasicBlock(out.allocators, out.map, bb->GetID());
                 bb->CopyTo(copy);
 
                 out.basicBlocks.push_back(copy);
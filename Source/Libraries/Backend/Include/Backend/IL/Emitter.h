@@ -777,6 +777,29 @@ namespace IL {
             return Op(instr);
         }
 
+        /// Call a function
+        /// \param function the function to be called
+        /// \param argumentCount number of arguments
+        /// \param arguments all arguments, must match the function parameters
+        /// \return instruction reference
+        BasicBlock::TypedIterator <CallInstruction> Call(const Function* function, uint32_t argumentCount, const ID* arguments) {
+            ASSERT(function, "Invalid function");
+
+            auto instr = ALLOCA_SIZE(IL::CallInstruction, IL::CallInstruction::GetSize(argumentCount));
+            instr->opCode = OpCode::Call;
+            instr->source = Source::Invalid();
+            instr->result = map->AllocID();
+            instr->target = function->GetID();
+            instr->arguments.count = argumentCount;
+
+            for (uint32_t i = 0; i < argumentCount; i++) {
+                ASSERT(IsMapped(arguments[i]), "Unmapped identifier");
+                instr->arguments[i] = arguments[i];
+            }
+
+            return Op(*instr);
+        }
+
         /// Add phi instruction
         /// \param first first case basic block
         /// \param firstValue first case value produced by first basic block
@@ -981,6 +1004,27 @@ namespace IL {
             return Op(*instr);
         }
 
+        /// Export a shader export
+        /// \param exportID the allocation id for the export
+        /// \param valueCount number of dwords to be exported
+        /// \param values all dwords to be exported
+        /// \return instruction reference
+        BasicBlock::TypedIterator <ExportInstruction> Export(ShaderExportID exportID, uint32_t valueCount, const ID* values) {
+            auto instr = ALLOCA_SIZE(IL::ExportInstruction, IL::ExportInstruction::GetSize(valueCount));
+            instr->opCode = OpCode::Export;
+            instr->source = Source::Invalid();
+            instr->result = map->AllocID();
+            instr->exportID = exportID;
+            instr->values.count = valueCount;
+
+            for (uint32_t i = 0; i < valueCount; i++) {
+                ASSERT(IsMapped(values[i]), "Unmapped identifier");
+                instr->values[i] = values[i];
+            }
+
+            return Op(*instr);
+        }
+
         /// Construct and export a shader export
         /// \param exportID the allocation id for the export
         /// \param value the value to be exported, constructed internally
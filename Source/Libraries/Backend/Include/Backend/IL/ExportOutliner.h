@@ -0,0 +1,73 @@
+// 
+// The MIT License (MIT)
+// 
+// Copyright (c) 2024 Advanced Micro Devices, Inc.,
+// Fatalist Development AB (Avalanche Studio Group),
+// and Miguel Petersen.
+// 
+// All Rights Reserved.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy 
+// of this software and associated documentation files (the "Software"), to deal 
+// in the Software without restriction, including without limitation the rights 
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies 
+// of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, 
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma once
+
+// Backend
+#include "ID.h"
+
+// Std
+#include <cstdint>
+
+namespace IL {
+    struct Program;
+
+    /// Statistics of a single outlining run
+    struct ExportOutlinerStatistics {
+        /// Number of generated export functions
+        uint32_t generatedFunctions{0};
+
+        /// Number of exports replaced by calls
+        uint32_t outlinedExports{0};
+    };
+
+    /// Outlines instrumentation exports into shared functions
+    ///   Every instrumentation site emits its own export, which backends expand into a considerable
+    ///   instruction sequence. Exports sharing the same identifier and value layout are replaced by
+    ///   calls to a single generated function, taking the exported values as parameters.
+    ///   Requires the backend to support calls to generated functions.
+    class ExportOutliner {
+    public:
+        /// Default minimum number of sites before an export is outlined
+        static constexpr uint32_t kDefaultMinSiteCount = 2;
+
+        /// Constructor
+        /// \param program program to outline
+        /// \param minSiteCount minimum number of sites with the same export layout before outlining
+        ExportOutliner(Program& program, uint32_t minSiteCount = kDefaultMinSiteCount);
+
+        /// Outline all exports within the program
+        /// \return the statistics of this run
+        ExportOutlinerStatistics Outline();
+
+    private:
+        /// Parent program
+        Program& program;
+
+        /// Minimum number of sites
+        uint32_t minSiteCount;
+    };
+}
@@ -105,7 +105,7 @@ namespace IL {
 
             // Copy all basic blocks
             for (const Function* fn : functions) {
-                auto* copy = new (allocators) Function(allocators, out.map, fn->GetID());
+                auto* copy = new (out.allocators) Function(out.allocators, out.map, fn->GetID());
                 fn->CopyTo(copy);
 
                 out.functions.push_back(copy);
@@ -513,6 +513,28 @@ namespace IL {
         ID value;
     };
 
+    struct CallInstruction : public Instruction {
+        static constexpr OpCode kOpCode = OpCode::Call;
+
+        /// Get size of this instruction
+        /// \param argumentCount number of arguments
+        /// \return byte size
+        static uint64_t GetSize(uint32_t argumentCount) {
+            return sizeof(CallInstruction) + InlineArray<IL::ID>::ElementSize(argumentCount);
+        }
+
+        /// Get size of this instruction
+        /// \return byte size
+        uint64_t GetSize() const {
+            return sizeof(CallInstruction) + arguments.ElementSize();
+        }
+
+        /// Function being called
+        ID target;
+
+        InlineArray<IL::ID> arguments;
+    };
+
     struct AtomicOrInstruction : public Instruction {
         static constexpr OpCode kOpCode = OpCode::AtomicOr;
 
@@ -671,6 +693,8 @@ namespace IL {
                 return sizeof(BitShiftRightInstruction);
             case OpCode::Export:
                 return static_cast<const ExportInstruction*>(instruction)->GetSize();
+            case OpCode::Call:
+                return static_cast<const CallInstruction*>(instruction)->GetSize();
             case OpCode::Alloca:
                 return sizeof(AllocaInstruction);
             case OpCode::StoreTexture:
@@ -34,7 +34,7 @@ namespace Backend::IL {
     /// \param instr given instruction
     /// \param out output control flow
     /// \return true if the instruction has control flow
-    bool GetControlFlow(const ::IL::Instruction* instr, ::IL::BranchControlFlow& out) {
+    inline bool GetControlFlow(const ::IL::Instruction* instr, ::IL::BranchControlFlow& out) {
         switch (instr->opCode) {
             default: {
                 return false;
@@ -53,4 +53,348 @@ namespace Backend::IL {
             }
         }
     }
+
+    /// Visit all value operands of an instruction
+    ///   Block operands, such as branch targets, are not visited
+    /// \param instr given instruction
+    /// \param functor invoked with a mutable reference to each valid operand, (::IL::ID&) -> void
+    template<typename F>
+    inline void VisitOperands(::IL::Instruction* instr, F&& functor) {
+        // Helper for optional operands
+        auto visit = [&](::IL::ID& id) {
+            if (id != ::IL::InvalidID) {
+                functor(id);
+            }
+        };
+
+        switch (instr->opCode) {
+            default: {
+                ASSERT(false, "Missing operand mapping");
+                break;
+            }
+            case ::IL::OpCode::None:
+            case ::IL::OpCode::Unexposed:
+            case ::IL::OpCode::Literal:
+            case ::IL::OpCode::Branch:
+            case ::IL::OpCode::Alloca: {
+                break;
+            }
+            case ::IL::OpCode::Any: {
+                visit(static_cast<::IL::AnyInstruction*>(instr)->value);
+                break;
+            }
+            case ::IL::OpCode::All: {
+                visit(static_cast<::IL::AllInstruction*>(instr)->value);
+                break;
+            }
+            case ::IL::OpCode::Add: {
+                auto _instr = static_cast<::IL::AddInstruction*>(instr);
+                visit(_instr->lhs);
+                visit(_instr->rhs);
+                break;
+            }
+            case ::IL::OpCode::Sub: {
+                auto _instr = static_cast<::IL::SubInstruction*>(instr);
+                visit(_instr->lhs);
+                visit(_instr->rhs);
+                break;
+            }
+            case ::IL::OpCode::Div: {
+                auto _instr = static_cast<::IL::DivInstruction*>(instr);
+                visit(_instr->lhs);
+                visit(_instr->rhs);
+                break;
+            }
+            case ::IL::OpCode::Mul: {
+                auto _instr = static_cast<::IL::MulInstruction*>(instr);
+                visit(_instr->lhs);
+                visit(_instr->rhs);
+                break;
+            }
+            case ::IL::OpCode::Rem: {
+                auto _instr = static_cast<::IL::RemInstruction*>(instr);
+                visit(_instr->lhs);
+                visit(_instr->rhs);
+                break;
+            }
+            case ::IL::OpCode::Trunc: {
+                visit(static_cast<::IL::TruncInstruction*>(instr)->value);
+                break;
+            }
+            case ::IL::OpCode::Or: {
+                auto _instr = static_cast<::IL::OrInstruction*>(instr);
+                visit(_instr->lhs);
+                visit(_instr->rhs);
+                break;
+            }
+            case ::IL::OpCode::And: {
+                auto _instr = static_cast<::IL::AndInstruction*>(instr);
+                visit(_instr->lhs);
+                visit(_instr->rhs);
+                break;
+            }
+            case ::IL::OpCode::Equal: {
+                auto _instr = static_cast<::IL::EqualInstruction*>(instr);
+                visit(_instr->lhs);
+                visit(_instr->rhs);
+                break;
+            }
+            case ::IL::OpCode::NotEqual: {
+                auto _instr = static_cast<::IL::NotEqualInstruction*>(instr);
+                visit(_instr->lhs);
+                visit(_instr->rhs);
+                break;
+            }
+            case ::IL::OpCode::LessThan: {
+                auto _instr = static_cast<::IL::LessThanInstruction*>(instr);
+                visit(_instr->lhs);
+                visit(_instr->rhs);
+                break;
+            }
+            case ::IL::OpCode::LessThanEqual: {
+                auto _instr = static_cast<::IL::LessThanEqualInstruction*>(instr);
+                visit(_instr->lhs);
+                visit(_instr->rhs);
+                break;
+            }
+            case ::IL::OpCode::GreaterThan: {
+                auto _instr = static_cast<::IL::GreaterThanInstruction*>(instr);
+                visit(_instr->lhs);
+                visit(_instr->rhs);
+                break;
+            }
+            case ::IL::OpCode::GreaterThanEqual: {
+                auto _instr = static_cast<::IL::GreaterThanEqualInstruction*>(instr);
+                visit(_instr->lhs);
+                visit(_instr->rhs);
+                break;
+            }
+            case ::IL::OpCode::IsInf: {
+                visit(static_cast<::IL::IsInfInstruction*>(instr)->value);
+                break;
+            }
+            case ::IL::OpCode::IsNaN: {
+                visit(static_cast<::IL::IsNaNInstruction*>(instr)->value);
+                break;
+            }
+            case ::IL::OpCode::Select: {
+                auto _instr = static_cast<::IL::SelectInstruction*>(instr);
+                visit(_instr->condition);
+                visit(_instr->pass);
+                visit(_instr->fail);
+                break;
+            }
+            case ::IL::OpCode::BranchConditional: {
+                visit(static_cast<::IL::BranchConditionalInstruction*>(instr)->cond);
+                break;
+            }
+            case ::IL::OpCode::Switch: {
+                visit(static_cast<::IL::SwitchInstruction*>(instr)->value);
+                break;
+            }
+            case ::IL::OpCode::Phi: {
+                auto _instr = static_cast<::IL::PhiInstruction*>(instr);
+                for (uint32_t i = 0; i < _instr->values.count; i++) {
+                    visit(_instr->values[i].value);
+                }
+                break;
+            }
+            case ::IL::OpCode::Return: {
+                visit(static_cast<::IL::ReturnInstruction*>(instr)->value);
+                break;
+            }
+            case ::IL::OpCode::Call: {
+                // Target is a function, not a value
+                auto _instr = static_cast<::IL::CallInstruction*>(instr);
+                for (uint32_t i = 0; i < _instr->arguments.count; i++) {
+                    visit(_instr->arguments[i]);
+                }
+                break;
+            }
+            case ::IL::OpCode::AtomicOr: {
+                auto _instr = static_cast<::IL::AtomicOrInstruction*>(instr);
+                visit(_instr->address);
+                visit(_instr->value);
+                break;
+            }
+            case ::IL::OpCode::AtomicXOr: {
+                auto _instr = static_cast<::IL::AtomicXOrInstruction*>(instr);
+                visit(_instr->address);
+                visit(_instr->value);
+                break;
+            }
+            case ::IL::OpCode::AtomicAnd: {
+                auto _instr = static_cast<::IL::AtomicAndInstruction*>(instr);
+                visit(_instr->address);
+                visit(_instr->value);
+                break;
+            }
+            case ::IL::OpCode::AtomicAdd: {
+                auto _instr = static_cast<::IL::AtomicAddInstruction*>(instr);
+                visit(_instr->address);
+                visit(_instr->value);
+                break;
+            }
+            case ::IL::OpCode::AtomicMin: {
+                auto _instr = static_cast<::IL::AtomicMinInstruction*>(instr);
+                visit(_instr->address);
+                visit(_instr->value);
+                break;
+            }
+            case ::IL::OpCode::AtomicMax: {
+                auto _instr = static_cast<::IL::AtomicMaxInstruction*>(instr);
+                visit(_instr->address);
+                visit(_instr->value);
+                break;
+            }
+            case ::IL::OpCode::AtomicExchange: {
+                auto _instr = static_cast<::IL::AtomicExchangeInstruction*>(instr);
+                visit(_instr->address);
+                visit(_instr->value);
+                break;
+            }
+            case ::IL::OpCode::AtomicCompareExchange: {
+                auto _instr = static_cast<::IL::AtomicCompareExchangeInstruction*>(instr);
+                visit(_instr->address);
+                visit(_instr->comparator);
+                visit(_instr->value);
+                break;
+            }
+            case ::IL::OpCode::BitOr: {
+                auto _instr = static_cast<::IL::BitOrInstruction*>(instr);
+                visit(_instr->lhs);
+                visit(_instr->rhs);
+                break;
+            }
+            case ::IL::OpCode::BitXOr: {
+                auto _instr = static_cast<::IL::BitXOrInstruction*>(instr);
+                visit(_instr->lhs);
+                visit(_instr->rhs);
+                break;
+            }
+            case ::IL::OpCode::BitAnd: {
+                auto _instr = static_cast<::IL::BitAndInstruction*>(instr);
+                visit(_instr->lhs);
+                visit(_instr->rhs);
+                break;
+            }
+            case ::IL::OpCode::BitShiftLeft: {
+                auto _instr = static_cast<::IL::BitShiftLeftInstruction*>(instr);
+                visit(_instr->value);
+                visit(_instr->shift);
+                break;
+            }
+            case ::IL::OpCode::BitShiftRight: {
+                auto _instr = static_cast<::IL::BitShiftRightInstruction*>(instr);
+                visit(_instr->value);
+                visit(_instr->shift);
+                break;
+            }
+            case ::IL::OpCode::AddressChain: {
+                auto _instr = static_cast<::IL::AddressChainInstruction*>(instr);
+                visit(_instr->composite);
+                for (uint32_t i = 0; i < _instr->chains.count; i++) {
+                    visit(_instr->chains[i].index);
+                }
+                break;
+            }
+            case ::IL::OpCode::Extract: {
+                visit(static_cast<::IL::ExtractInstruction*>(instr)->composite);
+                break;
+            }
+            case ::IL::OpCode::Insert: {
+                auto _instr = static_cast<::IL::InsertInstruction*>(instr);
+                visit(_instr->composite);
+                visit(_instr->value);
+                break;
+            }
+            case ::IL::OpCode::FloatToInt: {
+                visit(static_cast<::IL::FloatToIntInstruction*>(instr)->value);
+                break;
+            }
+            case ::IL::OpCode::IntToFloat: {
+                visit(static_cast<::IL::IntToFloatInstruction*>(instr)->value);
+                break;
+            }
+            case ::IL::OpCode::BitCast: {
+                visit(static_cast<::IL::BitCastInstruction*>(instr)->value);
+                break;
+            }
+            case ::IL::OpCode::Export: {
+                auto _instr = static_cast<::IL::ExportInstruction*>(instr);
+                for (uint32_t i = 0; i < _instr->values.count; i++) {
+                    visit(_instr->values[i]);
+                }
+                break;
+            }
+            case ::IL::OpCode::Load: {
+                visit(static_cast<::IL::LoadInstruction*>(instr)->address);
+                break;
+            }
+            case ::IL::OpCode::Store: {
+                auto _instr = static_cast<::IL::StoreInstruction*>(instr);
+                visit(_instr->address);
+                visit(_instr->value);
+                break;
+            }
+            case ::IL::OpCode::StoreOutput: {
+                auto _instr = static_cast<::IL::StoreOutputInstruction*>(instr);
+                visit(_instr->index);
+                visit(_instr->row);
+                visit(_instr->column);
+                visit(_instr->value);
+                break;
+            }
+            case ::IL::OpCode::SampleTexture: {
+                auto _instr = static_cast<::IL::SampleTextureInstruction*>(instr);
+                visit(_instr->texture);
+                visit(_instr->sampler);
+                visit(_instr->coordinate);
+                visit(_instr->reference);
+                visit(_instr->lod);
+                visit(_instr->bias);
+                visit(_instr->ddx);
+                visit(_instr->ddy);
+                visit(_instr->offset);
+                break;
+            }
+            case ::IL::OpCode::StoreTexture: {
+                auto _instr = static_cast<::IL::StoreTextureInstruction*>(instr);
+                visit(_instr->texture);
+                visit(_instr->index);
+                visit(_instr->texel);
+                break;
+            }
+            case ::IL::OpCode::LoadTexture: {
+                auto _instr = static_cast<::IL::LoadTextureInstruction*>(instr);
+                visit(_instr->texture);
+                visit(_instr->index);
+                visit(_instr->offset);
+                visit(_instr->mip);
+                break;
+            }
+            case ::IL::OpCode::StoreBuffer: {
+                auto _instr = static_cast<::IL::StoreBufferInstruction*>(instr);
+                visit(_instr->buffer);
+                visit(_instr->index);
+                visit(_instr->value);
+                break;
+            }
+            case ::IL::OpCode::LoadBuffer: {
+                auto _instr = static_cast<::IL::LoadBufferInstruction*>(instr);
+                visit(_instr->buffer);
+                visit(_instr->index);
+                visit(_instr->offset);
+                break;
+            }
+            case ::IL::OpCode::ResourceToken: {
+                visit(static_cast<::IL::ResourceTokenInstruction*>(instr)->resource);
+                break;
+            }
+            case ::IL::OpCode::ResourceSize: {
+                visit(static_cast<::IL::ResourceSizeInstruction*>(instr)->resource);
+                break;
+            }
+        }
+    }
 }
@@ -0,0 +1,88 @@
+// 
+// The MIT License (MIT)
+// 
+// Copyright (c) 2024 Advanced Micro Devices, Inc.,
+// Fatalist Development AB (Avalanche Studio Group),
+// and Miguel Petersen.
+// 
+// All Rights Reserved.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy 
+// of this software and associated documentation files (the "Software"), to deal 
+// in the Software without restriction, including without limitation the rights 
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies 
+// of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, 
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma once
+
+// Backend
+#include "ID.h"
+
+// Std
+#include <cstdint>
+
+namespace IL {
+    struct Program;
+    struct Function;
+
+    /// Statistics of a single optimization run
+    struct InstrumentationOptimizerStatistics {
+        /// Number of duplicate literals merged into a single definition
+        uint32_t mergedLiterals{0};
+
+        /// Number of instructions folded to a literal
+        uint32_t foldedInstructions{0};
+
+        /// Number of redundant instructions replaced by an existing value
+        uint32_t eliminatedInstructions{0};
+
+        /// Number of unused instructions removed
+        uint32_t deadInstructions{0};
+
+        /// Number of loop invariant instructions moved to loop preheaders
+        uint32_t hoistedInstructions{0};
+    };
+
+    /// Optimizes the instrumentation code injected by features
+    ///   Only non-user instructions are ever removed or folded, user instructions
+    ///   may only have their operands rewritten if they consume instrumentation values.
+    ///   Performs loop invariant hoisting, literal merging, constant folding, copy
+    ///   propagation, local common sub-expression elimination and dead code elimination.
+    class InstrumentationOptimizer {
+    public:
+        /// Constructor
+        /// \param program program to optimize
+        InstrumentationOptimizer(Program& program);
+
+        /// Optimize all functions within the program
+        /// \return the statistics of this run
+        InstrumentationOptimizerStatistics Optimize();
+
+        /// Optimize a single function
+        /// \param function function to optimize
+        void Optimize(Function* function);
+
+        /// Get the current statistics
+        const InstrumentationOptimizerStatistics& GetStatistics() const {
+            return statistics;
+        }
+
+    private:
+        /// Parent program
+        Program& program;
+
+        /// Accumulated statistics
+        InstrumentationOptimizerStatistics statistics;
+    };
+}
@@ -70,6 +70,7 @@ namespace IL {
         Switch,
         Phi,
         Return,
+        Call,
 
         /// Atomic
         AtomicOr,
@@ -63,7 +63,14 @@ namespace IL {
         /// Copy this program
         /// \return
         Program *Copy() const {
-            auto program = new(allocators) Program(allocators, shaderGUID);
+            return Copy(allocators);
+        }
+
+        /// Copy this program
+        /// \param copyAllocators allocators of the copy, may differ from the source program
+        /// \return
+        Program *Copy(const Allocators& copyAllocators) const {
+            auto program = new(copyAllocators) Program(copyAllocators, shaderGUID);
             program->identifierMap.SetBound(identifierMap.GetMaxID());
             typeMap.CopyTo(program->typeMap);
             constants.CopyTo(program->constants);
@@ -100,6 +107,12 @@ namespace IL {
             return shaderGUID;
         }
 
+        /// Set the shader guid
+        /// \param value new guid
+        void SetShaderGUID(uint64_t value) {
+            shaderGUID = value;
+        }
+
         /// Get the identifier map
         IdentifierMap &GetIdentifierMap() {
             return identifierMap;
@@ -272,6 +272,16 @@ namespace Backend::IL {
         return program.GetTypeMap().FindTypeOrAdd(BoolType{});
     }
 
+    inline const Type* ResultOf(Program& program, const CallInstruction* instr) {
+        const ::IL::Function* function = program.GetFunctionList().GetFunction(instr->target);
+        if (!function || !function->GetFunctionType()) {
+            ASSERT(false, "Failed to determine type");
+            return nullptr;
+        }
+
+        return function->GetFunctionType()->returnType;
+    }
+
     inline const Type* ResultOf(Program& program, const ResourceTokenInstruction* instr) {
         return program.GetTypeMap().FindTypeOrAdd(IntType{ .bitWidth=32, .signedness=false });
     }
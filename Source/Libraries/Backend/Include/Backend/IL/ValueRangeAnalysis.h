@@ -0,0 +1,127 @@
+// 
+// The MIT License (MIT)
+// 
+// Copyright (c) 2024 Advanced Micro Devices, Inc.,
+// Fatalist Development AB (Avalanche Studio Group),
+// and Miguel Petersen.
+// 
+// All Rights Reserved.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy 
+// of this software and associated documentation files (the "Software"), to deal 
+// in the Software without restriction, including without limitation the rights 
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies 
+// of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, 
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma once
+
+// Backend
+#include "ID.h"
+
+// Std
+#include <unordered_map>
+#include <cstdint>
+#include <limits>
+
+namespace Backend::IL {
+    struct Type;
+}
+
+namespace IL {
+    struct Program;
+    struct Function;
+    struct Instruction;
+
+    /// Inclusive integral range of a value
+    struct ValueRange {
+        /// Get the unbounded range
+        static ValueRange Unbounded() {
+            return ValueRange{};
+        }
+
+        /// Get a single valued range
+        static ValueRange Constant(int64_t value) {
+            return ValueRange{.lower = value, .upper = value};
+        }
+
+        /// Check if this range is bounded on both ends
+        bool IsBounded() const {
+            return lower != std::numeric_limits<int64_t>::min() && upper != std::numeric_limits<int64_t>::max();
+        }
+
+        /// Check if this range is fully contained within [min, max]
+        bool IsWithin(int64_t min, int64_t max) const {
+            return lower >= min && upper <= max;
+        }
+
+        /// Inclusive lower bound
+        int64_t lower{std::numeric_limits<int64_t>::min()};
+
+        /// Inclusive upper bound
+        int64_t upper{std::numeric_limits<int64_t>::max()};
+    };
+
+    /// Interval based value range analysis over integral SSA values
+    ///   Ranges are computed on demand and cached, cyclic values are unbounded unless
+    ///   matched as a counting loop induction variable, i.e. phi(init, phi + step) with
+    ///   the loop header guarded by phi < bound.
+    class ValueRangeAnalysis {
+    public:
+        /// Constructor
+        /// \param program program to analyze
+        ValueRangeAnalysis(Program& program);
+
+        /// Compute the induction variables of all functions
+        void Compute();
+
+        /// Compute the induction variables of a single function
+        /// \param function function to analyze
+        void Compute(Function* function);
+
+        /// Get the range of a value
+        /// \param id value identifier
+        /// \return unbounded if not provable
+        ValueRange GetRange(ID id);
+
+        /// Check if a value is provably within [min, max]
+        /// \param id value identifier
+        /// \param min inclusive lower bound
+        /// \param max inclusive upper bound
+        bool IsWithin(ID id, int64_t min, int64_t max) {
+            return GetRange(id).IsWithin(min, max);
+        }
+
+    private:
+        /// Compute the range of an instruction
+        ValueRange ComputeRange(const Instruction* instr);
+
+        /// Compute the range of a select, matches min / max patterns
+        ValueRange ComputeSelectRange(const Instruction* instr);
+
+        /// Get the representable range of a type
+        ValueRange GetTypeRange(const Backend::IL::Type* type) const;
+
+        /// Clamp a range to a type, unbounded ranges are widened to the type
+        ValueRange ClampToType(const ValueRange& range, const Backend::IL::Type* type) const;
+
+    private:
+        Program& program;
+
+        /// Cached ranges
+        std::unordered_map<ID, ValueRange> ranges;
+
+        /// Proven ranges of induction variables
+        std::unordered_map<ID, ValueRange> inductionRanges;
+    };
+}
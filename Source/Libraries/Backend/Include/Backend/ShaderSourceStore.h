@@ -0,0 +1,120 @@
+// 
+// The MIT License (MIT)
+// 
+// Copyright (c) 2024 Advanced Micro Devices, Inc.,
+// Fatalist Development AB (Avalanche Studio Group),
+// and Miguel Petersen.
+// 
+// All Rights Reserved.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy 
+// of this software and associated documentation files (the "Software"), to deal 
+// in the Software without restriction, including without limitation the rights 
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies 
+// of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, 
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma once
+
+// Common
+#include <Common/IComponent.h>
+#include <Common/Allocator/Vector.h>
+
+// Std
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <mutex>
+
+/// Immutable source contents, shared by all modules with the same contents
+struct ShaderSourceBlob {
+    ShaderSourceBlob(const Allocators& allocators) : lineOffsets(allocators) {
+        /** */
+    }
+
+    /// Contents hash
+    uint64_t hash{0};
+
+    /// Source contents, not null terminated
+    std::string contents;
+
+    /// All line offsets, including the base (0) line
+    Vector<uint32_t> lineOffsets;
+
+private:
+    friend class ShaderSourceStore;
+
+    /// Number of users, guarded by the store lock
+    uint32_t users{0};
+};
+
+class ShaderSourceStore : public TComponent<ShaderSourceStore> {
+public:
+    COMPONENT(ShaderSourceStore);
+
+    /// Deconstructor
+    ~ShaderSourceStore();
+
+    /// Get or create the blob of some contents, adds a user
+    /// \param contents source contents, copied if no blob matches
+    /// \return blob
+    const ShaderSourceBlob* Acquire(const std::string_view& contents);
+
+    /// Get or create the blob of some contents, adds a user
+    /// \param contents source contents, moved if no blob matches
+    /// \return blob
+    const ShaderSourceBlob* Acquire(std::string&& contents);
+
+    /// Release a user of a blob, destroyed once unreferenced
+    /// \param blob blob to release
+    void Release(const ShaderSourceBlob* blob);
+
+    /// Get the number of unique blobs
+    uint32_t GetBlobCount();
+
+    /// Get the combined byte size of all unique contents
+    uint64_t GetByteCount();
+
+    /// Summarize the line offsets of some contents
+    /// \param contents source contents
+    /// \param out destination offsets, including the base (0) line
+    static void SummarizeLineOffsets(const std::string_view& contents, Vector<uint32_t>& out);
+
+    /// Count the number of newlines in some contents
+    /// \param contents source contents
+    /// \return newline count
+    static uint32_t CountLines(const std::string_view& contents);
+
+private:
+    /// Find a matching blob, lock must be held
+    /// \param hash contents hash
+    /// \param contents source contents
+    /// \return nullptr if not found
+    ShaderSourceBlob* Find(uint64_t hash, const std::string_view& contents);
+
+    /// Insert a new blob, lock must be held
+    /// \param hash contents hash
+    /// \param contents source contents
+    /// \return blob
+    ShaderSourceBlob* Insert(uint64_t hash, std::string&& contents);
+
+private:
+    /// All blobs, keyed by the contents hash
+    std::unordered_multimap<uint64_t, ShaderSourceBlob*> blobs;
+
+    /// Combined byte size of all contents
+    uint64_t byteCount{0};
+
+    /// Shared lock
+    std::mutex mutex;
+};
@@ -0,0 +1,178 @@
+// 
+// The MIT License (MIT)
+// 
+// Copyright (c) 2024 Advanced Micro Devices, Inc.,
+// Fatalist Development AB (Avalanche Studio Group),
+// and Miguel Petersen.
+// 
+// All Rights Reserved.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy 
+// of this software and associated documentation files (the "Software"), to deal 
+// in the Software without restriction, including without limitation the rights 
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies 
+// of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, 
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#include <Backend/IL/ExportOutliner.h>
+#include <Backend/IL/Program.h>
+#include <Backend/IL/Emitter.h>
+
+// Std
+#include <map>
+#include <vector>
+#include <algorithm>
+
+namespace {
+    /// Layout of an export, all sites of the same layout share a function
+    struct ExportLayout {
+        bool operator<(const ExportLayout& other) const {
+            return std::tie(exportID, valueTypes) < std::tie(other.exportID, other.valueTypes);
+        }
+
+        /// Exported identifier
+        ShaderExportID exportID{0};
+
+        /// Types of all exported values
+        std::vector<const Backend::IL::Type*> valueTypes;
+    };
+
+    /// All sites of an export layout
+    struct ExportSiteGroup {
+        /// Shared layout
+        ExportLayout layout;
+
+        /// All export instructions
+        std::vector<IL::OpaqueInstructionRef> sites;
+    };
+}
+
+/// Generate the shared export function
+/// \param program destination program
+/// \param layout the export layout
+/// \return the generated function
+static IL::Function* CreateExportFunction(IL::Program& program, const ExportLayout& layout) {
+    IL::IdentifierMap& map = program.GetIdentifierMap();
+    Backend::IL::TypeMap& typeMap = program.GetTypeMap();
+
+    // Create new function
+    IL::Function* function = program.GetFunctionList().AllocFunction(map.AllocID());
+
+    // Exports never return anything
+    Backend::IL::FunctionType functionType;
+    functionType.returnType = typeMap.FindTypeOrAdd(Backend::IL::VoidType{});
+    functionType.parameterTypes = layout.valueTypes;
+    function->SetFunctionType(typeMap.FindTypeOrAdd(functionType));
+
+    // Never instrument generated code
+    function->AddFlag(FunctionFlag::NoInstrumentation);
+
+    // One parameter per exported value
+    std::vector<IL::ID> parameters;
+    for (const Backend::IL::Type* type : layout.valueTypes) {
+        Backend::IL::Variable parameter;
+        parameter.id = map.AllocID();
+        parameter.addressSpace = Backend::IL::AddressSpace::Function;
+        parameter.type = type;
+        function->GetParameters().Add(parameter);
+
+        // Set value type
+        typeMap.SetType(parameter.id, type);
+        parameters.push_back(parameter.id);
+    }
+
+    // Export all parameters
+    IL::Emitter<> emitter(program, *function->GetBasicBlocks().AllocBlock(map.AllocID()));
+    emitter.Export(layout.exportID, static_cast<uint32_t>(parameters.size()), parameters.data());
+    emitter.Return();
+
+    // OK
+    return function;
+}
+
+IL::ExportOutliner::ExportOutliner(Program &program, uint32_t minSiteCount) : program(program), minSiteCount(minSiteCount) {
+
+}
+
+IL::ExportOutlinerStatistics IL::ExportOutliner::Outline() {
+    ExportOutlinerStatistics statistics;
+
+    Backend::IL::TypeMap& typeMap = program.GetTypeMap();
+
+    // Group lookup, groups are kept in order of appearance
+    std::map<ExportLayout, size_t> groupLookup;
+    std::vector<ExportSiteGroup> groups;
+
+    // Gather all instrumentation exports
+    for (IL::Function* function : program.GetFunctionList()) {
+        for (IL::BasicBlock* basicBlock : function->GetBasicBlocks()) {
+            for (auto it = basicBlock->begin(); it != basicBlock->end(); ++it) {
+                if (it->IsUserInstruction() || !it->Is<IL::ExportInstruction>()) {
+                    continue;
+                }
+
+                auto* _export = it->As<IL::ExportInstruction>();
+
+                // Determine layout
+                ExportLayout layout;
+                layout.exportID = _export->exportID;
+
+                for (uint32_t i = 0; i < _export->values.count; i++) {
+                    layout.valueTypes.push_back(typeMap.GetType(_export->values[i]));
+                }
+
+                // Untyped values cannot be passed
+                if (std::find(layout.valueTypes.begin(), layout.valueTypes.end(), nullptr) != layout.valueTypes.end()) {
+                    continue;
+                }
+
+                // Get or create group
+                auto groupIt = groupLookup.find(layout);
+                if (groupIt == groupLookup.end()) {
+                    groupIt = groupLookup.emplace(layout, groups.size()).first;
+                    groups.push_back(ExportSiteGroup { .layout = std::move(layout) });
+                }
+
+                groups[groupIt->second].sites.push_back(it.Ref());
+            }
+        }
+    }
+
+    // Shared value storage
+    std::vector<IL::ID> values;
+
+    // Outline all groups
+    for (const ExportSiteGroup& group : groups) {
+        if (group.sites.size() < minSiteCount) {
+            continue;
+        }
+
+        // Create shared function
+        IL::Function* function = CreateExportFunction(program, group.layout);
+        statistics.generatedFunctions++;
+
+        // Replace all sites with calls
+        for (const IL::OpaqueInstructionRef& site : group.sites) {
+            auto* _export = site.basicBlock->GetRelocationInstruction<IL::ExportInstruction>(site.relocationOffset);
+
+            // Copy values, the instruction is replaced in place
+            values.assign(&_export->values[0], &_export->values[0] + _export->values.count);
+
+            IL::Emitter<IL::Op::Replace>(program, site).Call(function, static_cast<uint32_t>(values.size()), values.data());
+            statistics.outlinedExports++;
+        }
+    }
+
+    // OK
+    return statistics;
+}
@@ -0,0 +1,1199 @@
+// 
+// The MIT License (MIT)
+// 
+// Copyright (c) 2024 Advanced Micro Devices, Inc.,
+// Fatalist Development AB (Avalanche Studio Group),
+// and Miguel Petersen.
+// 
+// All Rights Reserved.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy 
+// of this software and associated documentation files (the "Software"), to deal 
+// in the Software without restriction, including without limitation the rights 
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies 
+// of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, 
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#include <Backend/IL/InstrumentationOptimizer.h>
+#include <Backend/IL/Program.h>
+#include <Backend/IL/Function.h>
+#include <Backend/IL/BasicBlock.h>
+#include <Backend/IL/InstructionCommon.h>
+#include <Backend/IL/CFG/DominatorTree.h>
+#include <Backend/IL/CFG/LoopTree.h>
+
+// Common
+#include <Common/Hash.h>
+
+// Std
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include <cstring>
+
+namespace {
+    /// Key of a computed value, used for redundancy lookups
+    struct ValueKey {
+        bool operator==(const ValueKey& other) const {
+            return opCode == other.opCode &&
+                   type == other.type &&
+                   payload == other.payload &&
+                   operands == other.operands;
+        }
+
+        /// Instruction op code
+        IL::OpCode opCode{IL::OpCode::None};
+
+        /// Result type
+        const Backend::IL::Type* type{nullptr};
+
+        /// Additional non-operand data, literal bits or extraction indices
+        int64_t payload{0};
+
+        /// All value operands
+        std::vector<IL::ID> operands;
+    };
+
+    /// Hasher for value keys
+    struct ValueKeyHasher {
+        std::size_t operator()(const ValueKey& key) const {
+            std::size_t hash = 0;
+            CombineHash(hash, static_cast<uint32_t>(key.opCode));
+            CombineHash(hash, key.type);
+            CombineHash(hash, key.payload);
+
+            for (IL::ID id : key.operands) {
+                CombineHash(hash, id);
+            }
+
+            return hash;
+        }
+    };
+
+    /// Value lookup table
+    using ValueTable = std::unordered_map<ValueKey, IL::ID, ValueKeyHasher>;
+}
+
+/// Check if an instruction has no side effects, i.e. may be merged or removed
+/// \param instr given instruction
+/// \return true if pure
+static bool IsPureInstruction(const IL::Instruction* instr) {
+    switch (instr->opCode) {
+        default:
+            return false;
+        case IL::OpCode::Literal:
+        case IL::OpCode::Any:
+        case IL::OpCode::All:
+        case IL::OpCode::Add:
+        case IL::OpCode::Sub:
+        case IL::OpCode::Div:
+        case IL::OpCode::Mul:
+        case IL::OpCode::Rem:
+        case IL::OpCode::Trunc:
+        case IL::OpCode::Or:
+        case IL::OpCode::And:
+        case IL::OpCode::Equal:
+        case IL::OpCode::NotEqual:
+        case IL::OpCode::LessThan:
+        case IL::OpCode::LessThanEqual:
+        case IL::OpCode::GreaterThan:
+        case IL::OpCode::GreaterThanEqual:
+        case IL::OpCode::IsInf:
+        case IL::OpCode::IsNaN:
+        case IL::OpCode::Select:
+        case IL::OpCode::BitOr:
+        case IL::OpCode::BitXOr:
+        case IL::OpCode::BitAnd:
+        case IL::OpCode::BitShiftLeft:
+        case IL::OpCode::BitShiftRight:
+        case IL::OpCode::FloatToInt:
+        case IL::OpCode::IntToFloat:
+        case IL::OpCode::BitCast:
+        case IL::OpCode::Extract:
+        case IL::OpCode::AddressChain:
+        case IL::OpCode::ResourceToken:
+        case IL::OpCode::ResourceSize:
+            return true;
+    }
+}
+
+/// Check if an instruction may be executed speculatively, i.e. on paths it was not executed on before
+/// \param instr given instruction
+/// \return true if speculatable
+static bool IsSpeculatable(const IL::Instruction* instr) {
+    switch (instr->opCode) {
+        default:
+            return true;
+        case IL::OpCode::Div:
+        case IL::OpCode::Rem:
+        case IL::OpCode::ResourceToken:
+        case IL::OpCode::ResourceSize:
+            return false;
+    }
+}
+
+/// Check if the two operands of an instruction may be swapped
+/// \param opCode given op code
+/// \return true if commutative
+static bool IsCommutative(IL::OpCode opCode) {
+    switch (opCode) {
+        default:
+            return false;
+        case IL::OpCode::Add:
+        case IL::OpCode::Mul:
+        case IL::OpCode::Or:
+        case IL::OpCode::And:
+        case IL::OpCode::Equal:
+        case IL::OpCode::NotEqual:
+        case IL::OpCode::BitOr:
+        case IL::OpCode::BitXOr:
+        case IL::OpCode::BitAnd:
+            return true;
+    }
+}
+
+/// Normalize an integral value to the width of a type
+/// \param type destination type
+/// \param value value to normalize
+/// \return normalized value
+static int64_t NormalizeIntegral(const Backend::IL::IntType* type, uint64_t value) {
+    if (type->bitWidth >= 64) {
+        return static_cast<int64_t>(value);
+    }
+
+    // Discard all upper bits
+    value &= (1ull << type->bitWidth) - 1ull;
+
+    // Sign extend if needed
+    if (type->signedness && (value & (1ull << (type->bitWidth - 1)))) {
+        value |= ~((1ull << type->bitWidth) - 1ull);
+    }
+
+    return static_cast<int64_t>(value);
+}
+
+/// Optimization state of a single function
+struct FunctionOptimizer {
+    FunctionOptimizer(IL::Program& program, IL::Function* function, IL::InstrumentationOptimizerStatistics& statistics) :
+        function(function),
+        map(program.GetIdentifierMap()),
+        typeMap(program.GetTypeMap()),
+        constants(program.GetConstants()),
+        statistics(statistics) {
+
+    }
+
+    /// Run all optimizations
+    void Optimize() {
+        // Move all loop invariant instrumentation out of loops, exposes redundancies in the preheaders
+        HoistLoopInvariants();
+
+        // Merge all duplicate literals up front
+        MergeLiterals();
+
+        // Fold and eliminate all redundant values
+        for (IL::BasicBlock* basicBlock : function->GetBasicBlocks()) {
+            OptimizeBlock(basicBlock);
+        }
+
+        // Nothing to commit?
+        if (replacements.empty()) {
+            EliminateDeadInstructions();
+            return;
+        }
+
+        // Rewrite all remaining users of replaced values
+        for (IL::BasicBlock* basicBlock : function->GetBasicBlocks()) {
+            for (auto it = basicBlock->begin(); it != basicBlock->end(); ++it) {
+                RewriteOperands(basicBlock, it.GetMutable());
+            }
+        }
+
+        // Insert all merged literals at the start of the entry point, dominates all users
+        IL::BasicBlock* entryPoint = function->GetBasicBlocks().GetEntryPoint();
+        for (const IL::LiteralInstruction& literal : pendingLiterals) {
+            entryPoint->Insert(entryPoint->begin(), literal);
+        }
+
+        // Remove all replaced instructions, no users left
+        for (const IL::OpaqueInstructionRef& ref : pendingRemovals) {
+            ref.basicBlock->Remove(ref);
+        }
+
+        // Finally, remove everything that ended up unused
+        EliminateDeadInstructions();
+    }
+
+private:
+    /// Get the literal key of an instruction
+    ValueKey GetLiteralKey(const IL::LiteralInstruction* literal) {
+        ValueKey key;
+        key.opCode = IL::OpCode::Literal;
+        key.type = typeMap.GetType(literal->result);
+
+        // Differentiate by bit pattern, avoids ambiguity with signed zeroes
+        if (literal->type == IL::LiteralType::FP) {
+            std::memcpy(&key.payload, &literal->value.fp, sizeof(key.payload));
+        } else {
+            key.payload = literal->value.integral;
+        }
+
+        return key;
+    }
+
+    /// Merge all duplicate instrumentation literals within the function
+    void MergeLiterals() {
+        // Count all occurrences
+        std::unordered_map<ValueKey, uint32_t, ValueKeyHasher> literalCounts;
+        for (IL::BasicBlock* basicBlock : function->GetBasicBlocks()) {
+            for (auto it = basicBlock->begin(); it != basicBlock->end(); ++it) {
+                if (it->IsUserInstruction() || !it->Is<IL::LiteralInstruction>()) {
+                    continue;
+                }
+
+                ValueKey key = GetLiteralKey(it->As<IL::LiteralInstruction>());
+                if (key.type) {
+                    literalCounts[key]++;
+                }
+            }
+        }
+
+        // Replace all duplicates by a single definition
+        for (IL::BasicBlock* basicBlock : function->GetBasicBlocks()) {
+            for (auto it = basicBlock->begin(); it != basicBlock->end(); ++it) {
+                if (it->IsUserInstruction() || !it->Is<IL::LiteralInstruction>()) {
+                    continue;
+                }
+
+                auto* literal = it->As<IL::LiteralInstruction>();
+
+                // Unique literals are left as is
+                ValueKey key = GetLiteralKey(literal);
+                if (!key.type || literalCounts[key] < 2) {
+                    continue;
+                }
+
+                // Redirect to the shared definition
+                Replace(it, GetMergedLiteral(key, *literal));
+                statistics.mergedLiterals++;
+            }
+        }
+    }
+
+    /// Get or create a merged literal
+    /// \param key literal key
+    /// \param literal literal template
+    /// \return merged identifier
+    IL::ID GetMergedLiteral(const ValueKey& key, const IL::LiteralInstruction& literal) {
+        auto it = mergedLiterals.find(key);
+        if (it != mergedLiterals.end()) {
+            return it->second;
+        }
+
+        // Allocate new definition, inserted after all analysis
+        IL::LiteralInstruction instr = literal;
+        instr.result = map.AllocID();
+        instr.source = IL::Source::Invalid();
+        typeMap.SetType(instr.result, key.type);
+        pendingLiterals.push_back(instr);
+
+        // Pending literals are not mapped yet, keep track of the values for folding
+        if (instr.type == IL::LiteralType::Int) {
+            pendingIntegrals[instr.result] = instr.value.integral;
+        }
+
+        mergedLiterals[key] = instr.result;
+        return instr.result;
+    }
+
+    /// Get or create a merged integral literal
+    /// \param type result type
+    /// \param value normalized value
+    /// \return merged identifier
+    IL::ID GetMergedIntegral(const Backend::IL::IntType* type, int64_t value) {
+        IL::LiteralInstruction literal{};
+        literal.opCode = IL::OpCode::Literal;
+        literal.source = IL::Source::Invalid();
+        literal.type = IL::LiteralType::Int;
+        literal.bitWidth = type->bitWidth;
+        literal.signedness = type->signedness;
+        literal.value.integral = value;
+
+        ValueKey key;
+        key.opCode = IL::OpCode::Literal;
+        key.type = type;
+        key.payload = value;
+        return GetMergedLiteral(key, literal);
+    }
+
+    /// Optimize all instrumentation values within a block
+    void OptimizeBlock(IL::BasicBlock* basicBlock) {
+        // Values are only shared locally, avoids dominance requirements
+        ValueTable values;
+
+        for (auto it = basicBlock->begin(); it != basicBlock->end(); ++it) {
+            IL::Instruction* instr = it.GetMutable();
+
+            // Map operands to current values
+            RewriteOperands(basicBlock, instr);
+
+            // Only instrumentation values are subject to removal
+            if (instr->IsUserInstruction() || !IsPureInstruction(instr) || instr->result == IL::InvalidID) {
+                continue;
+            }
+
+            // Already handled?
+            if (replacements.count(instr->result)) {
+                continue;
+            }
+
+            // Forward existing values
+            if (IL::ID value = Propagate(instr); value != IL::InvalidID) {
+                Replace(it, value);
+                statistics.eliminatedInstructions++;
+                continue;
+            }
+
+            // Fold to literal
+            int64_t folded;
+            if (Fold(instr, folded)) {
+                Replace(it, GetMergedIntegral(typeMap.GetType(instr->result)->As<Backend::IL::IntType>(), folded));
+                statistics.foldedInstructions++;
+                continue;
+            }
+
+            // Address chains are not shared, backends may expect unique pointers
+            if (instr->Is<IL::AddressChainInstruction>() || instr->Is<IL::LiteralInstruction>()) {
+                continue;
+            }
+
+            // Merge with existing value
+            ValueKey key = GetValueKey(instr);
+            if (auto existing = values.find(key); existing != values.end()) {
+                Replace(it, existing->second);
+                statistics.eliminatedInstructions++;
+                continue;
+            }
+
+            values.emplace(std::move(key), instr->result);
+        }
+    }
+
+    /// Get the value key of an instruction
+    ValueKey GetValueKey(IL::Instruction* instr) {
+        ValueKey key;
+        key.opCode = instr->opCode;
+        key.type = typeMap.GetType(instr->result);
+
+        // Gather operands
+        Backend::IL::VisitOperands(instr, [&](IL::ID& id) {
+            key.operands.push_back(id);
+        });
+
+        // Order independent
+        if (IsCommutative(instr->opCode) && key.operands.size() == 2 && key.operands[0] > key.operands[1]) {
+            std::swap(key.operands[0], key.operands[1]);
+        }
+
+        // Non-operand data
+        if (auto extract = instr->Cast<IL::ExtractInstruction>()) {
+            key.payload = extract->index;
+        }
+
+        return key;
+    }
+
+    /// Mark an instruction as replaced
+    /// \param it instruction to be removed
+    /// \param value the value replacing all users
+    void Replace(const IL::BasicBlock::Iterator& it, IL::ID value) {
+        replacements[it->result] = value;
+        pendingRemovals.push_back(it.Ref());
+    }
+
+    /// Resolve the current value of an identifier
+    IL::ID Resolve(IL::ID id) {
+        for (auto it = replacements.find(id); it != replacements.end(); it = replacements.find(id)) {
+            id = it->second;
+        }
+
+        return id;
+    }
+
+    /// Rewrite all operands of an instruction to the current values
+    void RewriteOperands(IL::BasicBlock* basicBlock, IL::Instruction* instr) {
+        if (replacements.empty()) {
+            return;
+        }
+
+        bool modified = false;
+        Backend::IL::VisitOperands(instr, [&](IL::ID& id) {
+            IL::ID value = Resolve(id);
+            if (value != id) {
+                id = value;
+                modified = true;
+            }
+        });
+
+        // User instructions must be recompiled
+        if (modified) {
+            instr->source = instr->source.Modify();
+            basicBlock->MarkAsDirty();
+        }
+    }
+
+    /// Get the instruction defining an identifier
+    /// \return nullptr if not an instruction
+    IL::Instruction* GetDefinition(IL::ID id) {
+        const IL::OpaqueInstructionRef& ref = map.Get(id);
+        if (!ref.IsValid()) {
+            return nullptr;
+        }
+
+        return ref.basicBlock->GetRelocationInstruction(ref.relocationOffset);
+    }
+
+    /// Get the integral constant value of an identifier
+    bool GetIntegral(IL::ID id, int64_t& out) {
+        if (auto constant = constants.GetConstant<IL::IntConstant>(id)) {
+            out = constant->value;
+            return true;
+        }
+
+        // Check pending literals
+        if (auto it = pendingIntegrals.find(id); it != pendingIntegrals.end()) {
+            out = it->second;
+            return true;
+        }
+
+        // Check literals
+        auto* literal = GetDefinition(id);
+        if (!literal || !literal->Is<IL::LiteralInstruction>() || literal->As<IL::LiteralInstruction>()->type != IL::LiteralType::Int) {
+            return false;
+        }
+
+        out = literal->As<IL::LiteralInstruction>()->value.integral;
+        return true;
+    }
+
+    /// Get the boolean constant value of an identifier
+    bool GetBool(IL::ID id, bool& out) {
+        if (auto constant = constants.GetConstant<IL::BoolConstant>(id)) {
+            out = constant->value;
+            return true;
+        }
+
+        // Check comparisons of integral constants
+        IL::Instruction* instr = GetDefinition(id);
+        if (!instr) {
+            return false;
+        }
+
+        // Comparisons are binary
+        IL::ID operands[2];
+        uint32_t operandCount = 0;
+        Backend::IL::VisitOperands(instr, [&](IL::ID& operand) {
+            if (operandCount < 2) {
+                operands[operandCount] = operand;
+            }
+            operandCount++;
+        });
+
+        // Get values
+        int64_t lhs, rhs;
+        if (operandCount != 2 || !GetIntegral(operands[0], lhs) || !GetIntegral(operands[1], rhs)) {
+            return false;
+        }
+
+        // Only integral comparisons
+        const Backend::IL::Type* operandType = typeMap.GetType(operands[0]);
+        if (!operandType || !operandType->Is<Backend::IL::IntType>()) {
+            return false;
+        }
+
+        auto* intType = operandType->As<Backend::IL::IntType>();
+
+        // Normalize for comparisons
+        if (!intType->signedness && intType->bitWidth < 64) {
+            lhs &= (1ll << intType->bitWidth) - 1;
+            rhs &= (1ll << intType->bitWidth) - 1;
+        }
+
+        bool isUnsigned = !intType->signedness;
+        switch (instr->opCode) {
+            default:
+                return false;
+            case IL::OpCode::Equal:
+                out = lhs == rhs;
+                return true;
+            case IL::OpCode::NotEqual:
+                out = lhs != rhs;
+                return true;
+            case IL::OpCode::LessThan:
+                out = isUnsigned ? static_cast<uint64_t>(lhs) < static_cast<uint64_t>(rhs) : lhs < rhs;
+                return true;
+            case IL::OpCode::LessThanEqual:
+                out = isUnsigned ? static_cast<uint64_t>(lhs) <= static_cast<uint64_t>(rhs) : lhs <= rhs;
+                return true;
+            case IL::OpCode::GreaterThan:
+                out = isUnsigned ? static_cast<uint64_t>(lhs) > static_cast<uint64_t>(rhs) : lhs > rhs;
+                return true;
+            case IL::OpCode::GreaterThanEqual:
+                out = isUnsigned ? static_cast<uint64_t>(lhs) >= static_cast<uint64_t>(rhs) : lhs >= rhs;
+                return true;
+        }
+    }
+
+    /// Check if an identifier is of a given type
+    bool IsType(IL::ID id, const Backend::IL::Type* type) {
+        return typeMap.GetType(id) == type;
+    }
+
+    /// Check if an identifier is a known integral constant
+    bool IsIntegral(IL::ID id, int64_t value) {
+        int64_t constant;
+        return GetIntegral(id, constant) && constant == value;
+    }
+
+    /// Try to forward an existing value
+    /// \return invalid if not possible
+    IL::ID Propagate(IL::Instruction* instr) {
+        const Backend::IL::Type* type = typeMap.GetType(instr->result);
+        if (!type) {
+            return IL::InvalidID;
+        }
+
+        // Forward if the given value is of the same type
+        auto forward = [&](IL::ID value) {
+            return IsType(value, type) ? value : IL::InvalidID;
+        };
+
+        switch (instr->opCode) {
+            default: {
+                return IL::InvalidID;
+            }
+            case IL::OpCode::BitCast: {
+                return forward(instr->As<IL::BitCastInstruction>()->value);
+            }
+            case IL::OpCode::Any: {
+                return forward(instr->As<IL::AnyInstruction>()->value);
+            }
+            case IL::OpCode::All: {
+                return forward(instr->As<IL::AllInstruction>()->value);
+            }
+            case IL::OpCode::Select: {
+                auto* select = instr->As<IL::SelectInstruction>();
+
+                // Same on either side?
+                if (select->pass == select->fail) {
+                    return forward(select->pass);
+                }
+
+                // Known condition?
+                bool condition;
+                if (GetBool(select->condition, condition)) {
+                    return forward(condition ? select->pass : select->fail);
+                }
+
+                return IL::InvalidID;
+            }
+            case IL::OpCode::Add: {
+                auto* add = instr->As<IL::AddInstruction>();
+                if (IsIntegral(add->rhs, 0)) return forward(add->lhs);
+                if (IsIntegral(add->lhs, 0)) return forward(add->rhs);
+                return IL::InvalidID;
+            }
+            case IL::OpCode::Sub: {
+                auto* sub = instr->As<IL::SubInstruction>();
+                if (IsIntegral(sub->rhs, 0)) return forward(sub->lhs);
+                return IL::InvalidID;
+            }
+            case IL::OpCode::Mul: {
+                auto* mul = instr->As<IL::MulInstruction>();
+                if (IsIntegral(mul->rhs, 1)) return forward(mul->lhs);
+                if (IsIntegral(mul->lhs, 1)) return forward(mul->rhs);
+                return IL::InvalidID;
+            }
+            case IL::OpCode::BitOr: {
+                auto* bitOr = instr->As<IL::BitOrInstruction>();
+                if (IsIntegral(bitOr->rhs, 0)) return forward(bitOr->lhs);
+                if (IsIntegral(bitOr->lhs, 0)) return forward(bitOr->rhs);
+                return IL::InvalidID;
+            }
+            case IL::OpCode::BitXOr: {
+                auto* bitXOr = instr->As<IL::BitXOrInstruction>();
+                if (IsIntegral(bitXOr->rhs, 0)) return forward(bitXOr->lhs);
+                if (IsIntegral(bitXOr->lhs, 0)) return forward(bitXOr->rhs);
+                return IL::InvalidID;
+            }
+            case IL::OpCode::BitShiftLeft: {
+                auto* shl = instr->As<IL::BitShiftLeftInstruction>();
+                if (IsIntegral(shl->shift, 0)) return forward(shl->value);
+                return IL::InvalidID;
+            }
+            case IL::OpCode::BitShiftRight: {
+                auto* shr = instr->As<IL::BitShiftRightInstruction>();
+                if (IsIntegral(shr->shift, 0)) return forward(shr->value);
+                return IL::InvalidID;
+            }
+        }
+    }
+
+    /// Try to fold an instruction to an integral constant
+    /// \param out the folded value
+    /// \return false if not possible
+    bool Fold(IL::Instruction* instr, int64_t& out) {
+        // Only scalar integral folding
+        const Backend::IL::Type* type = typeMap.GetType(instr->result);
+        if (!type || !type->Is<Backend::IL::IntType>()) {
+            return false;
+        }
+
+        auto* intType = type->As<Backend::IL::IntType>();
+
+        // Only binary folding
+        IL::ID operands[2];
+        uint32_t operandCount = 0;
+        Backend::IL::VisitOperands(instr, [&](IL::ID& operand) {
+            if (operandCount < 2) {
+                operands[operandCount] = operand;
+            }
+            operandCount++;
+        });
+
+        // Get values
+        int64_t lhs, rhs;
+        if (operandCount != 2 || !GetIntegral(operands[0], lhs) || !GetIntegral(operands[1], rhs)) {
+            return false;
+        }
+
+        auto ulhs = static_cast<uint64_t>(lhs);
+        auto urhs = static_cast<uint64_t>(rhs);
+
+        uint64_t value;
+        switch (instr->opCode) {
+            default:
+                return false;
+            case IL::OpCode::Add:
+                value = ulhs + urhs;
+                break;
+            case IL::OpCode::Sub:
+                value = ulhs - urhs;
+                break;
+            case IL::OpCode::Mul:
+                value = ulhs * urhs;
+                break;
+            case IL::OpCode::BitOr:
+                value = ulhs | urhs;
+                break;
+            case IL::OpCode::BitXOr:
+                value = ulhs ^ urhs;
+                break;
+            case IL::OpCode::BitAnd:
+                value = ulhs & urhs;
+                break;
+            case IL::OpCode::BitShiftLeft:
+                // Out of bounds shifts are undefined in the backends, leave them be
+                if (urhs >= intType->bitWidth) {
+                    return false;
+                }
+
+                value = ulhs << urhs;
+                break;
+            case IL::OpCode::BitShiftRight:
+                if (urhs >= intType->bitWidth) {
+                    return false;
+                }
+
+                // Logical shift, ignore the sign bits
+                value = ulhs;
+                if (intType->bitWidth < 64) {
+                    value &= (1ull << intType->bitWidth) - 1ull;
+                }
+
+                value >>= urhs;
+                break;
+        }
+
+        out = NormalizeIntegral(intType, value);
+        return true;
+    }
+
+    /// Remove all unused instrumentation instructions
+    void EliminateDeadInstructions() {
+        // Count all users
+        std::unordered_map<IL::ID, uint32_t> useCounts;
+        for (IL::BasicBlock* basicBlock : function->GetBasicBlocks()) {
+            for (auto it = basicBlock->begin(); it != basicBlock->end(); ++it) {
+                Backend::IL::VisitOperands(it.GetMutable(), [&](IL::ID& id) {
+                    useCounts[id]++;
+                });
+            }
+        }
+
+        // Collect all unused instructions
+        std::vector<IL::OpaqueInstructionRef> worklist;
+        for (IL::BasicBlock* basicBlock : function->GetBasicBlocks()) {
+            for (auto it = basicBlock->begin(); it != basicBlock->end(); ++it) {
+                if (IsRemovable(it.Get()) && !useCounts.count(it->result)) {
+                    worklist.push_back(it.Ref());
+                }
+            }
+        }
+
+        // Remove until exhausted
+        while (!worklist.empty()) {
+            IL::OpaqueInstructionRef ref = worklist.back();
+            worklist.pop_back();
+
+            IL::Instruction* instr = ref.basicBlock->GetRelocationInstruction(ref.relocationOffset);
+
+            // Release all operands, removal candidates once unused
+            Backend::IL::VisitOperands(instr, [&](IL::ID& id) {
+                if (--useCounts[id] != 0) {
+                    return;
+                }
+
+                const IL::OpaqueInstructionRef& operandRef = map.Get(id);
+                if (operandRef.IsValid() && IsRemovable(operandRef.basicBlock->GetRelocationInstruction(operandRef.relocationOffset))) {
+                    worklist.push_back(operandRef);
+                }
+            });
+
+            ref.basicBlock->Remove(ref);
+            statistics.deadInstructions++;
+        }
+    }
+
+    /// Hoist all loop invariant instrumentation to the loop preheaders
+    void HoistLoopInvariants() {
+        for (;;) {
+            // Compute all dominators
+            IL::DominatorTree dominatorTree(function->GetBasicBlocks());
+            dominatorTree.Compute();
+
+            // Compute all loops
+            IL::LoopTree loopTree(dominatorTree);
+            loopTree.Compute();
+
+            // Hoisting requires dedicated preheaders, inserted blocks invalidate the trees
+            if (InsertPreheaders(dominatorTree, loopTree)) {
+                continue;
+            }
+
+            // Inner loops are visited first, instructions may be hoisted across multiple levels
+            bool hoisted = false;
+            for (const IL::Loop& loop : loopTree.GetView()) {
+                hoisted |= HoistLoopInvariants(dominatorTree, loop);
+            }
+
+            // Hoisted instructions may be candidates of outer loops without a preheader
+            if (!hoisted) {
+                return;
+            }
+        }
+    }
+
+    /// Insert a preheader for all loops with hoisting candidates but without a preheader
+    ///   Loops without candidates are left untouched.
+    /// \return true if any block was inserted
+    bool InsertPreheaders(const IL::DominatorTree& dominatorTree, const IL::LoopTree& loopTree) {
+        bool inserted = false;
+
+        for (const IL::Loop& loop : loopTree.GetView()) {
+            if (FindPreheader(dominatorTree, loop)) {
+                continue;
+            }
+
+            // Nothing to hoist?
+            if (!CollectHoistCandidates(dominatorTree, loop, hoistCandidates)) {
+                continue;
+            }
+
+            inserted |= InsertPreheader(dominatorTree, loop);
+        }
+
+        return inserted;
+    }
+
+    /// Check if a predecessor of a loop header enters the loop, i.e. is not a back edge
+    bool IsLoopEntry(const IL::DominatorTree& dominatorTree, const IL::Loop& loop, IL::BasicBlock* predecessor) {
+        return predecessor != loop.header && !dominatorTree.Dominates(loop.header, predecessor);
+    }
+
+    /// Find the dedicated preheader of a loop, the only entry of the header, branching to nothing but the header
+    /// \return nullptr if not found
+    IL::BasicBlock* FindPreheader(const IL::DominatorTree& dominatorTree, const IL::Loop& loop) {
+        IL::BasicBlock* preheader = nullptr;
+
+        for (IL::BasicBlock* predecessor : dominatorTree.GetPredecessors(loop.header)) {
+            if (!IsLoopEntry(dominatorTree, loop, predecessor)) {
+                continue;
+            }
+
+            // Multiple entries?
+            if (preheader) {
+                return nullptr;
+            }
+
+            preheader = predecessor;
+        }
+
+        // Must not branch elsewhere
+        if (!preheader || preheader->GetTerminator().GetOpCode() != IL::OpCode::Branch) {
+            return nullptr;
+        }
+
+        return preheader;
+    }
+
+    /// Insert a dedicated preheader for a loop, all entries are redirected to it
+    /// \return false if the entries could not be redirected
+    bool InsertPreheader(const IL::DominatorTree& dominatorTree, const IL::Loop& loop) {
+        IL::ID headerID = loop.header->GetID();
+
+        // Gather all entries, only plain branches are redirected
+        std::vector<IL::BasicBlock*> entries;
+        for (IL::BasicBlock* predecessor : dominatorTree.GetPredecessors(loop.header)) {
+            if (!IsLoopEntry(dominatorTree, loop, predecessor)) {
+                continue;
+            }
+
+            IL::OpCode opCode = predecessor->GetTerminator().GetOpCode();
+            if (opCode != IL::OpCode::Branch && opCode != IL::OpCode::BranchConditional) {
+                return false;
+            }
+
+            entries.push_back(predecessor);
+        }
+
+        // Function entry loops have nowhere to hoist to
+        if (entries.empty()) {
+            return false;
+        }
+
+        // Loop membership lookup
+        std::unordered_set<const IL::BasicBlock*> loopBlocks(loop.blocks.begin(), loop.blocks.end());
+
+        // All users outside the loop are redirected, copy as the user list is modified
+        std::vector<IL::OpaqueInstructionRef> users;
+        for (const IL::OpaqueInstructionRef& ref : map.GetBlockUsers(headerID)) {
+            if (loopBlocks.count(ref.basicBlock)) {
+                continue;
+            }
+
+            // Continue constructs cannot be redirected
+            IL::BranchControlFlow controlFlow;
+            if (Backend::IL::GetControlFlow(ref.basicBlock->GetRelocationInstruction(ref.relocationOffset), controlFlow) && controlFlow._continue == headerID) {
+                return false;
+            }
+
+            users.push_back(ref);
+        }
+
+        // All header phis
+        std::vector<IL::OpaqueInstructionRef> phis;
+        for (auto it = loop.header->begin(); it != loop.header->end() && it->Is<IL::PhiInstruction>(); ++it) {
+            // Values of multiple entries are merged in the preheader, which requires the type
+            if (entries.size() > 1 && !typeMap.GetType(it->result)) {
+                return false;
+            }
+
+            phis.push_back(it.Ref());
+        }
+
+        IL::BasicBlock* preheader = function->GetBasicBlocks().AllocBlock();
+        IL::ID preheaderID = preheader->GetID();
+
+        // Redirect all entering values
+        for (const IL::OpaqueInstructionRef& ref : phis) {
+            auto* phi = ref.basicBlock->GetRelocationInstruction(ref.relocationOffset)->As<IL::PhiInstruction>();
+
+            // Single entry, just rename the incoming block
+            if (entries.size() == 1) {
+                for (uint32_t i = 0; i < phi->values.count; i++) {
+                    if (phi->values[i].branch == entries[0]->GetID()) {
+                        phi->values[i].branch = preheaderID;
+                        map.RemoveBlockUser(entries[0]->GetID(), ref);
+                        map.AddBlockUser(preheaderID, ref);
+                    }
+                }
+
+                phi->source = phi->source.Modify();
+                loop.header->MarkAsDirty();
+                continue;
+            }
+
+            // Split the values by origin
+            std::vector<IL::PhiValue> entryValues;
+            std::vector<IL::PhiValue> loopValues;
+            for (uint32_t i = 0; i < phi->values.count; i++) {
+                if (loopBlocks.count(function->GetBasicBlocks().GetBlock(phi->values[i].branch))) {
+                    loopValues.push_back(phi->values[i]);
+                } else {
+                    entryValues.push_back(phi->values[i]);
+                }
+            }
+
+            // Merge all entering values in the preheader
+            IL::ID merged = map.AllocID();
+            typeMap.SetType(merged, typeMap.GetType(phi->result));
+            preheader->Append(CreatePhi(merged, IL::Source::Invalid(), entryValues));
+
+            // The header receives the merged value from the preheader
+            loopValues.push_back(IL::PhiValue{ .value = merged, .branch = preheaderID });
+            loop.header->Replace(ref, *CreatePhi(phi->result, phi->source.Modify(), loopValues));
+
+            // Replacement does not update the block users
+            for (const IL::PhiValue& value : entryValues) {
+                map.RemoveBlockUser(value.branch, ref);
+            }
+
+            map.AddBlockUser(preheaderID, ref);
+        }
+
+        // Redirect all branches and merge points to the preheader
+        for (const IL::OpaqueInstructionRef& ref : users) {
+            IL::Instruction* instr = ref.basicBlock->GetRelocationInstruction(ref.relocationOffset);
+
+            // Replace all references to the header
+            uint32_t redirectCount = 0;
+            auto redirect = [&](IL::ID& id) {
+                if (id == headerID) {
+                    id = preheaderID;
+                    redirectCount++;
+                }
+            };
+
+            switch (instr->opCode) {
+                default: {
+                    // Exit phis keep the header as their predecessor
+                    continue;
+                }
+                case IL::OpCode::Branch: {
+                    auto* branch = instr->As<IL::BranchInstruction>();
+                    redirect(branch->branch);
+                    redirect(branch->controlFlow.merge);
+                    break;
+                }
+                case IL::OpCode::BranchConditional: {
+                    auto* branch = instr->As<IL::BranchConditionalInstruction>();
+                    redirect(branch->pass);
+                    redirect(branch->fail);
+                    redirect(branch->controlFlow.merge);
+                    break;
+                }
+            }
+
+            // Move the block users
+            for (uint32_t i = 0; i < redirectCount; i++) {
+                map.RemoveBlockUser(headerID, ref);
+                map.AddBlockUser(preheaderID, ref);
+            }
+
+            // Mark the branch block as dirty to ensure recompilation
+            instr->source = instr->source.Modify();
+            ref.basicBlock->MarkAsDirty();
+        }
+
+        // Enter the loop
+        IL::BranchInstruction branch{};
+        branch.opCode = IL::OpCode::Branch;
+        branch.source = IL::Source::Invalid();
+        branch.result = IL::InvalidID;
+        branch.branch = headerID;
+        preheader->Append(branch);
+
+        // OK
+        return true;
+    }
+
+    /// Create a phi instruction in the local phi storage
+    /// \return the created instruction, valid until the next creation
+    IL::PhiInstruction* CreatePhi(IL::ID result, IL::Source source, const std::vector<IL::PhiValue>& values) {
+        phiBuffer.resize(IL::PhiInstruction::GetSize(static_cast<uint32_t>(values.size())));
+
+        auto* phi = reinterpret_cast<IL::PhiInstruction*>(phiBuffer.data());
+        phi->opCode = IL::OpCode::Phi;
+        phi->source = source;
+        phi->result = result;
+        phi->values.count = static_cast<uint32_t>(values.size());
+
+        for (uint32_t i = 0; i < phi->values.count; i++) {
+            phi->values[i] = values[i];
+        }
+
+        return phi;
+    }
+
+    /// Collect all instructions of a loop that may be hoisted to its preheader
+    /// \param candidates destination candidates, cleared before collection
+    /// \return false if there are no candidates
+    bool CollectHoistCandidates(const IL::DominatorTree& dominatorTree, const IL::Loop& loop, std::vector<IL::OpaqueInstructionRef>& candidates) {
+        candidates.clear();
+
+        // Loop membership lookup
+        std::unordered_set<const IL::BasicBlock*> loopBlocks(loop.blocks.begin(), loop.blocks.end());
+
+        // All blocks ending an iteration, i.e. back edges, loop exits and function exits
+        std::vector<IL::BasicBlock*> iterationEnds;
+        for (IL::BasicBlock* basicBlock : loop.blocks) {
+            const auto& successors = dominatorTree.GetSuccessors(basicBlock);
+
+            bool isEnd = successors.empty();
+            for (IL::BasicBlock* successor : successors) {
+                isEnd |= successor == loop.header || !loopBlocks.count(successor);
+            }
+
+            if (isEnd) {
+                iterationEnds.push_back(basicBlock);
+            }
+        }
+
+        for (IL::BasicBlock* basicBlock : loop.blocks) {
+            // Non-speculatable instructions may only be hoisted if executed whenever the loop is entered
+            bool isGuaranteedToExecute = IsGuaranteedToExecute(dominatorTree, loop, iterationEnds, basicBlock);
+
+            for (auto it = basicBlock->begin(); it != basicBlock->end(); ++it) {
+                if (!IsRemovable(it.Get()) || (!isGuaranteedToExecute && !IsSpeculatable(it.Get()))) {
+                    continue;
+                }
+
+                if (IsLoopInvariant(it.GetMutable(), loopBlocks)) {
+                    candidates.push_back(it.Ref());
+                }
+            }
+        }
+
+        return !candidates.empty();
+    }
+
+    /// Hoist all loop invariant instrumentation of a loop
+    /// \return true if any instruction was hoisted
+    bool HoistLoopInvariants(const IL::DominatorTree& dominatorTree, const IL::Loop& loop) {
+        // Only hoist into dedicated preheaders, executed exactly once for every entry of the loop
+        IL::BasicBlock* preheader = FindPreheader(dominatorTree, loop);
+        if (!preheader) {
+            return false;
+        }
+
+        // Instruction copy storage
+        std::vector<uint8_t> buffer;
+
+        // Hoisting may make dependent instructions invariant, iterate until exhausted
+        bool hoisted = false;
+        while (CollectHoistCandidates(dominatorTree, loop, hoistCandidates)) {
+            hoisted = true;
+
+            // Move all candidates to the end of the preheader, order is preserved
+            for (const IL::OpaqueInstructionRef& ref : hoistCandidates) {
+                const IL::Instruction* instr = ref.basicBlock->GetRelocationInstruction(ref.relocationOffset);
+
+                // Copy instruction data, removal invalidates it
+                buffer.assign(reinterpret_cast<const uint8_t*>(instr), reinterpret_cast<const uint8_t*>(instr) + IL::GetSize(instr));
+                ref.basicBlock->Remove(ref);
+
+                // Insert prior to the terminator
+                preheader->Insert(preheader->GetTerminator(), reinterpret_cast<const IL::Instruction*>(buffer.data()));
+                statistics.hoistedInstructions++;
+            }
+        }
+
+        return hoisted;
+    }
+
+    /// Check if a block is executed at least once whenever a loop is entered, and on every iteration thereafter
+    ///   A while-style header may exit before reaching the body, so the block must precede all iteration ends.
+    bool IsGuaranteedToExecute(const IL::DominatorTree& dominatorTree, const IL::Loop& loop, const std::vector<IL::BasicBlock*>& iterationEnds, IL::BasicBlock* basicBlock) {
+        if (basicBlock == loop.header) {
+            return true;
+        }
+
+        // Must dominate all back edges and exits
+        for (IL::BasicBlock* end : iterationEnds) {
+            if (end != basicBlock && !dominatorTree.Dominates(basicBlock, end)) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /// Check if all operands of an instruction are defined outside a loop
+    bool IsLoopInvariant(IL::Instruction* instr, const std::unordered_set<const IL::BasicBlock*>& loopBlocks) {
+        bool invariant = true;
+        Backend::IL::VisitOperands(instr, [&](IL::ID& id) {
+            const IL::OpaqueInstructionRef& ref = map.Get(id);
+            if (ref.IsValid() && loopBlocks.count(ref.basicBlock)) {
+                invariant = false;
+            }
+        });
+
+        return invariant;
+    }
+
+    /// Check if an instruction may be removed if unused
+    bool IsRemovable(const IL::Instruction* instr) {
+        return !instr->IsUserInstruction() && instr->result != IL::InvalidID && IsPureInstruction(instr);
+    }
+
+private:
+    /// Function to optimize
+    IL::Function* function;
+
+    /// Program maps
+    IL::IdentifierMap& map;
+    Backend::IL::TypeMap& typeMap;
+    Backend::IL::ConstantMap& constants;
+
+    /// Output statistics
+    IL::InstrumentationOptimizerStatistics& statistics;
+
+    /// All replaced values, replaced to replacement
+    std::unordered_map<IL::ID, IL::ID> replacements;
+
+    /// All merged literals
+    std::unordered_map<ValueKey, IL::ID, ValueKeyHasher> mergedLiterals;
+
+    /// Literals pending insertion
+    std::vector<IL::LiteralInstruction> pendingLiterals;
+
+    /// Values of all pending integral literals
+    std::unordered_map<IL::ID, int64_t> pendingIntegrals;
+
+    /// Instructions pending removal
+    std::vector<IL::OpaqueInstructionRef> pendingRemovals;
+
+    /// Phi creation storage
+    std::vector<uint8_t> phiBuffer;
+
+    /// Loop hoisting candidate storage
+    std::vector<IL::OpaqueInstructionRef> hoistCandidates;
+};
+
+IL::InstrumentationOptimizer::InstrumentationOptimizer(Program &program) : program(program) {
+
+}
+
+IL::InstrumentationOptimizerStatistics IL::InstrumentationOptimizer::Optimize() {
+    for (IL::Function* function : program.GetFunctionList()) {
+        Optimize(function);
+    }
+
+    return statistics;
+}
+
+void IL::InstrumentationOptimizer::Optimize(Function *function) {
+    FunctionOptimizer optimizer(program, function, statistics);
+    optimizer.Optimize();
+}
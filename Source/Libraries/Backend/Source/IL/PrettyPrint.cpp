@@ -380,6 +380,21 @@ void IL::PrettyPrint(const Instruction *instr, IL::PrettyPrintContext out) {
             line << "BitShiftRight %" << bitShiftRight->value << " shift:%" << bitShiftRight->shift;
             break;
         }
+        case OpCode::Call: {
+            auto call = instr->As<IL::CallInstruction>();
+            line << "Call %" << call->target << " arguments:[";
+
+            for (uint32_t i = 0; i < call->arguments.count; i++) {
+                if (i != 0) {
+                    line << ", ";
+                }
+
+                line << "%" << call->arguments[i];
+            }
+
+            line << "]";
+            break;
+        }
         case OpCode::Export: {
             auto _export = instr->As<IL::ExportInstruction>();
             line << "Export values:[";
@@ -1735,6 +1750,24 @@ void PrettyPrintJson(const IL::Program& program, const Backend::IL::Instruction*
             out.Line() << "\"Shift\": " << bitShiftRight->shift << ",";
             break;
         }
+        case IL::OpCode::Call: {
+            auto call = instr->As<IL::CallInstruction>();
+            out.Line() << "\"Target\": " << call->target << ",";
+
+            out.Line() << "\"Arguments\": ";
+            out.Line() << "[";
+
+            for (uint32_t i = 0; i < call->arguments.count; i++) {
+                out.Line() << "\t" << call->arguments[i];
+
+                if (i != call->arguments.count - 1) {
+                    out.stream << ",";
+                }
+            }
+
+            out.Line() << "],";
+            break;
+        }
         case IL::OpCode::Export: {
             auto _export = instr->As<IL::ExportInstruction>();
             out.Line() << "\"ExportID\": " << _export->exportID << ",";
@@ -0,0 +1,622 @@
+// 
+// The MIT License (MIT)
+// 
+// Copyright (c) 2024 Advanced Micro Devices, Inc.,
+// Fatalist Development AB (Avalanche Studio Group),
+// and Miguel Petersen.
+// 
+// All Rights Reserved.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy 
+// of this software and associated documentation files (the "Software"), to deal 
+// in the Software without restriction, including without limitation the rights 
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies 
+// of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, 
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#include <Backend/IL/ValueRangeAnalysis.h>
+#include <Backend/IL/Program.h>
+#include <Backend/IL/Function.h>
+#include <Backend/IL/BasicBlock.h>
+#include <Backend/IL/InstructionCommon.h>
+#include <Backend/IL/CFG/DominatorTree.h>
+#include <Backend/IL/CFG/LoopTree.h>
+
+// Std
+#include <algorithm>
+#include <vector>
+
+namespace {
+    /// Magnitude limit of operands in range arithmetic, keeps all products within 64 bits
+    constexpr int64_t kMaxMagnitude = static_cast<int64_t>(1) << 31;
+
+    /// Check if a range may partake in arithmetic
+    bool IsArithmetic(const IL::ValueRange& range) {
+        return range.lower >= -kMaxMagnitude && range.upper <= kMaxMagnitude;
+    }
+
+    /// Check if a range is non-negative and may partake in arithmetic
+    bool IsNonNegativeArithmetic(const IL::ValueRange& range) {
+        return range.lower >= 0 && range.upper <= kMaxMagnitude;
+    }
+
+    /// Check if a range is non-negative and bounded
+    bool IsNonNegative(const IL::ValueRange& range) {
+        return range.lower >= 0 && range.IsBounded();
+    }
+
+    /// Union of two ranges
+    IL::ValueRange Union(const IL::ValueRange& lhs, const IL::ValueRange& rhs) {
+        return IL::ValueRange {
+            .lower = std::min(lhs.lower, rhs.lower),
+            .upper = std::max(lhs.upper, rhs.upper)
+        };
+    }
+
+    /// Comparison of an induction variable against its bound
+    struct InductionCompare {
+        /// Comparison op code, normalized to induction on the left hand side
+        IL::OpCode opCode{IL::OpCode::None};
+
+        /// Induction candidate
+        IL::ID lhs{IL::InvalidID};
+
+        /// Bound
+        IL::ID rhs{IL::InvalidID};
+    };
+
+    /// Get the inverse of a comparison
+    IL::OpCode InvertCompare(IL::OpCode opCode) {
+        switch (opCode) {
+            default:
+                return IL::OpCode::None;
+            case IL::OpCode::LessThan:
+                return IL::OpCode::GreaterThanEqual;
+            case IL::OpCode::LessThanEqual:
+                return IL::OpCode::GreaterThan;
+            case IL::OpCode::GreaterThan:
+                return IL::OpCode::LessThanEqual;
+            case IL::OpCode::GreaterThanEqual:
+                return IL::OpCode::LessThan;
+        }
+    }
+
+    /// Get the comparison with swapped operands
+    IL::OpCode SwapCompare(IL::OpCode opCode) {
+        switch (opCode) {
+            default:
+                return IL::OpCode::None;
+            case IL::OpCode::LessThan:
+                return IL::OpCode::GreaterThan;
+            case IL::OpCode::LessThanEqual:
+                return IL::OpCode::GreaterThanEqual;
+            case IL::OpCode::GreaterThan:
+                return IL::OpCode::LessThan;
+            case IL::OpCode::GreaterThanEqual:
+                return IL::OpCode::LessThanEqual;
+        }
+    }
+
+    /// Get the operands of a comparison
+    /// \return false if not a comparison
+    bool GetCompare(const IL::Instruction* instr, InductionCompare& out) {
+        switch (instr->opCode) {
+            default:
+                return false;
+            case IL::OpCode::LessThan:
+                out = {instr->opCode, instr->As<IL::LessThanInstruction>()->lhs, instr->As<IL::LessThanInstruction>()->rhs};
+                return true;
+            case IL::OpCode::LessThanEqual:
+                out = {instr->opCode, instr->As<IL::LessThanEqualInstruction>()->lhs, instr->As<IL::LessThanEqualInstruction>()->rhs};
+                return true;
+            case IL::OpCode::GreaterThan:
+                out = {instr->opCode, instr->As<IL::GreaterThanInstruction>()->lhs, instr->As<IL::GreaterThanInstruction>()->rhs};
+                return true;
+            case IL::OpCode::GreaterThanEqual:
+                out = {instr->opCode, instr->As<IL::GreaterThanEqualInstruction>()->lhs, instr->As<IL::GreaterThanEqualInstruction>()->rhs};
+                return true;
+        }
+    }
+
+    /// A matched induction variable, pending range resolution
+    struct InductionCandidate {
+        /// Phi identifier
+        IL::ID phi{IL::InvalidID};
+
+        /// Initial value, from outside the loop
+        IL::ID init{IL::InvalidID};
+
+        /// Loop bound
+        IL::ID bound{IL::InvalidID};
+
+        /// Is the bound inclusive?
+        bool inclusive{false};
+
+        /// Increment per iteration
+        int64_t step{0};
+
+        /// First block executed after the bound check passed
+        IL::BasicBlock* body{nullptr};
+
+        /// Instructions allowed to use the phi outside the body
+        const IL::Instruction* compare{nullptr};
+        const IL::Instruction* increment{nullptr};
+    };
+}
+
+IL::ValueRangeAnalysis::ValueRangeAnalysis(Program &program) : program(program) {
+
+}
+
+void IL::ValueRangeAnalysis::Compute() {
+    for (IL::Function* function : program.GetFunctionList()) {
+        Compute(function);
+    }
+}
+
+void IL::ValueRangeAnalysis::Compute(Function *function) {
+    IL::IdentifierMap& map = program.GetIdentifierMap();
+    IL::BasicBlockList& basicBlocks = function->GetBasicBlocks();
+
+    // Compute all dominators
+    IL::DominatorTree dominatorTree(basicBlocks);
+    dominatorTree.Compute();
+
+    // Compute all loops
+    IL::LoopTree loopTree(dominatorTree);
+    loopTree.Compute();
+
+    // Get the defining instruction of a value
+    auto getDefinition = [&](IL::ID id) -> const IL::Instruction* {
+        const IL::OpaqueInstructionRef& ref = map.Get(id);
+        if (!ref.IsValid()) {
+            return nullptr;
+        }
+
+        return ref.basicBlock->GetRelocationInstruction(ref.relocationOffset);
+    };
+
+    // Check if a block is part of a loop
+    auto isLoopBlock = [](const IL::Loop& loop, const IL::BasicBlock* basicBlock) {
+        return std::find(loop.blocks.begin(), loop.blocks.end(), basicBlock) != loop.blocks.end();
+    };
+
+    // All matched candidates
+    std::vector<InductionCandidate> candidates;
+
+    // Inner loops are placed first, resolve outer loops first so inner initial values are known
+    const IL::LoopTree::LoopView& loops = loopTree.GetView();
+    for (auto loopIt = loops.rbegin(); loopIt != loops.rend(); ++loopIt) {
+        const IL::Loop& loop = *loopIt;
+
+        // Header must be guarded by a conditional
+        auto* branch = loop.header->GetTerminator()->Cast<IL::BranchConditionalInstruction>();
+        if (!branch) {
+            continue;
+        }
+
+        // Exactly one of the targets must stay within the loop
+        IL::BasicBlock* pass = basicBlocks.GetBlock(branch->pass);
+        IL::BasicBlock* fail = basicBlocks.GetBlock(branch->fail);
+        bool passInLoop = isLoopBlock(loop, pass);
+        if (passInLoop == isLoopBlock(loop, fail)) {
+            continue;
+        }
+
+        // Body must be dedicated, the header itself observes the exit value
+        IL::BasicBlock* body = passInLoop ? pass : fail;
+        if (body == loop.header) {
+            continue;
+        }
+
+        // Get the guarding comparison
+        const IL::Instruction* compareInstr = getDefinition(branch->cond);
+        InductionCompare compare;
+        if (!compareInstr || !GetCompare(compareInstr, compare)) {
+            continue;
+        }
+
+        // Normalize to the condition under which the body executes
+        if (!passInLoop) {
+            compare.opCode = InvertCompare(compare.opCode);
+        }
+
+        // Consider all header phis
+        for (auto it = loop.header->begin(); it != loop.header->end(); ++it) {
+            auto* phi = it->Cast<IL::PhiInstruction>();
+            if (!phi) {
+                continue;
+            }
+
+            // Induction must be compared against the bound
+            InductionCompare normalized = compare;
+            if (normalized.rhs == phi->result) {
+                normalized = {SwapCompare(normalized.opCode), normalized.rhs, normalized.lhs};
+            }
+
+            // Only upper bounds are matched
+            if (normalized.lhs != phi->result || (normalized.opCode != IL::OpCode::LessThan && normalized.opCode != IL::OpCode::LessThanEqual)) {
+                continue;
+            }
+
+            // Expect initial value and a single back edge value
+            if (phi->values.count != 2) {
+                continue;
+            }
+
+            InductionCandidate candidate;
+            candidate.phi = phi->result;
+            candidate.bound = normalized.rhs;
+            candidate.inclusive = normalized.opCode == IL::OpCode::LessThanEqual;
+            candidate.body = body;
+            candidate.compare = compareInstr;
+
+            // Match incoming values
+            IL::ID next = IL::InvalidID;
+            for (uint32_t i = 0; i < phi->values.count; i++) {
+                if (isLoopBlock(loop, basicBlocks.GetBlock(phi->values[i].branch))) {
+                    next = phi->values[i].value;
+                } else {
+                    candidate.init = phi->values[i].value;
+                }
+            }
+
+            // Both must be present
+            if (next == IL::InvalidID || candidate.init == IL::InvalidID) {
+                continue;
+            }
+
+            // Back edge value must be a positive increment of the phi
+            const IL::Instruction* increment = getDefinition(next);
+            if (!increment || !increment->Is<IL::AddInstruction>()) {
+                continue;
+            }
+
+            // Either operand order
+            auto* add = increment->As<IL::AddInstruction>();
+            IL::ID stepID;
+            if (add->lhs == phi->result) {
+                stepID = add->rhs;
+            } else if (add->rhs == phi->result) {
+                stepID = add->lhs;
+            } else {
+                continue;
+            }
+
+            // Increment must observe the guarded value
+            IL::BasicBlock* incrementBlock = map.Get(next).basicBlock;
+            if (incrementBlock != body && !dominatorTree.Dominates(body, incrementBlock)) {
+                continue;
+            }
+
+            // Step must be a known positive value
+            ValueRange step = GetRange(stepID);
+            if (step.lower != step.upper || step.lower <= 0 || step.lower > kMaxMagnitude) {
+                continue;
+            }
+
+            candidate.step = step.lower;
+            candidate.increment = increment;
+            candidates.push_back(candidate);
+        }
+    }
+
+    // Any?
+    if (candidates.empty()) {
+        return;
+    }
+
+    // All uses, except the guard and increment, must be dominated by the body
+    for (IL::BasicBlock* basicBlock : basicBlocks) {
+        for (auto it = basicBlock->begin(); it != basicBlock->end(); ++it) {
+            Backend::IL::VisitOperands(it.GetMutable(), [&](IL::ID& id) {
+                for (InductionCandidate& candidate : candidates) {
+                    if (candidate.phi != id || it.Get() == candidate.compare || it.Get() == candidate.increment) {
+                        continue;
+                    }
+
+                    // Phi operands are consumed on the incoming edge, blocks in the body dominate their edges
+                    if (basicBlock != candidate.body && !dominatorTree.Dominates(candidate.body, basicBlock)) {
+                        candidate.phi = IL::InvalidID;
+                    }
+                }
+            });
+        }
+    }
+
+    // Resolve the ranges, in order of outer loops first
+    for (const InductionCandidate& candidate : candidates) {
+        if (candidate.phi == IL::InvalidID) {
+            continue;
+        }
+
+        // Discard any previous assumptions made
+        ranges.erase(candidate.phi);
+
+        // Both ends must be bounded
+        ValueRange init = GetRange(candidate.init);
+        ValueRange bound = GetRange(candidate.bound);
+        if (!IsArithmetic(init) || !IsArithmetic(bound)) {
+            continue;
+        }
+
+        // Body observes [init, bound), or [init, bound] if inclusive
+        ValueRange range {
+            .lower = init.lower,
+            .upper = candidate.inclusive ? bound.upper : bound.upper - 1
+        };
+
+        // The increment may not wrap around before the guard fails
+        ValueRange typeRange = GetTypeRange(program.GetTypeMap().GetType(candidate.phi));
+        if (range.lower > range.upper || !typeRange.IsBounded() || range.upper + candidate.step > typeRange.upper || range.lower < typeRange.lower) {
+            continue;
+        }
+
+        inductionRanges[candidate.phi] = range;
+    }
+
+    // Intermediate ranges may have been cached prior to the inductions being known
+    ranges.clear();
+}
+
+IL::ValueRange IL::ValueRangeAnalysis::GetRange(ID id) {
+    // Cached?
+    if (auto it = ranges.find(id); it != ranges.end()) {
+        return it->second;
+    }
+
+    // Constant?
+    if (auto constant = program.GetConstants().GetConstant<IL::IntConstant>(id)) {
+        return ValueRange::Constant(constant->value);
+    }
+
+    // Parameters and other non-instructions are only bound by their type
+    const IL::OpaqueInstructionRef& ref = program.GetIdentifierMap().Get(id);
+    if (!ref.IsValid()) {
+        return GetTypeRange(program.GetTypeMap().GetType(id));
+    }
+
+    // Mark as visited, cyclic references are unbounded
+    ranges[id] = ValueRange::Unbounded();
+
+    // Compute and cache
+    ValueRange range = ComputeRange(ref.basicBlock->GetRelocationInstruction(ref.relocationOffset));
+    ranges[id] = range;
+    return range;
+}
+
+IL::ValueRange IL::ValueRangeAnalysis::ComputeRange(const Instruction *instr) {
+    const Backend::IL::Type* type = program.GetTypeMap().GetType(instr->result);
+
+    switch (instr->opCode) {
+        default: {
+            return GetTypeRange(type);
+        }
+        case IL::OpCode::Literal: {
+            auto* literal = instr->As<IL::LiteralInstruction>();
+            if (literal->type != IL::LiteralType::Int) {
+                return ValueRange::Unbounded();
+            }
+
+            return ValueRange::Constant(literal->value.integral);
+        }
+        case IL::OpCode::Add: {
+            auto* _instr = instr->As<IL::AddInstruction>();
+            ValueRange lhs = GetRange(_instr->lhs);
+            ValueRange rhs = GetRange(_instr->rhs);
+            if (!IsArithmetic(lhs) || !IsArithmetic(rhs)) {
+                return GetTypeRange(type);
+            }
+
+            return ClampToType(ValueRange {.lower = lhs.lower + rhs.lower, .upper = lhs.upper + rhs.upper}, type);
+        }
+        case IL::OpCode::Sub: {
+            auto* _instr = instr->As<IL::SubInstruction>();
+            ValueRange lhs = GetRange(_instr->lhs);
+            ValueRange rhs = GetRange(_instr->rhs);
+            if (!IsArithmetic(lhs) || !IsArithmetic(rhs)) {
+                return GetTypeRange(type);
+            }
+
+            return ClampToType(ValueRange {.lower = lhs.lower - rhs.upper, .upper = lhs.upper - rhs.lower}, type);
+        }
+        case IL::OpCode::Mul: {
+            auto* _instr = instr->As<IL::MulInstruction>();
+            ValueRange lhs = GetRange(_instr->lhs);
+            ValueRange rhs = GetRange(_instr->rhs);
+            if (!IsArithmetic(lhs) || !IsArithmetic(rhs)) {
+                return GetTypeRange(type);
+            }
+
+            // Extremes are at the corners
+            int64_t corners[] = {
+                lhs.lower * rhs.lower,
+                lhs.lower * rhs.upper,
+                lhs.upper * rhs.lower,
+                lhs.upper * rhs.upper
+            };
+
+            return ClampToType(ValueRange {
+                .lower = *std::min_element(std::begin(corners), std::end(corners)),
+                .upper = *std::max_element(std::begin(corners), std::end(corners))
+            }, type);
+        }
+        case IL::OpCode::Div: {
+            auto* _instr = instr->As<IL::DivInstruction>();
+            ValueRange lhs = GetRange(_instr->lhs);
+            ValueRange rhs = GetRange(_instr->rhs);
+            if (!IsNonNegative(lhs) || !IsNonNegative(rhs) || rhs.lower == 0) {
+                return GetTypeRange(type);
+            }
+
+            return ValueRange {.lower = lhs.lower / rhs.upper, .upper = lhs.upper / rhs.lower};
+        }
+        case IL::OpCode::Rem: {
+            auto* _instr = instr->As<IL::RemInstruction>();
+            ValueRange lhs = GetRange(_instr->lhs);
+            ValueRange rhs = GetRange(_instr->rhs);
+            if (!IsNonNegative(lhs) || !IsNonNegative(rhs) || rhs.lower == 0) {
+                return GetTypeRange(type);
+            }
+
+            return ValueRange {.lower = 0, .upper = std::min(lhs.upper, rhs.upper - 1)};
+        }
+        case IL::OpCode::BitAnd: {
+            auto* _instr = instr->As<IL::BitAndInstruction>();
+            ValueRange lhs = GetRange(_instr->lhs);
+            ValueRange rhs = GetRange(_instr->rhs);
+
+            // A non-negative operand masks the result
+            bool lhsMask = IsNonNegative(lhs);
+            bool rhsMask = IsNonNegative(rhs);
+            if (lhsMask && rhsMask) {
+                return ValueRange {.lower = 0, .upper = std::min(lhs.upper, rhs.upper)};
+            } else if (lhsMask) {
+                return ValueRange {.lower = 0, .upper = lhs.upper};
+            } else if (rhsMask) {
+                return ValueRange {.lower = 0, .upper = rhs.upper};
+            }
+
+            return GetTypeRange(type);
+        }
+        case IL::OpCode::BitOr:
+        case IL::OpCode::BitXOr: {
+            ValueRange lhs = GetRange(instr->opCode == IL::OpCode::BitOr ? instr->As<IL::BitOrInstruction>()->lhs : instr->As<IL::BitXOrInstruction>()->lhs);
+            ValueRange rhs = GetRange(instr->opCode == IL::OpCode::BitOr ? instr->As<IL::BitOrInstruction>()->rhs : instr->As<IL::BitXOrInstruction>()->rhs);
+            if (!IsNonNegativeArithmetic(lhs) || !IsNonNegativeArithmetic(rhs)) {
+                return GetTypeRange(type);
+            }
+
+            // Bounded by the next power of two of the largest operand
+            int64_t mask = 1;
+            while (mask <= std::max(lhs.upper, rhs.upper)) {
+                mask <<= 1;
+            }
+
+            return ClampToType(ValueRange {.lower = 0, .upper = mask - 1}, type);
+        }
+        case IL::OpCode::BitShiftRight: {
+            auto* _instr = instr->As<IL::BitShiftRightInstruction>();
+            ValueRange value = GetRange(_instr->value);
+            ValueRange shift = GetRange(_instr->shift);
+            if (!IsNonNegative(value) || !shift.IsWithin(0, 31)) {
+                return GetTypeRange(type);
+            }
+
+            return ValueRange {.lower = value.lower >> shift.upper, .upper = value.upper >> shift.lower};
+        }
+        case IL::OpCode::BitShiftLeft: {
+            auto* _instr = instr->As<IL::BitShiftLeftInstruction>();
+            ValueRange value = GetRange(_instr->value);
+            ValueRange shift = GetRange(_instr->shift);
+            if (!IsNonNegativeArithmetic(value) || !shift.IsWithin(0, 31)) {
+                return GetTypeRange(type);
+            }
+
+            return ClampToType(ValueRange {.lower = value.lower << shift.lower, .upper = value.upper << shift.upper}, type);
+        }
+        case IL::OpCode::BitCast: {
+            // Reinterpretation only preserves values representable in both types
+            return ClampToType(GetRange(instr->As<IL::BitCastInstruction>()->value), type);
+        }
+        case IL::OpCode::Select: {
+            return ComputeSelectRange(instr);
+        }
+        case IL::OpCode::Phi: {
+            // Matched induction variable?
+            if (auto it = inductionRanges.find(instr->result); it != inductionRanges.end()) {
+                return it->second;
+            }
+
+            // Union of all incoming values
+            auto* phi = instr->As<IL::PhiInstruction>();
+            if (!phi->values.count) {
+                return GetTypeRange(type);
+            }
+
+            ValueRange range = GetRange(phi->values[0].value);
+            for (uint32_t i = 1; i < phi->values.count; i++) {
+                range = Union(range, GetRange(phi->values[i].value));
+            }
+
+            return ClampToType(range, type);
+        }
+    }
+}
+
+IL::ValueRange IL::ValueRangeAnalysis::ComputeSelectRange(const Instruction *instr) {
+    auto* select = instr->As<IL::SelectInstruction>();
+    const Backend::IL::Type* type = program.GetTypeMap().GetType(instr->result);
+
+    ValueRange pass = GetRange(select->pass);
+    ValueRange fail = GetRange(select->fail);
+
+    // Min / max patterns, i.e. a < b ? a : b
+    const IL::OpaqueInstructionRef& ref = program.GetIdentifierMap().Get(select->condition);
+    if (ref.IsValid()) {
+        InductionCompare compare;
+        if (GetCompare(ref.basicBlock->GetRelocationInstruction(ref.relocationOffset), compare)) {
+            // Normalize to the pass operand on the left hand side
+            if (compare.lhs == select->fail && compare.rhs == select->pass) {
+                compare = {SwapCompare(compare.opCode), compare.rhs, compare.lhs};
+            }
+
+            if (compare.lhs == select->pass && compare.rhs == select->fail) {
+                switch (compare.opCode) {
+                    default:
+                        break;
+                    case IL::OpCode::LessThan:
+                    case IL::OpCode::LessThanEqual:
+                        return ValueRange {.lower = std::min(pass.lower, fail.lower), .upper = std::min(pass.upper, fail.upper)};
+                    case IL::OpCode::GreaterThan:
+                    case IL::OpCode::GreaterThanEqual:
+                        return ValueRange {.lower = std::max(pass.lower, fail.lower), .upper = std::max(pass.upper, fail.upper)};
+                }
+            }
+        }
+    }
+
+    // Either operand
+    return ClampToType(Union(pass, fail), type);
+}
+
+IL::ValueRange IL::ValueRangeAnalysis::GetTypeRange(const Backend::IL::Type *type) const {
+    auto* intType = type ? type->Cast<Backend::IL::IntType>() : nullptr;
+    if (!intType || intType->bitWidth == 0 || intType->bitWidth >= 64) {
+        return ValueRange::Unbounded();
+    }
+
+    // Signed or unsigned extent
+    if (intType->signedness) {
+        return ValueRange {
+            .lower = -(static_cast<int64_t>(1) << (intType->bitWidth - 1)),
+            .upper = (static_cast<int64_t>(1) << (intType->bitWidth - 1)) - 1
+        };
+    } else {
+        return ValueRange {
+            .lower = 0,
+            .upper = (static_cast<int64_t>(1) << intType->bitWidth) - 1
+        };
+    }
+}
+
+IL::ValueRange IL::ValueRangeAnalysis::ClampToType(const ValueRange &range, const Backend::IL::Type *type) const {
+    ValueRange typeRange = GetTypeRange(type);
+
+    // Values outside the type may wrap, nothing is known
+    if (!range.IsWithin(typeRange.lower, typeRange.upper)) {
+        return typeRange;
+    }
+
+    return range;
+}
@@ -0,0 +1,192 @@
+// 
+// The MIT License (MIT)
+// 
+// Copyright (c) 2024 Advanced Micro Devices, Inc.,
+// Fatalist Development AB (Avalanche Studio Group),
+// and Miguel Petersen.
+// 
+// All Rights Reserved.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy 
+// of this software and associated documentation files (the "Software"), to deal 
+// in the Software without restriction, including without limitation the rights 
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies 
+// of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, 
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#include <Backend/ShaderSourceStore.h>
+
+// Std
+#include <bit>
+#include <cstring>
+#include <functional>
+
+ShaderSourceStore::~ShaderSourceStore() {
+    for (auto&& [hash, blob] : blobs) {
+        destroy(blob, allocators);
+    }
+}
+
+const ShaderSourceBlob* ShaderSourceStore::Acquire(const std::string_view& contents) {
+    uint64_t hash = std::hash<std::string_view>{}(contents);
+
+    // Try existing
+    std::lock_guard guard(mutex);
+    if (ShaderSourceBlob* blob = Find(hash, contents)) {
+        return blob;
+    }
+
+    // Copy contents
+    return Insert(hash, std::string(contents));
+}
+
+const ShaderSourceBlob* ShaderSourceStore::Acquire(std::string&& contents) {
+    uint64_t hash = std::hash<std::string_view>{}(contents);
+
+    // Try existing
+    std::lock_guard guard(mutex);
+    if (ShaderSourceBlob* blob = Find(hash, contents)) {
+        return blob;
+    }
+
+    // Move contents
+    return Insert(hash, std::move(contents));
+}
+
+void ShaderSourceStore::Release(const ShaderSourceBlob* blob) {
+    std::lock_guard guard(mutex);
+
+    // Still in use?
+    ASSERT(blob->users, "Releasing unreferenced blob");
+    if (--const_cast<ShaderSourceBlob*>(blob)->users) {
+        return;
+    }
+
+    // Remove from lookup
+    for (auto [it, end] = blobs.equal_range(blob->hash); it != end; ++it) {
+        if (it->second == blob) {
+            blobs.erase(it);
+            break;
+        }
+    }
+
+    // Release memory
+    byteCount -= blob->contents.length();
+    destroy(const_cast<ShaderSourceBlob*>(blob), allocators);
+}
+
+uint32_t ShaderSourceStore::GetBlobCount() {
+    std::lock_guard guard(mutex);
+    return static_cast<uint32_t>(blobs.size());
+}
+
+uint64_t ShaderSourceStore::GetByteCount() {
+    std::lock_guard guard(mutex);
+    return byteCount;
+}
+
+ShaderSourceBlob* ShaderSourceStore::Find(uint64_t hash, const std::string_view& contents) {
+    // Hashes may collide, compare the contents
+    for (auto [it, end] = blobs.equal_range(hash); it != end; ++it) {
+        ShaderSourceBlob* blob = it->second;
+
+        // Matching contents?
+        if (blob->contents != contents) {
+            continue;
+        }
+
+        // OK
+        blob->users++;
+        return blob;
+    }
+
+    // Not found
+    return nullptr;
+}
+
+ShaderSourceBlob* ShaderSourceStore::Insert(uint64_t hash, std::string&& contents) {
+    auto blob = new (allocators) ShaderSourceBlob(allocators);
+    blob->hash = hash;
+    blob->users = 1;
+    blob->contents = std::move(contents);
+
+    // Summarize once for all users
+    SummarizeLineOffsets(blob->contents, blob->lineOffsets);
+
+    // Add to lookup
+    blobs.emplace(hash, blob);
+    byteCount += blob->contents.length();
+
+    // OK
+    return blob;
+}
+
+/// Get the newline mask of eight characters, the high bit of each newline byte is set
+/// \param data characters, unaligned
+/// \return mask
+static uint64_t GetNewlineMask(const char* data) {
+    constexpr uint64_t kNewlines = 0x0A0A0A0A0A0A0A0Aull;
+    constexpr uint64_t kLow = 0x7F7F7F7F7F7F7F7Full;
+
+    // Load word
+    uint64_t word;
+    std::memcpy(&word, data, sizeof(word));
+
+    // Newline bytes are zero, exact zero byte test, no carries between bytes
+    uint64_t zero = word ^ kNewlines;
+    return ~(((zero & kLow) + kLow) | zero | kLow);
+}
+
+void ShaderSourceStore::SummarizeLineOffsets(const std::string_view& contents, Vector<uint32_t>& out) {
+    // Base line
+    out.push_back(0);
+
+    // Current offset
+    uint32_t offset = 0;
+    uint32_t length = static_cast<uint32_t>(contents.length());
+
+    // Scan eight characters at a time, most words have no newline
+    for (; offset + sizeof(uint64_t) <= length; offset += sizeof(uint64_t)) {
+        for (uint64_t mask = GetNewlineMask(contents.data() + offset); mask; mask &= mask - 1) {
+            out.push_back(offset + (std::countr_zero(mask) >> 3u) + 1);
+        }
+    }
+
+    // Remaining characters
+    for (; offset < length; offset++) {
+        if (contents[offset] == '\n') {
+            out.push_back(offset + 1);
+        }
+    }
+}
+
+uint32_t ShaderSourceStore::CountLines(const std::string_view& contents) {
+    uint32_t count = 0;
+
+    // Current offset
+    uint32_t offset = 0;
+    uint32_t length = static_cast<uint32_t>(contents.length());
+
+    // Count eight characters at a time
+    for (; offset + sizeof(uint64_t) <= length; offset += sizeof(uint64_t)) {
+        count += std::popcount(GetNewlineMask(contents.data() + offset));
+    }
+
+    // Remaining characters
+    for (; offset < length; offset++) {
+        count += contents[offset] == '\n';
+    }
+
+    // OK
+    return count;
+}
@@ -0,0 +1,243 @@
+// 
+// The MIT License (MIT)
+// 
+// Copyright (c) 2024 Advanced Micro Devices, Inc.,
+// Fatalist Development AB (Avalanche Studio Group),
+// and Miguel Petersen.
+// 
+// All Rights Reserved.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy 
+// of this software and associated documentation files (the "Software"), to deal 
+// in the Software without restriction, including without limitation the rights 
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies 
+// of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, 
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#include <catch2/catch.hpp>
+
+// Backend
+#include <Backend/IL/Program.h>
+
+// Common
+#include <Common/Allocator/ArenaAllocator.h>
+
+// Std
+#include <vector>
+#include <unordered_map>
+
+/// Counting allocator, forwards to the default allocators
+struct CountingAllocator {
+    /// Get the allocators
+    Allocators GetAllocators() {
+        return Allocators {
+            .userData = this,
+            .alloc = Allocate,
+            .free = Free
+        };
+    }
+
+    static void* Allocate(void* self, size_t size, size_t align, AllocationTag tag) {
+        auto* counting = static_cast<CountingAllocator*>(self);
+        counting->allocationCount++;
+
+        void* ptr = AllocateDefault(nullptr, size, align, tag);
+        counting->alignments[ptr] = align;
+        return ptr;
+    }
+
+    static void Free(void* self, void* ptr, size_t align) {
+        auto* counting = static_cast<CountingAllocator*>(self);
+        counting->freeCount++;
+
+        // Frees must match the alignment of the allocation
+        auto it = counting->alignments.find(ptr);
+        if (it == counting->alignments.end() || it->second != align) {
+            counting->mismatchedFreeCount++;
+        } else {
+            counting->alignments.erase(it);
+        }
+
+        FreeDefault(nullptr, ptr, align);
+    }
+
+    /// Number of backing allocations
+    uint64_t allocationCount{0};
+
+    /// Number of backing frees
+    uint64_t freeCount{0};
+
+    /// Number of backing frees not matching the allocation
+    uint64_t mismatchedFreeCount{0};
+
+    /// Alignment of all live allocations
+    std::unordered_map<void*, size_t> alignments;
+};
+
+/// Populate a program with a representative number of functions, blocks and instructions
+static void PopulateProgram(IL::Program& program, uint32_t functionCount, uint32_t blockCount, uint32_t instructionCount) {
+    IL::IdentifierMap& map = program.GetIdentifierMap();
+
+    for (uint32_t functionIndex = 0; functionIndex < functionCount; functionIndex++) {
+        IL::Function* fn = program.GetFunctionList().AllocFunction(map.AllocID());
+
+        for (uint32_t blockIndex = 0; blockIndex < blockCount; blockIndex++) {
+            IL::BasicBlock* bb = fn->GetBasicBlocks().AllocBlock(map.AllocID());
+
+            for (uint32_t i = 0; i < instructionCount; i++) {
+                IL::LiteralInstruction literal;
+                literal.opCode = IL::OpCode::Literal;
+                literal.result = map.AllocID();
+                literal.type = IL::LiteralType::Int;
+                literal.bitWidth = 32;
+                literal.value.integral = i;
+                bb->Append(literal);
+
+                IL::AddInstruction add;
+                add.opCode = IL::OpCode::Add;
+                add.result = map.AllocID();
+                add.lhs = literal.result;
+                add.rhs = literal.result;
+                bb->Append(add);
+            }
+        }
+    }
+}
+
+/// Mimic instrumentation, injects an instruction before every addition and splits every block
+static void InstrumentProgram(IL::Program& program) {
+    IL::IdentifierMap& map = program.GetIdentifierMap();
+
+    for (IL::Function* fn : program.GetFunctionList()) {
+        std::vector<IL::BasicBlock*> blocks(fn->GetBasicBlocks().begin(), fn->GetBasicBlocks().end());
+
+        for (IL::BasicBlock* bb : blocks) {
+            for (auto it = bb->begin(); it != bb->end(); ++it) {
+                if (it->opCode != IL::OpCode::Add) {
+                    continue;
+                }
+
+                IL::AddInstruction add;
+                add.opCode = IL::OpCode::Add;
+                add.result = map.AllocID();
+                add.lhs = it->result;
+                add.rhs = it->result;
+                it = bb->Insert(it, add);
+                ++it;
+            }
+
+            // Split after the first instruction
+            bb->Split(fn->GetBasicBlocks().AllocBlock(map.AllocID()), ++bb->begin());
+        }
+    }
+}
+
+TEST_CASE("Backend.IL.Allocator") {
+    Allocators allocators;
+
+    // Source program, shared across all copies
+    IL::Program program(allocators, 0x0);
+    PopulateProgram(program, 8, 32, 64);
+
+    SECTION("Arena") {
+        CountingAllocator counting;
+        ArenaAllocator arena(counting.GetAllocators());
+
+        // Copy twice, the second copy must recycle all chunks
+        for (uint32_t i = 0; i < 2; i++) {
+            IL::Program* copy = program.Copy(arena.GetAllocators());
+            REQUIRE(copy->GetFunctionList().GetCount() == program.GetFunctionList().GetCount());
+            destroy(copy, arena.GetAllocators());
+            arena.Reset();
+        }
+
+        // Only the first copy may allocate chunks
+        const uint64_t warmAllocationCount = counting.allocationCount;
+        {
+            IL::Program* copy = program.Copy(arena.GetAllocators());
+            destroy(copy, arena.GetAllocators());
+            arena.Reset();
+        }
+
+        // No backing allocations after warmup
+        REQUIRE(counting.allocationCount == warmAllocationCount);
+        REQUIRE(counting.freeCount == 0);
+    }
+
+    SECTION("Loose Alignment") {
+        CountingAllocator counting;
+        ArenaAllocator arena(counting.GetAllocators(), 1024);
+
+        // Oversized allocations with non-default alignments
+        for (size_t align : {16u, 64u, 256u, 4096u}) {
+            arena.Allocate(1024, align);
+        }
+
+        // All loose allocations must be free'd with their own alignment
+        arena.Reset();
+        REQUIRE(counting.freeCount == 4);
+        REQUIRE(counting.mismatchedFreeCount == 0);
+    }
+
+    SECTION("Allocation Count") {
+        CountingAllocator counting;
+        ArenaAllocator arena(counting.GetAllocators());
+
+        // Default allocators
+        CountingAllocator defaultCounting;
+        destroy(program.Copy(defaultCounting.GetAllocators()), defaultCounting.GetAllocators());
+
+        // Arena allocators, warmed up
+        destroy(program.Copy(arena.GetAllocators()), arena.GetAllocators());
+        arena.Reset();
+
+        // Measure warm arena
+        const uint64_t warmAllocationCount = counting.allocationCount;
+        destroy(program.Copy(arena.GetAllocators()), arena.GetAllocators());
+
+        // Report
+        WARN("Default: " << defaultCounting.allocationCount << " allocations, " << defaultCounting.freeCount << " frees");
+        WARN("Arena: " << arena.GetAllocationCount() << " sub-allocations, " << (counting.allocationCount - warmAllocationCount) << " backing allocations");
+        arena.Reset();
+
+        // Every backing allocation is served by the arena
+        REQUIRE(defaultCounting.allocationCount > 0);
+        REQUIRE(counting.allocationCount == warmAllocationCount);
+    }
+
+    SECTION("Benchmark") {
+        ArenaAllocator arena;
+
+        BENCHMARK("Copy.Default") {
+            destroy(program.Copy(allocators), allocators);
+        };
+
+        BENCHMARK("Copy.Arena") {
+            destroy(program.Copy(arena.GetAllocators()), arena.GetAllocators());
+            arena.Reset();
+        };
+
+        BENCHMARK("Instrument.Default") {
+            IL::Program* copy = program.Copy(allocators);
+            InstrumentProgram(*copy);
+            destroy(copy, allocators);
+        };
+
+        BENCHMARK("Instrument.Arena") {
+            IL::Program* copy = program.Copy(arena.GetAllocators());
+            InstrumentProgram(*copy);
+            destroy(copy, arena.GetAllocators());
+            arena.Reset();
+        };
+    }
+}
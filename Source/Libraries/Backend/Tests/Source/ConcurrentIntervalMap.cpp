@@ -0,0 +1,292 @@
+// 
+// The MIT License (MIT)
+// 
+// Copyright (c) 2024 Advanced Micro Devices, Inc.,
+// Fatalist Development AB (Avalanche Studio Group),
+// and Miguel Petersen.
+// 
+// All Rights Reserved.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy 
+// of this software and associated documentation files (the "Software"), to deal 
+// in the Software without restriction, including without limitation the rights 
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies 
+// of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, 
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+#include <catch2/catch.hpp>
+
+// Common
+#include <Common/Containers/ConcurrentIntervalMap.h>
+
+// Common Tests
+#include <Common/Tests/ReaderContention.h>
+
+// Std
+#include <map>
+#include <thread>
+#include <vector>
+#include <random>
+
+/// Number of tracked intervals, typical of a streaming title
+static constexpr uint64_t kIntervalCount = 16'384;
+
+/// Interval spacing and length
+static constexpr uint64_t kIntervalStride = 0x10000;
+static constexpr uint64_t kIntervalLength = 0x8000;
+
+/// Interval lookups on the locked baseline, mirrors the previous table lookups
+class LockedIntervalMap {
+public:
+    void Add(uint64_t base, uint64_t length, uint64_t value) {
+        entries.Set(base, std::make_pair(length, value));
+    }
+
+    void Remove(uint64_t base) {
+        entries.Remove(base);
+    }
+
+    bool Find(uint64_t key, uint64_t& out) {
+        return entries.Read([&](const std::map<uint64_t, std::pair<uint64_t, uint64_t>>& map) {
+            auto it = map.upper_bound(key);
+            if (it == map.begin()) {
+                return false;
+            }
+
+            --it;
+            if (key - it->first >= it->second.first) {
+                return false;
+            }
+
+            out = it->second.second;
+            return true;
+        });
+    }
+
+private:
+    LockedContentionMap<uint64_t, std::pair<uint64_t, uint64_t>> entries;
+};
+
+TEST_CASE("Common.ConcurrentIntervalMap") {
+    ConcurrentIntervalMap<uint64_t, uint64_t> map;
+
+    SECTION("Lookup") {
+        REQUIRE(!map.Remove(0));
+
+        uint64_t value = 0;
+        REQUIRE(!map.Find(0, value));
+
+        // Insert out of order to exercise chunk splits at both ends
+        for (uint64_t i = 0; i < 1024; i++) {
+            uint64_t index = (i * 617) % 1024;
+            map.Add(index * 100 + 100, 50, index);
+        }
+
+        REQUIRE(map.Size() == 1024);
+
+        for (uint64_t i = 0; i < 1024; i++) {
+            uint64_t base = i * 100 + 100;
+
+            // Bounds are [base, base + length)
+            REQUIRE(!map.Find(base - 1, value));
+            REQUIRE((map.Find(base, value) && value == i));
+            REQUIRE((map.Find(base + 49, value) && value == i));
+            REQUIRE(!map.Find(base + 50, value));
+        }
+    }
+
+    SECTION("Replacement") {
+        map.Add(16, 4, 1);
+        map.Add(16, 8, 2);
+        REQUIRE(map.Size() == 1);
+
+        uint64_t value = 0;
+        REQUIRE((map.Find(22, value) && value == 2));
+    }
+
+    SECTION("Removal") {
+        for (uint64_t i = 0; i < 1024; i++) {
+            map.Add(i * 16, 16, i);
+        }
+
+        // Remove all odd intervals
+        for (uint64_t i = 1; i < 1024; i += 2) {
+            REQUIRE(map.Remove(i * 16));
+        }
+
+        REQUIRE(!map.Remove(16));
+        REQUIRE(map.Size() == 512);
+
+        for (uint64_t i = 0; i < 1024; i++) {
+            uint64_t value = 0;
+            REQUIRE(map.Find(i * 16 + 8, value) == !(i & 1));
+        }
+
+        // Drain completely
+        for (uint64_t i = 0; i < 1024; i += 2) {
+            REQUIRE(map.Remove(i * 16));
+        }
+
+        uint64_t value = 0;
+        REQUIRE(map.Size() == 0);
+        REQUIRE(!map.Find(0, value));
+    }
+
+    SECTION("Last Hit") {
+        ConcurrentIntervalMap<uint64_t, uint64_t, true> cachedMap;
+        cachedMap.Add(0, 16, 1);
+
+        uint64_t value = 0;
+        REQUIRE((cachedMap.Find(4, value) && value == 1));
+        REQUIRE((cachedMap.Find(8, value) && value == 1));
+
+        // Writes must invalidate the hit
+        cachedMap.Remove(0);
+        REQUIRE(!cachedMap.Find(8, value));
+
+        cachedMap.Add(0, 16, 2);
+        REQUIRE((cachedMap.Find(8, value) && value == 2));
+
+        // Hits are per map
+        map.Add(0, 16, 3);
+        REQUIRE((map.Find(8, value) && value == 3));
+        REQUIRE((cachedMap.Find(8, value) && value == 2));
+    }
+
+    SECTION("Concurrent Writes") {
+        std::atomic<bool> done{false};
+        std::atomic<uint32_t> mismatches{0};
+
+        // Even intervals are stable, odd intervals churn
+        for (uint64_t i = 0; i < 4096; i += 2) {
+            map.Add(i * 16, 16, i);
+        }
+
+        // Readers must always observe the stable intervals, and odd intervals only ever with their own value
+        std::vector<std::thread> readers;
+        for (uint32_t reader = 0; reader < 4; reader++) {
+            readers.emplace_back([&] {
+                while (!done.load()) {
+                    for (uint64_t i = 0; i < 4096; i++) {
+                        uint64_t value = ~0ull;
+                        bool found = map.Find(i * 16 + 4, value);
+
+                        if ((!(i & 1) && !found) || (found && value != i)) {
+                            mismatches++;
+                        }
+                    }
+                }
+            });
+        }
+
+        for (uint32_t round = 0; round < 4; round++) {
+            for (uint64_t i = 1; i < 4096; i += 2) {
+                map.Add(i * 16, 16, i);
+            }
+
+            for (uint64_t i = 1; i < 4096; i += 2) {
+                map.Remove(i * 16);
+            }
+        }
+
+        done.store(true);
+        for (std::thread& reader : readers) {
+            reader.join();
+        }
+
+        REQUIRE(mismatches.load() == 0);
+        REQUIRE(map.Size() == 2048);
+    }
+}
+
+TEST_CASE("Common.ConcurrentIntervalMap.Contention", "[!benchmark]") {
+    LockedIntervalMap lockedMap;
+    ConcurrentIntervalMap<uint64_t, uint64_t> concurrentMap;
+    ConcurrentIntervalMap<uint64_t, uint64_t, true> cachedMap;
+
+    for (uint64_t i = 0; i < kIntervalCount; i++) {
+        lockedMap.Add(i * kIntervalStride, kIntervalLength, i);
+        concurrentMap.Add(i * kIntervalStride, kIntervalLength, i);
+        cachedMap.Add(i * kIntervalStride, kIntervalLength, i);
+    }
+
+    /// Random lookups across all intervals
+    auto random = [&](auto& map) {
+        std::atomic<uint64_t> sum{0};
+        RunContentionReaders([&](uint32_t reader) {
+            std::minstd_rand engine(reader);
+
+            uint64_t local = 0;
+            for (uint32_t i = 0; i < kContentionLookupCount; i++) {
+                uint64_t value = 0;
+                map.Find((engine() % kIntervalCount) * kIntervalStride + (i % kIntervalLength), value);
+                local += value;
+            }
+            sum += local;
+        });
+        return sum.load();
+    };
+
+    /// Lookups within the same interval, as with successive descriptor writes to one heap
+    auto coherent = [&](auto& map) {
+        return RunContentionLookups([&](uint32_t reader, uint32_t i) {
+            uint64_t value = 0;
+            map.Find(((reader * 64 + i / 256) % kIntervalCount) * kIntervalStride + (i % kIntervalLength), value);
+            return value;
+        });
+    };
+
+    BENCHMARK("Random.Locked Map") {
+        return random(lockedMap);
+    };
+
+    BENCHMARK("Random.Concurrent Map") {
+        return random(concurrentMap);
+    };
+
+    BENCHMARK("Coherent.Locked Map") {
+        return coherent(lockedMap);
+    };
+
+    BENCHMARK("Coherent.Concurrent Map") {
+        return coherent(concurrentMap);
+    };
+
+    BENCHMARK("Coherent.Concurrent Map, Last Hit") {
+        return coherent(cachedMap);
+    };
+
+    /// Random lookups with a single writer churning intervals beyond the read range
+    auto churn = [&](auto& map) {
+        std::atomic<bool> done{false};
+        std::thread writer([&] {
+            for (uint64_t i = 0; !done.load(); i = (i + 1) % 1024) {
+                map.Add((kIntervalCount + i) * kIntervalStride, kIntervalLength, i);
+                map.Remove((kIntervalCount + i) * kIntervalStride);
+            }
+        });
+
+        uint64_t sum = random(map);
+
+        done.store(true);
+        writer.join();
+        return sum;
+    };
+
+    BENCHMARK("Churn.Locked Map") {
+        return churn(lockedMap);
+    };
+
+    BENCHMARK("Churn.Concurrent Map") {
+        return churn(concurrentMap);
+    };
+}
@@ -0,0 +1,94 @@
+// 
+// The MIT License (MIT)
+// 
+// Copyright (c) 2024 Advanced Micro Devices, Inc.,
+// Fatalist Development AB (Avalanche Studio Group),
+// and Miguel Petersen.
+// 
+// All Rights Reserved.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy 
+// of this software and associated documentation files (the "Software"), to deal 
+// in the Software without restriction, including without limitation the rights 
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies 
+// of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, 
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#include <catch2/catch.hpp>
+
+// Backend
+#include <Backend/IL/Emitter.h>
+#include <Backend/IL/ExportOutliner.h>
+
+TEST_CASE("Backend.IL.ExportOutliner") {
+    Allocators allocators;
+
+    IL::Program program(allocators, 0x0);
+
+    IL::IdentifierMap& map = program.GetIdentifierMap();
+
+    IL::Function* fn = program.GetFunctionList().AllocFunction(map.AllocID());
+
+    IL::BasicBlock* bb = fn->GetBasicBlocks().AllocBlock(map.AllocID());
+
+    IL::Emitter<> emitter(program, *bb);
+
+    // Three sites of the same layout
+    for (uint32_t i = 0; i < 3; i++) {
+        IL::ID values[] = { emitter.UInt32(i), emitter.UInt32(i + 1) };
+        emitter.Export(0, 2u, values);
+    }
+
+    // Single site of a unique layout
+    IL::ID unique = emitter.UInt32(4);
+    emitter.Export(1, unique);
+    emitter.Return();
+
+    IL::ExportOutlinerStatistics statistics = IL::ExportOutliner(program).Outline();
+    REQUIRE(statistics.generatedFunctions == 1);
+    REQUIRE(statistics.outlinedExports == 3);
+
+    // All sites must share a single function
+    REQUIRE(program.GetFunctionList().GetCount() == 2);
+
+    // Validate all sites
+    uint32_t callCount = 0;
+    uint32_t exportCount = 0;
+    for (auto it = bb->begin(); it != bb->end(); ++it) {
+        if (auto call = it->Cast<IL::CallInstruction>()) {
+            REQUIRE(call->arguments.count == 2);
+
+            IL::Function* target = program.GetFunctionList().GetFunction(call->target);
+            REQUIRE(target);
+            REQUIRE(target != fn);
+            REQUIRE(target->GetFunctionType()->parameterTypes.size() == 2);
+            REQUIRE(program.GetTypeMap().GetType(call->result)->Is<Backend::IL::VoidType>());
+
+            // Generated function must export all parameters
+            IL::BasicBlock* entry = target->GetBasicBlocks().GetEntryPoint();
+            auto outlinedExport = entry->begin()->Cast<IL::ExportInstruction>();
+            REQUIRE(outlinedExport);
+            REQUIRE(outlinedExport->exportID == 0);
+            REQUIRE(outlinedExport->values[1] == target->GetParameters().begin()[1].id);
+            callCount++;
+        }
+
+        if (auto _export = it->Cast<IL::ExportInstruction>()) {
+            REQUIRE(_export->exportID == 1);
+            exportCount++;
+        }
+    }
+
+    REQUIRE(callCount == 3);
+    REQUIRE(exportCount == 1);
+}
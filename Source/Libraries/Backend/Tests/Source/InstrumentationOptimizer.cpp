@@ -0,0 +1,702 @@
+// 
+// The MIT License (MIT)
+// 
+// Copyright (c) 2024 Advanced Micro Devices, Inc.,
+// Fatalist Development AB (Avalanche Studio Group),
+// and Miguel Petersen.
+// 
+// All Rights Reserved.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy 
+// of this software and associated documentation files (the "Software"), to deal 
+// in the Software without restriction, including without limitation the rights 
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies 
+// of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, 
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#include <catch2/catch.hpp>
+
+// Backend
+#include <Backend/IL/Emitter.h>
+#include <Backend/IL/InstrumentationOptimizer.h>
+#include <Backend/IL/ResourceTokenEmitter.h>
+#include <Backend/IL/TypeCommon.h>
+#include <Backend/IL/Visitor.h>
+
+/// Append a user store, keeps a value alive
+static void AppendUserStore(IL::Program& program, IL::BasicBlock* bb, IL::ID address, IL::ID value) {
+    IL::StoreInstruction store{};
+    store.opCode = IL::OpCode::Store;
+    store.source = IL::Source::Code(0);
+    store.result = IL::InvalidID;
+    store.address = address;
+    store.value = value;
+    bb->Append(store);
+}
+
+/// Find the defining instruction of a value
+static const IL::Instruction* FindDefinition(IL::Program& program, IL::ID id) {
+    const IL::OpaqueInstructionRef& ref = program.GetIdentifierMap().Get(id);
+    if (!ref.IsValid()) {
+        return nullptr;
+    }
+
+    return ref.basicBlock->GetRelocationInstruction(ref.relocationOffset);
+}
+
+/// Get the value of the last store in a block
+static IL::ID GetStoredValue(IL::BasicBlock* bb) {
+    IL::ID value = IL::InvalidID;
+    for (auto it = bb->begin(); it != bb->end(); ++it) {
+        if (auto store = it->Cast<IL::StoreInstruction>()) {
+            value = store->value;
+        }
+    }
+
+    return value;
+}
+
+TEST_CASE("Backend.IL.InstrumentationOptimizer") {
+    Allocators allocators;
+
+    IL::Program program(allocators, 0x0);
+
+    IL::IdentifierMap& map = program.GetIdentifierMap();
+
+    IL::Function* fn = program.GetFunctionList().AllocFunction(map.AllocID());
+
+    IL::BasicBlock* entry = fn->GetBasicBlocks().AllocBlock(map.AllocID());
+    IL::BasicBlock* next = fn->GetBasicBlocks().AllocBlock(map.AllocID());
+
+    // Opaque user address
+    IL::ID address = map.AllocID();
+
+    SECTION("Fold") {
+        IL::Emitter<> emitter(program, *entry);
+
+        // (1 + 1) << 2, fully constant
+        IL::ID value = emitter.BitShiftLeft(emitter.Add(emitter.UInt32(1), emitter.UInt32(1)), emitter.UInt32(2));
+        AppendUserStore(program, entry, address, value);
+        emitter.Branch(next);
+
+        IL::Emitter<> nextEmitter(program, *next);
+        AppendUserStore(program, next, address, nextEmitter.UInt32(1));
+        nextEmitter.Return();
+
+        IL::InstrumentationOptimizerStatistics statistics = IL::InstrumentationOptimizer(program).Optimize();
+        REQUIRE(statistics.foldedInstructions == 2);
+        REQUIRE(statistics.mergedLiterals == 3);
+
+        // Stored value must be a literal
+        auto* literal = FindDefinition(program, GetStoredValue(entry))->Cast<IL::LiteralInstruction>();
+        REQUIRE(literal);
+        REQUIRE(literal->value.integral == 8);
+
+        // Both stores of one must share the definition
+        REQUIRE(GetStoredValue(next) != IL::InvalidID);
+        REQUIRE(FindDefinition(program, GetStoredValue(next))->Cast<IL::LiteralInstruction>()->value.integral == 1);
+
+        // Literal 8, literal 1, store, branch
+        REQUIRE(entry->GetCount() == 4);
+
+        // Store, return
+        REQUIRE(next->GetCount() == 2);
+
+        // User instructions consuming instrumentation must be recompiled
+        REQUIRE(entry->IsModified());
+    }
+
+    SECTION("Eliminate") {
+        IL::Emitter<> emitter(program, *entry);
+
+        // Opaque value, i.e. a parameter
+        IL::ID token = map.AllocID();
+        program.GetTypeMap().SetType(token, program.GetTypeMap().FindTypeOrAdd(Backend::IL::IntType {
+            .bitWidth = 32,
+            .signedness = false
+        }));
+
+        // Redundant computation
+        IL::ID a = emitter.Add(token, emitter.UInt32(4));
+        IL::ID b = emitter.Add(emitter.UInt32(4), token);
+
+        // Trivial selection
+        IL::ID select = emitter.Select(emitter.Equal(a, b), a, b);
+        AppendUserStore(program, entry, address, select);
+
+        // Unused instrumentation
+        emitter.Mul(a, emitter.UInt32(3));
+        emitter.Return();
+
+        IL::InstrumentationOptimizerStatistics statistics = IL::InstrumentationOptimizer(program).Optimize();
+        REQUIRE(statistics.eliminatedInstructions == 2);
+        REQUIRE(statistics.deadInstructions == 3);
+
+        // Store must directly consume the first addition
+        REQUIRE(GetStoredValue(entry) == a);
+
+        // Literal 4, add, store, return
+        REQUIRE(entry->GetCount() == 4);
+    }
+
+    SECTION("Hoist") {
+        IL::BasicBlock* body = fn->GetBasicBlocks().AllocBlock(map.AllocID());
+        IL::BasicBlock* exit = fn->GetBasicBlocks().AllocBlock(map.AllocID());
+
+        // Opaque condition, i.e. a parameter
+        IL::ID condition = map.AllocID();
+        program.GetTypeMap().SetType(condition, program.GetTypeMap().FindTypeOrAdd(Backend::IL::BoolType{}));
+
+        // Entry -> Header
+        IL::Emitter<>(program, *entry).Branch(next);
+
+        // Header -> Body | Exit
+        IL::ID headerToken;
+        {
+            IL::Emitter<> emitter(program, *next);
+
+            // Invariant instrumentation, the header runs whenever the loop is entered
+            headerToken = emitter.ResourceToken(address);
+            AppendUserStore(program, next, address, headerToken);
+
+            emitter.BranchConditional(condition, body, exit, IL::ControlFlow::None());
+        }
+
+        // Body -> Header
+        IL::ID bodyToken;
+        {
+            IL::Emitter<> emitter(program, *body);
+
+            // Invariant instrumentation, the body is skipped if the header exits on the first test
+            bodyToken = emitter.ResourceToken(address);
+            IL::ID offset = emitter.Add(bodyToken, emitter.UInt32(4));
+            AppendUserStore(program, body, address, offset);
+
+            // Back edge
+            emitter.Branch(next);
+        }
+
+        // Exit
+        IL::Emitter<>(program, *exit).Return();
+
+        IL::InstrumentationOptimizerStatistics statistics = IL::InstrumentationOptimizer(program).Optimize();
+
+        // Header token and the speculatable literal
+        REQUIRE(statistics.hoistedInstructions == 2);
+
+        // Zero-trip loops must not compute the body token
+        REQUIRE(program.GetIdentifierMap().Get(bodyToken).basicBlock == body);
+        REQUIRE(program.GetIdentifierMap().Get(headerToken).basicBlock == entry);
+
+        // Token, add, store and back edge
+        REQUIRE(body->GetCount() == 4);
+
+        // Token, literal and branch
+        REQUIRE(entry->GetCount() == 3);
+    }
+
+    SECTION("Hoist Do While") {
+        IL::BasicBlock* latch = fn->GetBasicBlocks().AllocBlock(map.AllocID());
+        IL::BasicBlock* exit = fn->GetBasicBlocks().AllocBlock(map.AllocID());
+
+        // Opaque condition, i.e. a parameter
+        IL::ID condition = map.AllocID();
+        program.GetTypeMap().SetType(condition, program.GetTypeMap().FindTypeOrAdd(Backend::IL::BoolType{}));
+
+        // Entry -> Header
+        IL::Emitter<>(program, *entry).Branch(next);
+
+        // Header -> Latch
+        {
+            IL::Emitter<> emitter(program, *next);
+
+            // Invariant instrumentation
+            IL::ID token = emitter.ResourceToken(address);
+            IL::ID offset = emitter.Add(token, emitter.UInt32(4));
+            AppendUserStore(program, next, address, offset);
+
+            emitter.Branch(latch);
+        }
+
+        // Latch -> Header | Exit
+        IL::Emitter<>(program, *latch).BranchConditional(condition, next, exit, IL::ControlFlow::None());
+
+        // Exit
+        IL::Emitter<>(program, *exit).Return();
+
+        IL::InstrumentationOptimizerStatistics statistics = IL::InstrumentationOptimizer(program).Optimize();
+        REQUIRE(statistics.hoistedInstructions == 3);
+
+        // Store and back edge
+        REQUIRE(next->GetCount() == 2);
+
+        // Token, literal, add and branch
+        REQUIRE(entry->GetCount() == 4);
+
+        // Stored value must be defined in the preheader
+        REQUIRE(program.GetIdentifierMap().Get(GetStoredValue(next)).basicBlock == entry);
+    }
+
+    SECTION("Hoist Conditional") {
+        IL::BasicBlock* body = fn->GetBasicBlocks().AllocBlock(map.AllocID());
+        IL::BasicBlock* latch = fn->GetBasicBlocks().AllocBlock(map.AllocID());
+        IL::BasicBlock* exit = fn->GetBasicBlocks().AllocBlock(map.AllocID());
+
+        // Opaque operands, i.e. parameters
+        IL::ID condition = map.AllocID();
+        program.GetTypeMap().SetType(condition, program.GetTypeMap().FindTypeOrAdd(Backend::IL::BoolType{}));
+
+        IL::ID value = map.AllocID();
+        program.GetTypeMap().SetType(value, program.GetTypeMap().FindTypeOrAdd(Backend::IL::IntType {
+            .bitWidth = 32,
+            .signedness = false
+        }));
+
+        // Entry -> Header
+        IL::Emitter<>(program, *entry).Branch(next);
+
+        // Header -> Body | Latch
+        IL::Emitter<>(program, *next).BranchConditional(condition, body, latch, IL::ControlFlow::None());
+
+        // Body -> Latch, not executed on every iteration
+        IL::ID div;
+        IL::ID add;
+        {
+            IL::Emitter<> emitter(program, *body);
+            div = emitter.Div(value, value);
+            add = emitter.Add(value, value);
+            AppendUserStore(program, body, address, div);
+            AppendUserStore(program, body, address, add);
+            emitter.Branch(latch);
+        }
+
+        // Latch -> Header | Exit
+        IL::Emitter<>(program, *latch).BranchConditional(condition, next, exit, IL::ControlFlow::None());
+
+        // Exit
+        IL::Emitter<>(program, *exit).Return();
+
+        IL::InstrumentationOptimizerStatistics statistics = IL::InstrumentationOptimizer(program).Optimize();
+        REQUIRE(statistics.hoistedInstructions == 1);
+
+        // Division may fault on paths it never ran on
+        REQUIRE(program.GetIdentifierMap().Get(div).basicBlock == body);
+
+        // Addition is freely speculated
+        REQUIRE(program.GetIdentifierMap().Get(add).basicBlock == entry);
+    }
+
+    SECTION("Hoist Preheader") {
+        IL::BasicBlock* latch = fn->GetBasicBlocks().AllocBlock(map.AllocID());
+        IL::BasicBlock* exit = fn->GetBasicBlocks().AllocBlock(map.AllocID());
+
+        // Opaque operands, i.e. parameters
+        IL::ID condition = map.AllocID();
+        program.GetTypeMap().SetType(condition, program.GetTypeMap().FindTypeOrAdd(Backend::IL::BoolType{}));
+
+        IL::ID value = map.AllocID();
+        program.GetTypeMap().SetType(value, program.GetTypeMap().FindTypeOrAdd(Backend::IL::IntType {
+            .bitWidth = 32,
+            .signedness = false
+        }));
+
+        // Entry -> Header | Exit, the entry is not a dedicated preheader
+        IL::Emitter<>(program, *entry).BranchConditional(condition, next, exit, IL::ControlFlow::None());
+
+        // Header -> Latch
+        IL::ID phi;
+        IL::ID add;
+        {
+            IL::Emitter<> emitter(program, *next);
+
+            // Loop carried value, entered with the opaque value
+            phi = map.AllocID();
+            emitter.Phi(phi, entry, value, latch, phi);
+
+            // Invariant instrumentation
+            add = emitter.Add(value, value);
+            AppendUserStore(program, next, address, add);
+
+            emitter.Branch(latch);
+        }
+
+        // Latch -> Header | Exit
+        IL::Emitter<>(program, *latch).BranchConditional(condition, next, exit, IL::ControlFlow::None());
+
+        // Exit
+        IL::Emitter<>(program, *exit).Return();
+
+        IL::InstrumentationOptimizerStatistics statistics = IL::InstrumentationOptimizer(program).Optimize();
+        REQUIRE(statistics.hoistedInstructions == 1);
+
+        // Hoisted into a new block, entered from the entry
+        IL::BasicBlock* preheader = program.GetIdentifierMap().Get(add).basicBlock;
+        REQUIRE(preheader != entry);
+        REQUIRE(preheader != next);
+        REQUIRE(fn->GetBasicBlocks().GetBlockCount() == 5);
+
+        // Entry must branch to the preheader
+        auto* branch = entry->GetTerminator()->As<IL::BranchConditionalInstruction>();
+        REQUIRE(branch->pass == preheader->GetID());
+        REQUIRE(branch->fail == exit->GetID());
+
+        // Preheader must only enter the loop
+        REQUIRE(preheader->GetTerminator()->As<IL::BranchInstruction>()->branch == next->GetID());
+
+        // Phi must be entered from the preheader
+        auto* phiInstr = FindDefinition(program, phi)->As<IL::PhiInstruction>();
+        REQUIRE(phiInstr->values[0].branch == preheader->GetID());
+        REQUIRE(phiInstr->values[1].branch == latch->GetID());
+    }
+
+    SECTION("Hoist Preheader Merge") {
+        IL::BasicBlock* side = fn->GetBasicBlocks().AllocBlock(map.AllocID());
+        IL::BasicBlock* latch = fn->GetBasicBlocks().AllocBlock(map.AllocID());
+        IL::BasicBlock* exit = fn->GetBasicBlocks().AllocBlock(map.AllocID());
+
+        // Opaque operands, i.e. parameters
+        IL::ID condition = map.AllocID();
+        program.GetTypeMap().SetType(condition, program.GetTypeMap().FindTypeOrAdd(Backend::IL::BoolType{}));
+
+        IL::ID value = map.AllocID();
+        program.GetTypeMap().SetType(value, program.GetTypeMap().FindTypeOrAdd(Backend::IL::IntType {
+            .bitWidth = 32,
+            .signedness = false
+        }));
+
+        IL::ID other = map.AllocID();
+        program.GetTypeMap().SetType(other, program.GetTypeMap().GetType(value));
+
+        // Entry -> Header | Side -> Header, the loop has two entries
+        IL::Emitter<>(program, *entry).BranchConditional(condition, next, side, IL::ControlFlow::None());
+        IL::Emitter<>(program, *side).Branch(next);
+
+        // Header -> Latch
+        IL::ID phi;
+        {
+            IL::Emitter<> emitter(program, *next);
+
+            // Loop carried value, entered with a different value per entry
+            phi = map.AllocID();
+            IL::PhiValue values[] = {
+                IL::PhiValue { .value = value, .branch = entry->GetID() },
+                IL::PhiValue { .value = other, .branch = side->GetID() },
+                IL::PhiValue { .value = phi, .branch = latch->GetID() }
+            };
+            emitter.Phi(phi, 3u, values);
+
+            // Invariant instrumentation
+            AppendUserStore(program, next, address, emitter.Add(value, value));
+
+            emitter.Branch(latch);
+        }
+
+        // Latch -> Header | Exit
+        IL::Emitter<>(program, *latch).BranchConditional(condition, next, exit, IL::ControlFlow::None());
+
+        // Exit
+        IL::Emitter<>(program, *exit).Return();
+
+        IL::InstrumentationOptimizerStatistics statistics = IL::InstrumentationOptimizer(program).Optimize();
+        REQUIRE(statistics.hoistedInstructions == 1);
+
+        // Header must now be entered from the preheader and the latch
+        auto* phiInstr = FindDefinition(program, phi)->As<IL::PhiInstruction>();
+        REQUIRE(phiInstr->values.count == 2);
+        REQUIRE(phiInstr->values[0].branch == latch->GetID());
+
+        // Both entries must be merged in the preheader
+        IL::BasicBlock* preheader = fn->GetBasicBlocks().GetBlock(phiInstr->values[1].branch);
+        auto* merged = FindDefinition(program, phiInstr->values[1].value)->As<IL::PhiInstruction>();
+        REQUIRE(program.GetIdentifierMap().Get(phiInstr->values[1].value).basicBlock == preheader);
+        REQUIRE(merged->values.count == 2);
+        REQUIRE(merged->values[0].branch == entry->GetID());
+        REQUIRE(merged->values[1].branch == side->GetID());
+
+        // Both entries must branch to the preheader
+        REQUIRE(entry->GetTerminator()->As<IL::BranchConditionalInstruction>()->pass == preheader->GetID());
+        REQUIRE(side->GetTerminator()->As<IL::BranchInstruction>()->branch == preheader->GetID());
+    }
+
+    SECTION("Hoist Uninstrumented") {
+        IL::BasicBlock* latch = fn->GetBasicBlocks().AllocBlock(map.AllocID());
+        IL::BasicBlock* exit = fn->GetBasicBlocks().AllocBlock(map.AllocID());
+
+        // Opaque operands, i.e. parameters
+        IL::ID condition = map.AllocID();
+        program.GetTypeMap().SetType(condition, program.GetTypeMap().FindTypeOrAdd(Backend::IL::BoolType{}));
+
+        IL::ID value = map.AllocID();
+        program.GetTypeMap().SetType(value, program.GetTypeMap().FindTypeOrAdd(Backend::IL::IntType {
+            .bitWidth = 32,
+            .signedness = false
+        }));
+
+        // Entry -> Header | Exit, the entry is not a dedicated preheader
+        IL::Emitter<>(program, *entry).BranchConditional(condition, next, exit, IL::ControlFlow::None());
+
+        // Header -> Latch
+        IL::ID phi;
+        {
+            IL::Emitter<> emitter(program, *next);
+
+            // Loop carried value, entered with the opaque value
+            phi = map.AllocID();
+            emitter.Phi(phi, entry, value, latch, phi);
+
+            // Invariant user instruction, never hoisted
+            IL::AddInstruction add{};
+            add.opCode = IL::OpCode::Add;
+            add.source = IL::Source::Code(0);
+            add.result = map.AllocID();
+            add.lhs = value;
+            add.rhs = value;
+            next->Append(add);
+            AppendUserStore(program, next, address, add.result);
+
+            emitter.Branch(latch);
+        }
+
+        // Latch -> Header | Exit
+        IL::Emitter<>(program, *latch).BranchConditional(condition, next, exit, IL::ControlFlow::None());
+
+        // Exit
+        IL::Emitter<>(program, *exit).Return();
+
+        IL::InstrumentationOptimizerStatistics statistics = IL::InstrumentationOptimizer(program).Optimize();
+        REQUIRE(statistics.hoistedInstructions == 0);
+
+        // Nothing to hoist, no preheader may be inserted
+        REQUIRE(fn->GetBasicBlocks().GetBlockCount() == 4);
+
+        // Entry must still enter the header
+        auto* branch = entry->GetTerminator()->As<IL::BranchConditionalInstruction>();
+        REQUIRE(branch->pass == next->GetID());
+        REQUIRE(branch->fail == exit->GetID());
+
+        // Phi must still be entered from the entry
+        auto* phiInstr = FindDefinition(program, phi)->As<IL::PhiInstruction>();
+        REQUIRE(phiInstr->values[0].branch == entry->GetID());
+        REQUIRE(phiInstr->values[1].branch == latch->GetID());
+        REQUIRE(next->GetCount() == 4);
+    }
+
+    SECTION("User") {
+        IL::Emitter<> emitter(program, *entry);
+
+        // User literals are never touched
+        IL::LiteralInstruction literal{};
+        literal.opCode = IL::OpCode::Literal;
+        literal.source = IL::Source::Code(0);
+        literal.result = map.AllocID();
+        literal.type = IL::LiteralType::Int;
+        literal.bitWidth = 32;
+        literal.value.integral = 1;
+        entry->Append(literal);
+
+        emitter.Return();
+
+        IL::InstrumentationOptimizerStatistics statistics = IL::InstrumentationOptimizer(program).Optimize();
+        REQUIRE(statistics.deadInstructions == 0);
+        REQUIRE(entry->GetCount() == 2);
+    }
+}
+
+/// Get the number of instructions in a program
+static uint32_t GetInstructionCount(IL::Program& program) {
+    uint32_t count = 0;
+    for (IL::Function* function : program.GetFunctionList()) {
+        for (IL::BasicBlock* basicBlock : function->GetBasicBlocks()) {
+            count += basicBlock->GetCount();
+        }
+    }
+
+    return count;
+}
+
+/// Append a user instruction
+template<typename T>
+static IL::ID AppendUserInstruction(IL::Program& program, IL::BasicBlock* bb, T instr, const Backend::IL::Type* type) {
+    instr.opCode = T::kOpCode;
+    instr.source = IL::Source::Code(bb->GetCount());
+    instr.result = type ? program.GetIdentifierMap().AllocID() : IL::InvalidID;
+    bb->Append(instr);
+
+    if (type) {
+        program.GetTypeMap().SetType(instr.result, type);
+    }
+
+    return instr.result;
+}
+
+/// Pack a non-structured export field, mirrors the generated shader export construction
+static IL::ID PackExportField(IL::Emitter<>& emitter, IL::ID primary, IL::ID value, uint32_t bitMask, uint32_t bitOffset) {
+    return emitter.BitOr(primary, emitter.BitShiftLeft(emitter.BitAnd(value, emitter.UInt32(bitMask)), emitter.UInt(32, bitOffset)));
+}
+
+/// Inject resource bounds checks on all buffer and texture accesses, mirrors the resource bounds feature
+static void InjectResourceBounds(IL::Program& program, bool detail) {
+    const Backend::IL::Type* uint32Type = program.GetTypeMap().FindTypeOrAdd(Backend::IL::IntType {.bitWidth = 32, .signedness = false});
+
+    IL::VisitUserInstructions(program, [&](IL::VisitContext& context, IL::BasicBlock::Iterator it) -> IL::BasicBlock::Iterator {
+        IL::ID resource;
+        IL::ID index;
+        uint32_t isTexture;
+        uint32_t isWrite;
+
+        // Instruction of interest?
+        switch (it->opCode) {
+            default:
+                return it;
+            case IL::OpCode::LoadBuffer:
+                resource = it->As<IL::LoadBufferInstruction>()->buffer;
+                index = it->As<IL::LoadBufferInstruction>()->index;
+                isTexture = 0;
+                isWrite = 0;
+                break;
+            case IL::OpCode::StoreBuffer:
+                resource = it->As<IL::StoreBufferInstruction>()->buffer;
+                index = it->As<IL::StoreBufferInstruction>()->index;
+                isTexture = 0;
+                isWrite = 1;
+                break;
+            case IL::OpCode::LoadTexture:
+                resource = it->As<IL::LoadTextureInstruction>()->texture;
+                index = it->As<IL::LoadTextureInstruction>()->index;
+                isTexture = 1;
+                isWrite = 0;
+                break;
+            case IL::OpCode::StoreTexture:
+                resource = it->As<IL::StoreTextureInstruction>()->texture;
+                index = it->As<IL::StoreTextureInstruction>()->index;
+                isTexture = 1;
+                isWrite = 1;
+                break;
+        }
+
+        // Split at the access
+        IL::BasicBlock* resumeBlock = context.function.GetBasicBlocks().AllocBlock();
+        auto instr = context.basicBlock.Split(resumeBlock, it);
+
+        // Out of bounds block
+        IL::Emitter<> oob(program, *context.function.GetBasicBlocks().AllocBlock());
+        oob.AddBlockFlag(BasicBlockFlag::NoInstrumentation);
+
+        // Primary key, chunk mask, sguid and flags
+        IL::ID dwords[5];
+        uint32_t dwordCount = 1;
+        dwords[0] = oob.UInt(32, detail ? 1u << 31u : 0u);
+        dwords[0] = PackExportField(oob, dwords[0], oob.UInt32(static_cast<uint32_t>(context.basicBlock.GetID())), 0xFFFF, 0);
+        dwords[0] = PackExportField(oob, dwords[0], oob.UInt32(isTexture), 0x1, 16);
+        dwords[0] = PackExportField(oob, dwords[0], oob.UInt32(isWrite), 0x1, 17);
+
+        // Detail chunk, token and coordinates
+        if (detail) {
+            IL::ID zero = oob.UInt32(0);
+            dwords[dwordCount++] = IL::ResourceTokenEmitter(oob, resource).GetToken();
+
+            if (isTexture) {
+                dwords[dwordCount++] = oob.Extract(index, 0);
+                dwords[dwordCount++] = oob.Extract(index, 1);
+            } else {
+                dwords[dwordCount++] = index;
+                dwords[dwordCount++] = zero;
+            }
+
+            dwords[dwordCount++] = zero;
+        }
+
+        oob.Export(0, dwordCount, dwords);
+        oob.Branch(resumeBlock);
+
+        // Is any of the indices larger than the resource size
+        IL::Emitter<> pre(program, context.basicBlock);
+        IL::ID cond = pre.Any(pre.GreaterThanEqual(pre.BitCast(index, Backend::IL::SplatToValue(program, uint32Type, index)), pre.ResourceSize(resource)));
+        pre.BranchConditional(cond, oob.GetBasicBlock(), resumeBlock, IL::ControlFlow::Selection(resumeBlock));
+        return instr;
+    });
+}
+
+TEST_CASE("Backend.IL.InstrumentationOptimizer.Statistics") {
+    // Resource bounds simple test, buffer and texture reads and writes
+    for (bool detail : {false, true}) {
+        Allocators allocators;
+
+        IL::Program program(allocators, 0x0);
+
+        IL::IdentifierMap& map = program.GetIdentifierMap();
+        Backend::IL::TypeMap& typeMap = program.GetTypeMap();
+
+        IL::Function* fn = program.GetFunctionList().AllocFunction(map.AllocID());
+        IL::BasicBlock* entry = fn->GetBasicBlocks().AllocBlock(map.AllocID());
+
+        // Types
+        const Backend::IL::Type* uintType = typeMap.FindTypeOrAdd(Backend::IL::IntType {.bitWidth = 32, .signedness = false});
+        const Backend::IL::Type* floatType = typeMap.FindTypeOrAdd(Backend::IL::FPType {.bitWidth = 32});
+
+        // Resources, RWBuffer<float> and RWTexture2D<float>
+        IL::ID bufferRW = map.AllocID();
+        typeMap.SetType(bufferRW, typeMap.FindTypeOrAdd(Backend::IL::BufferType {
+            .elementType = floatType,
+            .samplerMode = Backend::IL::ResourceSamplerMode::Writable,
+            .texelType = Backend::IL::Format::R32Float
+        }));
+
+        IL::ID textureRW = map.AllocID();
+        typeMap.SetType(textureRW, typeMap.FindTypeOrAdd(Backend::IL::TextureType {
+            .sampledType = floatType,
+            .dimension = Backend::IL::TextureDimension::Texture2D,
+            .samplerMode = Backend::IL::ResourceSamplerMode::Writable,
+            .format = Backend::IL::Format::R32Float
+        }));
+
+        // Opaque coordinates, i.e. derived from the dispatch index
+        IL::ID index = map.AllocID();
+        typeMap.SetType(index, uintType);
+
+        IL::ID coordinate = map.AllocID();
+        typeMap.SetType(coordinate, typeMap.FindTypeOrAdd(Backend::IL::VectorType {
+            .containedType = uintType,
+            .dimension = 2
+        }));
+
+        // noOpt += bufferRW[index], noOpt += textureRW[coordinate]
+        IL::ID bufferValue = AppendUserInstruction(program, entry, IL::LoadBufferInstruction { .buffer = bufferRW, .index = index, .offset = IL::InvalidID }, floatType);
+        IL::ID textureValue = AppendUserInstruction(program, entry, IL::LoadTextureInstruction { .texture = textureRW, .index = coordinate, .offset = IL::InvalidID, .mip = IL::InvalidID }, floatType);
+
+        // bufferRW[index] = noOpt, textureRW[coordinate] = noOpt
+        AppendUserInstruction(program, entry, IL::StoreBufferInstruction { .buffer = bufferRW, .index = index, .value = bufferValue }, nullptr);
+        AppendUserInstruction(program, entry, IL::StoreTextureInstruction { .texture = textureRW, .index = coordinate, .texel = textureValue }, nullptr);
+        IL::Emitter<>(program, *entry).Return();
+
+        // Instrument
+        InjectResourceBounds(program, detail);
+        uint32_t instrumentedCount = GetInstructionCount(program);
+
+        // Optimize
+        IL::InstrumentationOptimizerStatistics statistics = IL::InstrumentationOptimizer(program).Optimize();
+        uint32_t optimizedCount = GetInstructionCount(program);
+
+        // Recorded instruction counts, the user program is 5 instructions
+        if (detail) {
+            REQUIRE(instrumentedCount == 121);
+            REQUIRE(optimizedCount == 40);
+        } else {
+            REQUIRE(instrumentedCount == 109);
+            REQUIRE(optimizedCount == 31);
+        }
+
+        // Constant export keys must be folded
+        REQUIRE(statistics.foldedInstructions > 0);
+    }
+}
@@ -0,0 +1,144 @@
+// 
+// The MIT License (MIT)
+// 
+// Copyright (c) 2024 Advanced Micro Devices, Inc.,
+// Fatalist Development AB (Avalanche Studio Group),
+// and Miguel Petersen.
+// 
+// All Rights Reserved.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy 
+// of this software and associated documentation files (the "Software"), to deal 
+// in the Software without restriction, including without limitation the rights 
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies 
+// of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, 
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#include <catch2/catch.hpp>
+
+// Common
+#include <Common/Containers/PublishedHashMap.h>
+
+// Common Tests
+#include <Common/Tests/ReaderContention.h>
+
+// Std
+#include <thread>
+
+TEST_CASE("Common.PublishedHashMap") {
+    PublishedHashMap<uint64_t, uint64_t> map;
+
+    SECTION("Insertion") {
+        for (uint64_t i = 0; i < 1024; i++) {
+            map.Set(i, i * 2);
+        }
+
+        REQUIRE(map.Size() == 1024);
+
+        for (uint64_t i = 0; i < 1024; i++) {
+            uint64_t value = 0;
+            REQUIRE(map.Find(i, value));
+            REQUIRE(value == i * 2);
+        }
+
+        uint64_t value = 0;
+        REQUIRE(!map.Find(1024, value));
+    }
+
+    SECTION("Reservation") {
+        REQUIRE(map.TryInsert(4, 0));
+        REQUIRE(!map.TryInsert(4, 1));
+        REQUIRE(map.Contains(4));
+
+        // Reserved entries are updated in place
+        map.Set(4, 8);
+
+        uint64_t value = 0;
+        REQUIRE(map.Find(4, value));
+        REQUIRE(value == 8);
+        REQUIRE(map.Size() == 1);
+    }
+
+    SECTION("Aligned Keys") {
+        // Pointer like keys, low bits are always zero
+        for (uint64_t i = 1; i <= 1024; i++) {
+            map.Set(i << 16, i);
+        }
+
+        REQUIRE(map.Size() == 1024);
+
+        for (uint64_t i = 1; i <= 1024; i++) {
+            uint64_t value = 0;
+            REQUIRE(map.Find(i << 16, value));
+            REQUIRE(value == i);
+        }
+
+        REQUIRE(!map.Contains(1025ull << 16));
+    }
+
+    SECTION("Concurrent Growth") {
+        std::atomic<bool> done{false};
+        std::atomic<uint32_t> mismatches{0};
+
+        // Readers must only ever observe complete entries
+        std::thread reader([&] {
+            while (!done.load()) {
+                for (uint64_t i = 0; i < 4096; i++) {
+                    uint64_t value = 0;
+                    if (map.Find(i, value) && value != i + 1) {
+                        mismatches++;
+                    }
+                }
+            }
+        });
+
+        for (uint64_t i = 0; i < 4096; i++) {
+            map.Set(i, i + 1);
+        }
+
+        done.store(true);
+        reader.join();
+
+        REQUIRE(mismatches.load() == 0);
+        REQUIRE(map.Size() == 4096);
+    }
+}
+
+TEST_CASE("Common.PublishedHashMap.Contention") {
+    // Typical number of instruments per object
+    constexpr uint64_t kKeyCount = 8;
+
+    LockedContentionMap<uint64_t, uint64_t> lockedMap;
+    PublishedHashMap<uint64_t, uint64_t> publishedMap;
+
+    for (uint64_t i = 0; i < kKeyCount; i++) {
+        lockedMap.Set(i, i);
+        publishedMap.Set(i, i);
+    }
+
+    BENCHMARK("Locked Map") {
+        return RunContentionLookups([&](uint32_t reader, uint32_t i) {
+            return lockedMap.Read([&](const auto& entries) {
+                return entries.find((reader + i) % kKeyCount)->second;
+            });
+        });
+    };
+
+    BENCHMARK("Published Map") {
+        return RunContentionLookups([&](uint32_t reader, uint32_t i) {
+            uint64_t value = 0;
+            publishedMap.Find((reader + i) % kKeyCount, value);
+            return value;
+        });
+    };
+}
@@ -0,0 +1,190 @@
+// 
+// The MIT License (MIT)
+// 
+// Copyright (c) 2024 Advanced Micro Devices, Inc.,
+// Fatalist Development AB (Avalanche Studio Group),
+// and Miguel Petersen.
+// 
+// All Rights Reserved.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy 
+// of this software and associated documentation files (the "Software"), to deal 
+// in the Software without restriction, including without limitation the rights 
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies 
+// of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, 
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#include <catch2/catch.hpp>
+
+// Backend
+#include <Backend/ShaderSourceStore.h>
+
+// Common
+#include <Common/Registry.h>
+
+// Std
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+/// Create a synthetic source file
+static std::string CreateSource(uint32_t seed, uint32_t lineCount) {
+    std::string source;
+
+    for (uint32_t i = 0; i < lineCount; i++) {
+        source += "float value" + std::to_string(seed) + "_" + std::to_string(i) + " = " + std::to_string(i * 3) + ";";
+
+        // Mix in some empty lines
+        source += i % 7 ? "\n" : "\n\n";
+    }
+
+    return source;
+}
+
+/// Per character line offset summarization
+static void SummarizeLineOffsetsNaive(const std::string_view& contents, std::vector<uint32_t>& out) {
+    out.push_back(0);
+
+    for (uint32_t i = 0; i < contents.length(); i++) {
+        if (contents[i] == '\n') {
+            out.push_back(i + 1);
+        }
+    }
+}
+
+TEST_CASE("Backend.ShaderSourceStore") {
+    Registry registry;
+
+    // Create store
+    ComRef<ShaderSourceStore> store = registry.AddNew<ShaderSourceStore>();
+
+    SECTION("Deduplication") {
+        std::string source = CreateSource(0, 64);
+
+        // Same contents, same blob
+        const ShaderSourceBlob* first = store->Acquire(std::string_view(source));
+        const ShaderSourceBlob* second = store->Acquire(std::string(source));
+        REQUIRE(first == second);
+        REQUIRE(first->contents == source);
+
+        // Different contents, different blob
+        const ShaderSourceBlob* other = store->Acquire(std::string_view(CreateSource(1, 64)));
+        REQUIRE(other != first);
+
+        // Only unique contents are stored
+        REQUIRE(store->GetBlobCount() == 2);
+        REQUIRE(store->GetByteCount() == source.length() + other->contents.length());
+
+        // Blobs live until the last user
+        store->Release(first);
+        REQUIRE(store->GetBlobCount() == 2);
+        REQUIRE(second->contents == source);
+
+        // Release all
+        store->Release(second);
+        store->Release(other);
+        REQUIRE(store->GetBlobCount() == 0);
+        REQUIRE(store->GetByteCount() == 0);
+    }
+
+    SECTION("Line Offsets") {
+        std::string source = CreateSource(0, 1024);
+
+        // Expected offsets
+        std::vector<uint32_t> expected;
+        SummarizeLineOffsetsNaive(source, expected);
+
+        // Must match
+        const ShaderSourceBlob* blob = store->Acquire(std::string_view(source));
+        REQUIRE(std::equal(blob->lineOffsets.begin(), blob->lineOffsets.end(), expected.begin(), expected.end()));
+        REQUIRE(ShaderSourceStore::CountLines(source) + 1 == blob->lineOffsets.size());
+        store->Release(blob);
+
+        // Edge cases
+        for (const char* contents : {"", "\n", "a", "a\n", "\n\na", "a\nb\n\n"}) {
+            Vector<uint32_t> offsets(Allocators{});
+            ShaderSourceStore::SummarizeLineOffsets(contents, offsets);
+
+            // Expected offsets
+            expected.clear();
+            SummarizeLineOffsetsNaive(contents, expected);
+            REQUIRE(std::equal(offsets.begin(), offsets.end(), expected.begin(), expected.end()));
+        }
+    }
+
+    SECTION("Concurrent") {
+        std::vector<std::string> sources;
+        for (uint32_t i = 0; i < 8; i++) {
+            sources.push_back(CreateSource(i, 32));
+        }
+
+        // Number of mismatched blobs, assertions are not thread safe
+        std::atomic<uint32_t> mismatches{0};
+
+        // Acquire and release the same sources from all threads
+        std::vector<std::thread> threads;
+        for (uint32_t i = 0; i < 8; i++) {
+            threads.emplace_back([&, i] {
+                for (uint32_t j = 0; j < 1000; j++) {
+                    const std::string& source = sources[(i + j) % sources.size()];
+
+                    const ShaderSourceBlob* blob = store->Acquire(std::string_view(source));
+                    mismatches += blob->contents != source;
+                    store->Release(blob);
+                }
+            });
+        }
+
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+
+        // All released
+        REQUIRE(mismatches == 0);
+        REQUIRE(store->GetBlobCount() == 0);
+    }
+}
+
+TEST_CASE("Backend.ShaderSourceStore.Benchmark", "[!benchmark]") {
+    Registry registry;
+
+    // Create store
+    ComRef<ShaderSourceStore> store = registry.AddNew<ShaderSourceStore>();
+
+    // Typical include heavy file
+    std::string source = CreateSource(0, 1u << 16u);
+
+    BENCHMARK("Naive Line Offsets") {
+        std::vector<uint32_t> offsets;
+        SummarizeLineOffsetsNaive(source, offsets);
+        return offsets.size();
+    };
+
+    BENCHMARK("Line Offsets") {
+        Vector<uint32_t> offsets(Allocators{});
+        ShaderSourceStore::SummarizeLineOffsets(source, offsets);
+        return offsets.size();
+    };
+
+    // Keep a user, mirrors previously compiled permutations
+    const ShaderSourceBlob* shared = store->Acquire(std::string_view(source));
+
+    BENCHMARK("Acquire Shared") {
+        const ShaderSourceBlob* blob = store->Acquire(std::string_view(source));
+        store->Release(blob);
+    };
+
+    // Cleanup
+    store->Release(shared);
+}
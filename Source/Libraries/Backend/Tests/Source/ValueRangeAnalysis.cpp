@@ -0,0 +1,159 @@
+// 
+// The MIT License (MIT)
+// 
+// Copyright (c) 2024 Advanced Micro Devices, Inc.,
+// Fatalist Development AB (Avalanche Studio Group),
+// and Miguel Petersen.
+// 
+// All Rights Reserved.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy 
+// of this software and associated documentation files (the "Software"), to deal 
+// in the Software without restriction, including without limitation the rights 
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies 
+// of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, 
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#include <catch2/catch.hpp>
+
+// Backend
+#include <Backend/IL/Emitter.h>
+#include <Backend/IL/ValueRangeAnalysis.h>
+
+/// Allocate an opaque value of a given type, i.e. a parameter
+static IL::ID AllocOpaque(IL::Program& program, const Backend::IL::Type* type) {
+    IL::ID id = program.GetIdentifierMap().AllocID();
+    program.GetTypeMap().SetType(id, type);
+    return id;
+}
+
+TEST_CASE("Backend.IL.ValueRangeAnalysis") {
+    Allocators allocators;
+
+    IL::Program program(allocators, 0x0);
+
+    IL::IdentifierMap& map = program.GetIdentifierMap();
+
+    IL::Function* fn = program.GetFunctionList().AllocFunction(map.AllocID());
+
+    IL::BasicBlock* entry = fn->GetBasicBlocks().AllocBlock(map.AllocID());
+
+    const Backend::IL::Type* uint32Type = program.GetTypeMap().FindTypeOrAdd(Backend::IL::IntType {
+        .bitWidth = 32,
+        .signedness = false
+    });
+
+    const Backend::IL::Type* int32Type = program.GetTypeMap().FindTypeOrAdd(Backend::IL::IntType {
+        .bitWidth = 32,
+        .signedness = true
+    });
+
+    SECTION("Arithmetic") {
+        IL::Emitter<> emitter(program, *entry);
+
+        IL::ID value = AllocOpaque(program, uint32Type);
+
+        // value & 7
+        IL::ID masked = emitter.BitAnd(value, emitter.UInt32(7));
+
+        // value >> 28
+        IL::ID shifted = emitter.BitShiftRight(value, emitter.UInt32(28));
+
+        // (value & 7) + 2
+        IL::ID offset = emitter.Add(masked, emitter.UInt32(2));
+
+        // value + 1, may wrap
+        IL::ID wrapped = emitter.Add(value, emitter.UInt32(1));
+
+        // Signed values are unbounded below
+        IL::ID signedValue = AllocOpaque(program, int32Type);
+        emitter.Return();
+
+        IL::ValueRangeAnalysis analysis(program);
+        analysis.Compute();
+
+        REQUIRE(analysis.IsWithin(masked, 0, 7));
+        REQUIRE(analysis.IsWithin(shifted, 0, 15));
+        REQUIRE(analysis.IsWithin(offset, 2, 9));
+        REQUIRE(!analysis.IsWithin(offset, 0, 8));
+        REQUIRE(!analysis.IsWithin(wrapped, 1, 0xFFFFFFFFu));
+        REQUIRE(!analysis.IsWithin(signedValue, 0, 0x7FFFFFFF));
+    }
+
+    SECTION("Clamp") {
+        IL::Emitter<> emitter(program, *entry);
+
+        IL::ID value = AllocOpaque(program, uint32Type);
+
+        // min(max(value, 2), 12)
+        IL::ID lower = emitter.UInt32(2);
+        IL::ID upper = emitter.UInt32(12);
+        IL::ID max = emitter.Select(emitter.GreaterThan(value, lower), value, lower);
+        IL::ID min = emitter.Select(emitter.LessThan(upper, max), upper, max);
+        emitter.Return();
+
+        IL::ValueRangeAnalysis analysis(program);
+        analysis.Compute();
+
+        REQUIRE(analysis.IsWithin(max, 2, 0xFFFFFFFFu));
+        REQUIRE(analysis.IsWithin(min, 2, 12));
+    }
+
+    SECTION("Induction") {
+        IL::BasicBlock* header = fn->GetBasicBlocks().AllocBlock(map.AllocID());
+        IL::BasicBlock* body = fn->GetBasicBlocks().AllocBlock(map.AllocID());
+        IL::BasicBlock* exit = fn->GetBasicBlocks().AllocBlock(map.AllocID());
+
+        // Induction variable, defined ahead of its increment
+        IL::ID phi = AllocOpaque(program, uint32Type);
+
+        // Entry -> Header
+        IL::Emitter<> entryEmitter(program, *entry);
+        IL::ID init = entryEmitter.UInt32(0);
+        entryEmitter.Branch(header);
+
+        // Body -> Header
+        IL::Emitter<> bodyEmitter(program, *body);
+        IL::ID index = bodyEmitter.Add(phi, bodyEmitter.UInt32(4));
+        IL::ID next = bodyEmitter.Add(phi, bodyEmitter.UInt32(1));
+        bodyEmitter.Branch(header);
+
+        // Header -> Body | Exit, for (i = 0; i < 16; i++)
+        IL::Emitter<> headerEmitter(program, *header);
+        headerEmitter.Phi(phi, entry, init, body, next);
+        headerEmitter.BranchConditional(headerEmitter.LessThan(phi, headerEmitter.UInt32(16)), body, exit, IL::ControlFlow::None());
+
+        SECTION("Body") {
+            IL::Emitter<>(program, *exit).Return();
+
+            IL::ValueRangeAnalysis analysis(program);
+            analysis.Compute();
+
+            REQUIRE(analysis.IsWithin(phi, 0, 15));
+            REQUIRE(analysis.IsWithin(index, 4, 19));
+            REQUIRE(analysis.IsWithin(next, 1, 16));
+        }
+
+        SECTION("Escape") {
+            // Exit observes the final value
+            IL::Emitter<> exitEmitter(program, *exit);
+            exitEmitter.Add(phi, exitEmitter.UInt32(1));
+            exitEmitter.Return();
+
+            IL::ValueRangeAnalysis analysis(program);
+            analysis.Compute();
+
+            REQUIRE(!analysis.IsWithin(phi, 0, 15));
+        }
+    }
+}
@@ -0,0 +1,207 @@
+// 
+// The MIT License (MIT)
+// 
+// Copyright (c) 2024 Advanced Micro Devices, Inc.,
+// Fatalist Development AB (Avalanche Studio Group),
+// and Miguel Petersen.
+// 
+// All Rights Reserved.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy 
+// of this software and associated documentation files (the "Software"), to deal 
+// in the Software without restriction, including without limitation the rights 
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies 
+// of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, 
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma once
+
+// Common
+#include <Common/Allocators.h>
+#include <Common/Assert.h>
+
+// Std
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+/// Resettable bump allocator
+///   All frees are deferred until the arena is reset, chunks are recycled across resets.
+///   Not thread safe, intended to be owned by a single job at a time.
+class ArenaAllocator {
+public:
+    /// Default chunk size
+    static constexpr size_t kDefaultChunkSize = 1u << 20u;
+
+    /// Constructor
+    /// \param allocators backing allocators, used for chunk allocations
+    /// \param chunkSize the default size of each chunk
+    ArenaAllocator(const Allocators& allocators = {}, size_t chunkSize = kDefaultChunkSize) : allocators(allocators), chunkSize(chunkSize) {
+
+    }
+
+    /// Destructor
+    ~ArenaAllocator() {
+        Release();
+    }
+
+    /// No copy
+    ArenaAllocator(const ArenaAllocator& other) = delete;
+    ArenaAllocator& operator=(const ArenaAllocator& other) = delete;
+
+    /// Allocate from this arena
+    /// \param size byte size of the allocation
+    /// \param align expected alignment, must be a power of two
+    /// \return base address
+    void* Allocate(size_t size, size_t align) {
+        ASSERT((align & (align - 1)) == 0, "Alignment must be a power of two");
+
+        // Track
+        allocationCount++;
+        allocationSize += size;
+
+        // Oversized allocations are served separately, avoids wasting chunk space
+        if (size > chunkSize / 2) {
+            void* data = allocators.alloc(allocators.userData, size, align, allocators.tag);
+            looseAllocations.push_back(LooseAllocation {
+                .data = data,
+                .align = align
+            });
+            return data;
+        }
+
+        // Try current and any recycled chunks
+        for (; chunkIndex < chunks.size(); chunkIndex++, head = 0) {
+            Chunk& chunk = chunks[chunkIndex];
+
+            // Align the head
+            size_t offset = (reinterpret_cast<size_t>(chunk.data) + head + (align - 1)) & ~(align - 1);
+            offset -= reinterpret_cast<size_t>(chunk.data);
+
+            // Enough space to accommodate?
+            if (offset + size <= chunk.size) {
+                head = offset + size;
+                return chunk.data + offset;
+            }
+        }
+
+        // Allocate new chunk, chunks are aligned to the maximum fundamental alignment
+        Chunk& chunk = chunks.emplace_back();
+        chunk.size = chunkSize;
+        chunk.data = static_cast<uint8_t*>(allocators.alloc(allocators.userData, chunk.size, alignof(std::max_align_t), allocators.tag));
+
+        // Assign to new chunk
+        chunkIndex = static_cast<uint32_t>(chunks.size() - 1);
+        head = size;
+        return chunk.data;
+    }
+
+    /// Reset all allocations, keeps the chunks alive for reuse
+    ///   ! All previous allocations are invalidated
+    void Reset() {
+        chunkIndex = 0;
+        head = 0;
+
+        // Loose allocations are never recycled
+        for (const LooseAllocation& allocation : looseAllocations) {
+            allocators.free(allocators.userData, allocation.data, allocation.align);
+        }
+
+        // Cleanup
+        looseAllocations.clear();
+        allocationCount = 0;
+        allocationSize = 0;
+    }
+
+    /// Release all chunks
+    ///   ! All previous allocations are invalidated
+    void Release() {
+        Reset();
+
+        // Free all chunks
+        for (const Chunk& chunk : chunks) {
+            allocators.free(allocators.userData, chunk.data, alignof(std::max_align_t));
+        }
+
+        // Cleanup
+        chunks.clear();
+    }
+
+    /// Get the allocators for this arena, free's are no-ops
+    /// \return allocators
+    Allocators GetAllocators() {
+        return Allocators {
+            .userData = this,
+            .tag = allocators.tag,
+            .alloc = Allocate,
+            .free = Free
+        };
+    }
+
+    /// Get the number of allocations since the last reset
+    uint64_t GetAllocationCount() const {
+        return allocationCount;
+    }
+
+    /// Get the number of bytes allocated since the last reset
+    uint64_t GetAllocationSize() const {
+        return allocationSize;
+    }
+
+    /// Get the number of live chunks
+    uint32_t GetChunkCount() const {
+        return static_cast<uint32_t>(chunks.size());
+    }
+
+private:
+    static void* Allocate(void* self, size_t size, size_t align, AllocationTag) {
+        return static_cast<ArenaAllocator*>(self)->Allocate(size, align);
+    }
+
+    static void Free(void*, void*, size_t) {
+        // Deferred until reset
+    }
+
+private:
+    struct Chunk {
+        uint8_t* data{nullptr};
+        size_t size{0};
+    };
+
+    struct LooseAllocation {
+        void* data{nullptr};
+        size_t align{0};
+    };
+
+    /// Backing allocators
+    Allocators allocators;
+
+    /// Size of each chunk
+    size_t chunkSize;
+
+    /// All chunks, recycled on resets
+    std::vector<Chunk> chunks;
+
+    /// Oversized allocations, free'd on resets
+    std::vector<LooseAllocation> looseAllocations;
+
+    /// Current chunk
+    uint32_t chunkIndex{0};
+
+    /// Current offset into the current chunk
+    size_t head{0};
+
+    /// Statistics
+    uint64_t allocationCount{0};
+    uint64_t allocationSize{0};
+};
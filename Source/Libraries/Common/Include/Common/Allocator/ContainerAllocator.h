@@ -30,6 +30,9 @@
 #include "AllocatorTag.h"
 #include <Common/Assert.h>
 
+// Std
+#include <cstddef>
+
 template<typename T>
 class ContainerAllocator {
 public:
@@ -75,14 +78,14 @@ public:
     /// \param size expected size
     /// \param align expected alignment
     /// \return base ptr
-    void* allocate_bytes(const size_t size, size_t align = alignof(max_align_t)) {
+    void* allocate_bytes(const size_t size, size_t align = alignof(std::max_align_t)) {
         return static_cast<T*>(allocators.alloc(allocators.userData, size, align, allocators.tag));
     }
 
     /// Deallocate raw
     /// \param ptr base ptr
     /// \param align allocation alignment
-    void deallocate_bytes(void* ptr, size_t, size_t align = alignof(max_align_t)) noexcept {
+    void deallocate_bytes(void* ptr, size_t, size_t align = alignof(std::max_align_t)) noexcept {
         allocators.free(allocators.userData, ptr, align);
     }
 
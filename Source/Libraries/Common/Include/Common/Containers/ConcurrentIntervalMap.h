@@ -0,0 +1,447 @@
+// 
+// The MIT License (MIT)
+// 
+// Copyright (c) 2024 Advanced Micro Devices, Inc.,
+// Fatalist Development AB (Avalanche Studio Group),
+// and Miguel Petersen.
+// 
+// All Rights Reserved.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy 
+// of this software and associated documentation files (the "Software"), to deal 
+// in the Software without restriction, including without limitation the rights 
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies 
+// of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, 
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma once
+
+// Common
+#include <Common/Allocators.h>
+#include <Common/Allocator/Vector.h>
+#include <Common/Containers/ReaderEpoch.h>
+
+// Std
+#include <atomic>
+#include <mutex>
+#include <algorithm>
+#include <type_traits>
+
+namespace Detail {
+    /// Snapshot version counter, unique across all maps
+    inline std::atomic<uint64_t> intervalMapVersionCounter{1};
+}
+
+/// Read optimized interval map, lookups are lock free
+///   Intervals are stored in immutable sorted chunks referenced by an immutable sorted snapshot.
+///   Writers are serialized, copy the affected chunk and the snapshot, and publish the new snapshot.
+///   Retired memory is released in batches once no reader can observe it.
+///   A key resolves to the interval with the greatest base at or below it, if [base, base + length) contains the key.
+/// \tparam UseLastHitCache keep the last hit per thread, validated against the map version
+template<typename K, typename V, bool UseLastHitCache = false>
+class ConcurrentIntervalMap {
+    static_assert(std::is_trivially_copyable_v<K> && std::is_trivially_copyable_v<V>, "Keys and values must be trivially copyable");
+
+public:
+    /// Constructor
+    /// \param allocators allocators for all chunks and snapshots
+    ConcurrentIntervalMap(const Allocators& allocators = {}) : retired(allocators), allocators(allocators) {
+
+    }
+
+    /// Deconstructor, no readers may be present
+    ~ConcurrentIntervalMap() {
+        if (Snapshot* snapshot = live.load(std::memory_order_acquire)) {
+            for (uint32_t i = 0; i < snapshot->chunkCount; i++) {
+                Free(snapshot->Refs()[i].chunk);
+            }
+
+            Free(snapshot);
+        }
+
+        for (void* allocation : retired) {
+            Free(allocation);
+        }
+    }
+
+    /// No copy
+    ConcurrentIntervalMap(const ConcurrentIntervalMap&) = delete;
+    ConcurrentIntervalMap& operator=(const ConcurrentIntervalMap&) = delete;
+
+    /// Add an interval, replaces any interval with the same base
+    /// \param base base of the interval
+    /// \param length length of the interval
+    /// \param value value to assign
+    void Add(K base, K length, V value) {
+        std::lock_guard guard(mutex);
+
+        Entry entry {
+            .base = base,
+            .length = length,
+            .value = value
+        };
+
+        // First interval?
+        Snapshot* previous = live.load(std::memory_order_relaxed);
+        if (!previous || !previous->chunkCount) {
+            Chunk* chunk = AllocateChunk();
+            chunk->count = 1;
+            chunk->entries[0] = entry;
+
+            Publish(CreateSnapshot(previous, 0, 0, &chunk, 1));
+            count.fetch_add(1, std::memory_order_release);
+            return;
+        }
+
+        // Owning chunk, intervals below all others go into the first chunk
+        uint32_t chunkIndex = FindChunk(previous, base);
+        if (chunkIndex == kInvalidIndex) {
+            chunkIndex = 0;
+        }
+
+        const Chunk* source = previous->Refs()[chunkIndex].chunk;
+
+        // Position in chunk
+        uint32_t position = LowerBound(source, base);
+
+        // Replacement?
+        if (position < source->count && source->entries[position].base == base) {
+            Chunk* chunk = AllocateChunk();
+            *chunk = *source;
+            chunk->entries[position] = entry;
+
+            Publish(CreateSnapshot(previous, chunkIndex, 1, &chunk, 1));
+            Retire(const_cast<Chunk*>(source));
+            return;
+        }
+
+        // Merge the new interval
+        Entry merged[kChunkCapacity + 1];
+        std::copy(source->entries, source->entries + position, merged);
+        merged[position] = entry;
+        std::copy(source->entries + position, source->entries + source->count, merged + position + 1);
+
+        // Split if exceeding capacity
+        uint32_t mergedCount = source->count + 1;
+        uint32_t splitCount = mergedCount > kChunkCapacity ? 2 : 1;
+
+        Chunk* chunks[2];
+        for (uint32_t i = 0; i < splitCount; i++) {
+            uint32_t begin = mergedCount * i / splitCount;
+            uint32_t end = mergedCount * (i + 1) / splitCount;
+
+            chunks[i] = AllocateChunk();
+            chunks[i]->count = end - begin;
+            std::copy(merged + begin, merged + end, chunks[i]->entries);
+        }
+
+        Publish(CreateSnapshot(previous, chunkIndex, 1, chunks, splitCount));
+        Retire(const_cast<Chunk*>(source));
+        count.fetch_add(1, std::memory_order_release);
+    }
+
+    /// Remove an interval
+    /// \param base base of the interval
+    /// \return false if not found
+    bool Remove(K base) {
+        std::lock_guard guard(mutex);
+
+        // Empty?
+        Snapshot* previous = live.load(std::memory_order_relaxed);
+        if (!previous) {
+            return false;
+        }
+
+        // Owning chunk
+        uint32_t chunkIndex = FindChunk(previous, base);
+        if (chunkIndex == kInvalidIndex) {
+            return false;
+        }
+
+        const Chunk* source = previous->Refs()[chunkIndex].chunk;
+
+        // Must be exact
+        uint32_t position = LowerBound(source, base);
+        if (position == source->count || source->entries[position].base != base) {
+            return false;
+        }
+
+        // Last interval in chunk drops the chunk
+        if (source->count == 1) {
+            Publish(CreateSnapshot(previous, chunkIndex, 1, nullptr, 0));
+        } else {
+            Chunk* chunk = AllocateChunk();
+            chunk->count = source->count - 1;
+            std::copy(source->entries, source->entries + position, chunk->entries);
+            std::copy(source->entries + position + 1, source->entries + source->count, chunk->entries + position);
+
+            Publish(CreateSnapshot(previous, chunkIndex, 1, &chunk, 1));
+        }
+
+        Retire(const_cast<Chunk*>(source));
+        count.fetch_sub(1, std::memory_order_release);
+        return true;
+    }
+
+    /// Find the interval containing a key, lock free
+    /// \param key key to search for
+    /// \param out value of the interval
+    /// \return false if not found
+    bool Find(K key, V& out) const {
+        // Last hit still valid?
+        if constexpr (UseLastHitCache) {
+            const LastHit& hit = GetLastHit();
+            if (hit.owner == this && hit.version == version.load(std::memory_order_acquire) && Contains(hit.entry, key)) {
+                out = hit.entry.value;
+                return true;
+            }
+        }
+
+        ReaderEpochScope scope;
+
+        // Empty?
+        const Snapshot* snapshot = live.load(std::memory_order_seq_cst);
+        if (!snapshot) {
+            return false;
+        }
+
+        // Owning chunk
+        uint32_t chunkIndex = FindChunk(snapshot, key);
+        if (chunkIndex == kInvalidIndex) {
+            return false;
+        }
+
+        // Greatest base at or below the key, always present as the chunk base is at or below it
+        const Chunk* chunk = snapshot->Refs()[chunkIndex].chunk;
+        const Entry& entry = chunk->entries[UpperBound(chunk, key) - 1];
+        if (!Contains(entry, key)) {
+            return false;
+        }
+
+        // Keep for successive lookups
+        if constexpr (UseLastHitCache) {
+            LastHit& hit = GetLastHit();
+            hit.owner = this;
+            hit.version = snapshot->version;
+            hit.entry = entry;
+        }
+
+        out = entry.value;
+        return true;
+    }
+
+    /// Number of intervals
+    uint32_t Size() const {
+        return count.load(std::memory_order_acquire);
+    }
+
+private:
+    /// Number of intervals per chunk
+    static constexpr uint32_t kChunkCapacity = 64;
+
+    /// Number of retired allocations before reclamation
+    static constexpr uint32_t kRetireBatchCount = 256;
+
+    /// Invalid index
+    static constexpr uint32_t kInvalidIndex = ~0u;
+
+    struct Entry {
+        /// Interval base
+        K base;
+
+        /// Interval length
+        K length;
+
+        /// Assigned value
+        V value;
+    };
+
+    struct Chunk {
+        /// Number of sorted entries
+        uint32_t count{0};
+
+        /// All entries
+        Entry entries[kChunkCapacity];
+    };
+
+    struct ChunkRef {
+        /// First base of the chunk
+        K base;
+
+        /// Immutable chunk
+        Chunk* chunk;
+    };
+
+    struct Snapshot {
+        /// Unique version
+        uint64_t version{0};
+
+        /// Number of sorted chunks
+        uint32_t chunkCount{0};
+
+        /// Get all chunk references, trailing the snapshot
+        ChunkRef* Refs() {
+            return reinterpret_cast<ChunkRef*>(this + 1);
+        }
+
+        /// Get all chunk references, trailing the snapshot
+        const ChunkRef* Refs() const {
+            return reinterpret_cast<const ChunkRef*>(this + 1);
+        }
+    };
+
+    struct LastHit {
+        /// Owning map
+        const ConcurrentIntervalMap* owner{nullptr};
+
+        /// Version of the snapshot the entry was found in
+        uint64_t version{0};
+
+        /// Found entry
+        Entry entry{};
+    };
+
+    static_assert(alignof(Entry) <= kDefaultAlign && alignof(ChunkRef) <= kDefaultAlign, "Unsupported alignment");
+
+    /// Get the last hit of the calling thread
+    static LastHit& GetLastHit() {
+        thread_local LastHit hit;
+        return hit;
+    }
+
+    /// Check if an entry contains a key
+    static bool Contains(const Entry& entry, K key) {
+        return key >= entry.base && key - entry.base < entry.length;
+    }
+
+    /// Find the chunk with the greatest base at or below a key
+    /// \return kInvalidIndex if below all chunks
+    static uint32_t FindChunk(const Snapshot* snapshot, K key) {
+        const ChunkRef* begin = snapshot->Refs();
+        const ChunkRef* it = std::upper_bound(begin, begin + snapshot->chunkCount, key, [](K lhs, const ChunkRef& rhs) {
+            return lhs < rhs.base;
+        });
+
+        if (it == begin) {
+            return kInvalidIndex;
+        }
+
+        return static_cast<uint32_t>(it - begin) - 1;
+    }
+
+    /// Get the first entry not below a key
+    static uint32_t LowerBound(const Chunk* chunk, K key) {
+        return static_cast<uint32_t>(std::lower_bound(chunk->entries, chunk->entries + chunk->count, key, [](const Entry& lhs, K rhs) {
+            return lhs.base < rhs;
+        }) - chunk->entries);
+    }
+
+    /// Get the first entry above a key
+    static uint32_t UpperBound(const Chunk* chunk, K key) {
+        return static_cast<uint32_t>(std::upper_bound(chunk->entries, chunk->entries + chunk->count, key, [](K lhs, const Entry& rhs) {
+            return lhs < rhs.base;
+        }) - chunk->entries);
+    }
+
+    /// Allocate a new chunk
+    Chunk* AllocateChunk() {
+        return new (allocators.alloc(allocators.userData, sizeof(Chunk), kDefaultAlign, allocators.tag)) Chunk;
+    }
+
+    /// Create a snapshot with a range of chunks replaced
+    /// \param previous source snapshot, may be null
+    /// \param index first chunk to replace
+    /// \param replaceCount number of chunks to replace
+    /// \param chunks replacement chunks
+    /// \param chunkCount number of replacement chunks
+    Snapshot* CreateSnapshot(const Snapshot* previous, uint32_t index, uint32_t replaceCount, Chunk* const* chunks, uint32_t chunkCount) {
+        uint32_t previousCount = previous ? previous->chunkCount : 0;
+        uint32_t snapshotChunkCount = previousCount - replaceCount + chunkCount;
+
+        // Snapshot and references in a single allocation
+        void* memory = allocators.alloc(allocators.userData, sizeof(Snapshot) + sizeof(ChunkRef) * snapshotChunkCount, kDefaultAlign, allocators.tag);
+
+        auto* snapshot = new (memory) Snapshot;
+        snapshot->chunkCount = snapshotChunkCount;
+
+        // [0, index) and [index + replaceCount, previousCount) are shared with the previous snapshot
+        ChunkRef* refs = snapshot->Refs();
+        if (previous) {
+            std::copy(previous->Refs(), previous->Refs() + index, refs);
+            std::copy(previous->Refs() + index + replaceCount, previous->Refs() + previousCount, refs + index + chunkCount);
+        }
+
+        // Replacements
+        for (uint32_t i = 0; i < chunkCount; i++) {
+            refs[index + i] = ChunkRef {
+                .base = chunks[i]->entries[0].base,
+                .chunk = chunks[i]
+            };
+        }
+
+        return snapshot;
+    }
+
+    /// Publish a new snapshot, retires the previous one
+    void Publish(Snapshot* snapshot) {
+        snapshot->version = Detail::intervalMapVersionCounter.fetch_add(1, std::memory_order_relaxed);
+
+        // Publish, invalidates all last hits
+        Snapshot* previous = live.exchange(snapshot, std::memory_order_seq_cst);
+        version.store(snapshot->version, std::memory_order_release);
+
+        if (previous) {
+            Retire(previous);
+        }
+    }
+
+    /// Retire an allocation, released once no reader may observe it
+    void Retire(void* allocation) {
+        retired.push_back(allocation);
+
+        // Release in batches to amortize synchronization
+        if (retired.size() >= kRetireBatchCount) {
+            SynchronizeReaderEpoch();
+
+            for (void* retiredAllocation : retired) {
+                Free(retiredAllocation);
+            }
+
+            retired.clear();
+        }
+    }
+
+    /// Free an allocation
+    void Free(void* allocation) {
+        allocators.free(allocators.userData, allocation, kDefaultAlign);
+    }
+
+private:
+    /// Live snapshot
+    std::atomic<Snapshot*> live{nullptr};
+
+    /// Version of the live snapshot
+    std::atomic<uint64_t> version{0};
+
+    /// Number of intervals
+    std::atomic<uint32_t> count{0};
+
+    /// Retired allocations
+    Vector<void*> retired;
+
+    /// Writer lock
+    std::mutex mutex;
+
+    /// Allocators
+    Allocators allocators;
+};
@@ -0,0 +1,261 @@
+// 
+// The MIT License (MIT)
+// 
+// Copyright (c) 2024 Advanced Micro Devices, Inc.,
+// Fatalist Development AB (Avalanche Studio Group),
+// and Miguel Petersen.
+// 
+// All Rights Reserved.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy 
+// of this software and associated documentation files (the "Software"), to deal 
+// in the Software without restriction, including without limitation the rights 
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies 
+// of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, 
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma once
+
+// Common
+#include <Common/Hash.h>
+
+// Std
+#include <atomic>
+#include <mutex>
+#include <memory>
+#include <vector>
+#include <functional>
+#include <type_traits>
+
+/// Read mostly hash map, lookups are lock free
+///   Writers are serialized, entries are published in place with release semantics, and
+///   growth publishes a rehashed table. Retired tables are kept alive until the map is destroyed,
+///   as growth is geometric the retained memory never exceeds that of the live table.
+///   Entries cannot be removed.
+///   Slots are selected on the high bits of the hash, the default hasher mixes identity hashes of
+///   pointer like keys.
+template<typename K, typename V, typename H = MixedHash<K>, typename E = std::equal_to<K>>
+class PublishedHashMap {
+    static_assert(std::is_trivially_copyable_v<K>, "Keys must be trivially copyable");
+
+public:
+    PublishedHashMap() {
+        auto initial = std::make_unique<Table>();
+        initial->capacity = kInitialCapacity;
+        initial->shift = HashSlotShift(kInitialCapacity);
+        initial->entries = std::make_unique<Entry[]>(kInitialCapacity);
+        table.store(initial.get(), std::memory_order_release);
+        tables.push_back(std::move(initial));
+    }
+
+    /// No copy
+    PublishedHashMap(const PublishedHashMap&) = delete;
+    PublishedHashMap& operator=(const PublishedHashMap&) = delete;
+
+    /// Find a value, lock free
+    /// \param key key to search for
+    /// \param out found value
+    /// \return false if not found
+    bool Find(const K& key, V& out) const {
+        if (const Entry* entry = FindEntry(table.load(std::memory_order_acquire), key)) {
+            out = entry->value.load(std::memory_order_acquire);
+            return true;
+        }
+
+        return false;
+    }
+
+    /// Check if a key is present, lock free
+    /// \param key key to search for
+    /// \return false if not found
+    bool Contains(const K& key) const {
+        return FindEntry(table.load(std::memory_order_acquire), key) != nullptr;
+    }
+
+    /// Set a value, inserts if not present
+    /// \param key key to assign
+    /// \param value value to assign
+    void Set(const K& key, const V& value) {
+        std::lock_guard guard(mutex);
+
+        // Existing entries are updated in place
+        if (Entry* entry = FindEntry(table.load(std::memory_order_relaxed), key)) {
+            entry->value.store(value, std::memory_order_release);
+            return;
+        }
+
+        Insert(key, value);
+    }
+
+    /// Insert a value if not already present
+    /// \param key key to insert
+    /// \param value value to insert
+    /// \return false if already present
+    bool TryInsert(const K& key, const V& value) {
+        std::lock_guard guard(mutex);
+
+        // Already present?
+        if (FindEntry(table.load(std::memory_order_relaxed), key)) {
+            return false;
+        }
+
+        Insert(key, value);
+        return true;
+    }
+
+    /// Visit all entries
+    ///   ! Not safe with concurrent writers
+    /// \param functor invoked as (key, value)
+    template<typename F>
+    void ForEach(F&& functor) const {
+        const Table* live = table.load(std::memory_order_acquire);
+
+        for (uint32_t i = 0; i < live->capacity; i++) {
+            const Entry& entry = live->entries[i];
+            if (entry.published.load(std::memory_order_acquire)) {
+                functor(entry.key, entry.value.load(std::memory_order_acquire));
+            }
+        }
+    }
+
+    /// Number of entries
+    uint32_t Size() const {
+        return count.load(std::memory_order_acquire);
+    }
+
+private:
+    struct Entry {
+        /// Set once key and value are visible
+        std::atomic<bool> published{false};
+
+        /// Immutable after publishing
+        K key{};
+
+        /// Mutable value
+        std::atomic<V> value{};
+    };
+
+    struct Table {
+        /// Power of two capacity
+        uint32_t capacity{0};
+
+        /// Slot selection shift, see HashSlot
+        uint32_t shift{0};
+
+        /// All entries
+        std::unique_ptr<Entry[]> entries;
+    };
+
+    /// Find an entry
+    /// \param live table to search
+    /// \param key key to search for
+    /// \return nullptr if not found
+    const Entry* FindEntry(const Table* live, const K& key) const {
+        uint32_t mask = live->capacity - 1;
+
+        // Linear probe until the first unpublished entry
+        for (uint32_t slot = HashSlot(static_cast<uint64_t>(hasher(key)), live->shift);; slot = (slot + 1) & mask) {
+            const Entry& entry = live->entries[slot];
+            if (!entry.published.load(std::memory_order_acquire)) {
+                return nullptr;
+            }
+
+            if (equal(entry.key, key)) {
+                return &entry;
+            }
+        }
+    }
+
+    /// Find an entry
+    /// \param live table to search
+    /// \param key key to search for
+    /// \return nullptr if not found
+    Entry* FindEntry(Table* live, const K& key) {
+        return const_cast<Entry*>(static_cast<const PublishedHashMap*>(this)->FindEntry(live, key));
+    }
+
+    /// Insert a new entry, writer lock must be held
+    /// \param key key to insert
+    /// \param value value to insert
+    void Insert(const K& key, const V& value) {
+        // Keep the load factor at or below one half
+        if ((count.load(std::memory_order_relaxed) + 1) * 2 > table.load(std::memory_order_relaxed)->capacity) {
+            Grow();
+        }
+
+        Place(table.load(std::memory_order_relaxed), key, value);
+        count.fetch_add(1, std::memory_order_release);
+    }
+
+    /// Place an entry in a table
+    /// \param live destination table
+    /// \param key key to place
+    /// \param value value to place
+    void Place(Table* live, const K& key, const V& value) {
+        uint32_t mask = live->capacity - 1;
+
+        // Find first free slot
+        uint32_t slot = HashSlot(static_cast<uint64_t>(hasher(key)), live->shift);
+        while (live->entries[slot].published.load(std::memory_order_relaxed)) {
+            slot = (slot + 1) & mask;
+        }
+
+        // Write contents before publishing
+        Entry& entry = live->entries[slot];
+        entry.key = key;
+        entry.value.store(value, std::memory_order_relaxed);
+        entry.published.store(true, std::memory_order_release);
+    }
+
+    /// Grow the live table
+    void Grow() {
+        Table* previous = table.load(std::memory_order_relaxed);
+
+        // Rehash into a new table while readers continue on the previous one
+        auto next = std::make_unique<Table>();
+        next->capacity = previous->capacity * 2;
+        next->shift = HashSlotShift(next->capacity);
+        next->entries = std::make_unique<Entry[]>(next->capacity);
+
+        for (uint32_t i = 0; i < previous->capacity; i++) {
+            const Entry& entry = previous->entries[i];
+            if (entry.published.load(std::memory_order_relaxed)) {
+                Place(next.get(), entry.key, entry.value.load(std::memory_order_relaxed));
+            }
+        }
+
+        // Publish, previous table stays alive for in-flight readers
+        table.store(next.get(), std::memory_order_release);
+        tables.push_back(std::move(next));
+    }
+
+private:
+    /// Initial number of entries, fits a handful of instruments
+    static constexpr uint32_t kInitialCapacity = 8;
+
+    /// Live table
+    std::atomic<Table*> table{nullptr};
+
+    /// All tables, including retired
+    std::vector<std::unique_ptr<Table>> tables;
+
+    /// Number of entries
+    std::atomic<uint32_t> count{0};
+
+    /// Writer lock
+    std::mutex mutex;
+
+    /// Functors
+    H hasher;
+    E equal;
+};
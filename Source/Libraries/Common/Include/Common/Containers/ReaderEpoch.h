@@ -0,0 +1,111 @@
+// 
+// The MIT License (MIT)
+// 
+// Copyright (c) 2024 Advanced Micro Devices, Inc.,
+// Fatalist Development AB (Avalanche Studio Group),
+// and Miguel Petersen.
+// 
+// All Rights Reserved.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy 
+// of this software and associated documentation files (the "Software"), to deal 
+// in the Software without restriction, including without limitation the rights 
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies 
+// of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, 
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+// Std
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+/// Reader counters, one line per slot to avoid false sharing
+struct alignas(64) ReaderEpochSlot {
+    std::atomic<uint32_t> counters[2]{};
+};
+
+/// Reader tracking shared by all lock free readers
+///   Readers increment the counter of the current phase in their slot for the duration of a read.
+///   Reclamation flips the phase twice, waiting for the previous phase to drain each time, after which
+///   no reader may observe anything retired before the flips.
+struct ReaderEpochDomain {
+    /// Number of reader slots, threads beyond this share slots
+    static constexpr uint32_t kSlotCount = 64;
+
+    /// Current phase
+    std::atomic<uint32_t> phase{0};
+
+    /// All slots
+    ReaderEpochSlot slots[kSlotCount];
+
+    /// Slot allocation counter
+    std::atomic<uint32_t> slotCounter{0};
+
+    /// Serializes reclamation
+    std::mutex synchronizeMutex;
+};
+
+namespace Detail {
+    /// Shared domain
+    inline ReaderEpochDomain readerEpochDomain;
+
+    /// Get the slot of the calling thread
+    inline ReaderEpochSlot& GetReaderEpochSlot() {
+        thread_local uint32_t slot = readerEpochDomain.slotCounter.fetch_add(1, std::memory_order_relaxed) % ReaderEpochDomain::kSlotCount;
+        return readerEpochDomain.slots[slot];
+    }
+}
+
+/// Wait for all readers that may observe retired memory
+inline void SynchronizeReaderEpoch() {
+    ReaderEpochDomain& domain = Detail::readerEpochDomain;
+    std::lock_guard guard(domain.synchronizeMutex);
+
+    // Two flips, a reader may have sampled the phase before the first flip and incremented after it
+    for (uint32_t flip = 0; flip < 2; flip++) {
+        uint32_t previous = domain.phase.load(std::memory_order_relaxed);
+        domain.phase.store(previous ^ 1u, std::memory_order_seq_cst);
+
+        // Wait for the previous phase to drain
+        for (ReaderEpochSlot& slot : domain.slots) {
+            while (slot.counters[previous].load(std::memory_order_seq_cst)) {
+                std::this_thread::yield();
+            }
+        }
+    }
+}
+
+/// Scoped reader section
+class ReaderEpochScope {
+public:
+    ReaderEpochScope() : slot(Detail::GetReaderEpochSlot()) {
+        phase = Detail::readerEpochDomain.phase.load(std::memory_order_seq_cst);
+        slot.counters[phase].fetch_add(1, std::memory_order_seq_cst);
+    }
+
+    ~ReaderEpochScope() {
+        slot.counters[phase].fetch_sub(1, std::memory_order_release);
+    }
+
+    /// No copy
+    ReaderEpochScope(const ReaderEpochScope&) = delete;
+    ReaderEpochScope& operator=(const ReaderEpochScope&) = delete;
+
+private:
+    /// Entered slot
+    ReaderEpochSlot& slot;
+
+    /// Entered phase
+    uint32_t phase;
+};
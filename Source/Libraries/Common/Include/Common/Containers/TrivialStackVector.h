@@ -32,6 +32,7 @@
 
 // Std
 #include <vector>
+#include <cstring>
 
 /// Stack based container, with optional heap fallback
 template<typename T, size_t STACK_LENGTH>
@@ -27,6 +27,7 @@
 #pragma once
 
 // Std
+#include <cstdint>
 #include <functional>
 
 /// Combine a hash value
@@ -35,3 +36,43 @@ inline void CombineHash(std::size_t& hash, T value) {
     std::hash<T> hasher;
     hash ^= (hasher(value) + 0x9e3779b9 + (hash << 6) + (hash >> 2));
 }
+
+/// Mix all bits of a hash value, murmur3 finalizer
+///   Standard hashes of integers and pointers are commonly the identity, leaving aligned keys
+///   with constant low bits
+inline uint64_t MixHash(uint64_t hash) {
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdull;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ull;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+/// Get the slot of a hash in a power of two table, Fibonacci hashing
+///   Selects the high bits of the product, which depend on all bits of the hash
+/// \param hash hash value
+/// \param shift 64 minus the log2 of the table capacity
+inline uint32_t HashSlot(uint64_t hash, uint32_t shift) {
+    return static_cast<uint32_t>((hash * 0x9e3779b97f4a7c15ull) >> shift);
+}
+
+/// Get the slot shift of a power of two table
+/// \param capacity power of two capacity, at least two
+inline uint32_t HashSlotShift(uint32_t capacity) {
+    uint32_t shift = 64;
+    while (capacity > 1) {
+        capacity >>= 1;
+        shift--;
+    }
+
+    return shift;
+}
+
+/// Standard hasher with mixed bits
+template <class T>
+struct MixedHash {
+    std::size_t operator()(const T& value) const {
+        return static_cast<std::size_t>(MixHash(static_cast<uint64_t>(std::hash<T>{}(value))));
+    }
+};
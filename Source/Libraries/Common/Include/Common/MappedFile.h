@@ -0,0 +1,76 @@
+// 
+// The MIT License (MIT)
+// 
+// Copyright (c) 2024 Advanced Micro Devices, Inc.,
+// Fatalist Development AB (Avalanche Studio Group),
+// and Miguel Petersen.
+// 
+// All Rights Reserved.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy 
+// of this software and associated documentation files (the "Software"), to deal 
+// in the Software without restriction, including without limitation the rights 
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies 
+// of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, 
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma once
+
+// Std
+#include <cstdint>
+#include <filesystem>
+
+/// Read only memory mapped file
+class MappedFile {
+public:
+    MappedFile() = default;
+
+    /// Deconstructor
+    ~MappedFile();
+
+    /// No copy
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /// Map a file
+    ///   ! The file may be deleted while mapped
+    /// \param path path of the file
+    /// \return false if failed, empty files cannot be mapped
+    bool Open(const std::filesystem::path& path);
+
+    /// Unmap the file
+    void Close();
+
+    /// Get the mapped contents
+    const uint8_t* GetData() const {
+        return data;
+    }
+
+    /// Get the byte size of the mapped contents
+    uint64_t GetSize() const {
+        return size;
+    }
+
+private:
+#if defined(_MSC_VER)
+    /// File handles
+    void* file{nullptr};
+    void* mapping{nullptr};
+#endif // defined(_MSC_VER)
+
+    /// Mapped contents
+    const uint8_t* data{nullptr};
+
+    /// Byte size of the contents
+    uint64_t size{0};
+};
@@ -0,0 +1,100 @@
+// 
+// The MIT License (MIT)
+// 
+// Copyright (c) 2024 Advanced Micro Devices, Inc.,
+// Fatalist Development AB (Avalanche Studio Group),
+// and Miguel Petersen.
+// 
+// All Rights Reserved.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy 
+// of this software and associated documentation files (the "Software"), to deal 
+// in the Software without restriction, including without limitation the rights 
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies 
+// of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, 
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma once
+
+// Std
+#include <map>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <cstdint>
+
+/// Number of concurrent readers, typical of heavily threaded recording
+static constexpr uint32_t kContentionReaderCount = 16;
+
+/// Number of lookups per reader
+static constexpr uint32_t kContentionLookupCount = 10'000;
+
+/// Run a functor on all readers and wait for completion
+/// \param functor invoked as (reader)
+template<typename F>
+inline void RunContentionReaders(F&& functor) {
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < kContentionReaderCount; i++) {
+        threads.emplace_back([&functor, i] { functor(i); });
+    }
+
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+}
+
+/// Run all lookups on all readers and wait for completion
+/// \param lookup invoked as (reader, lookup index), returns the value looked up
+/// \return sum of all looked up values, keeps the lookups alive
+template<typename F>
+inline uint64_t RunContentionLookups(F&& lookup) {
+    std::atomic<uint64_t> sum{0};
+    RunContentionReaders([&](uint32_t reader) {
+        uint64_t local = 0;
+        for (uint32_t i = 0; i < kContentionLookupCount; i++) {
+            local += static_cast<uint64_t>(lookup(reader, i));
+        }
+        sum += local;
+    });
+    return sum.load();
+}
+
+/// Locked ordered map, the baseline of all lock free containers
+template<typename K, typename V>
+class LockedContentionMap {
+public:
+    /// Assign a value
+    void Set(const K& key, const V& value) {
+        std::lock_guard guard(mutex);
+        entries[key] = value;
+    }
+
+    /// Remove a value
+    void Remove(const K& key) {
+        std::lock_guard guard(mutex);
+        entries.erase(key);
+    }
+
+    /// Read the map under the lock
+    /// \param functor invoked as (entries)
+    template<typename F>
+    auto Read(F&& functor) {
+        std::lock_guard guard(mutex);
+        return functor(static_cast<const std::map<K, V>&>(entries));
+    }
+
+private:
+    std::map<K, V> entries;
+    std::mutex mutex;
+};
@@ -50,6 +50,11 @@ namespace Studio.ViewModels.Reports
         /// </summary>
         public int FailedPipelines { get; set; }
 
+        /// <summary>
+        /// Number of instrumentation checks statically proven redundant
+        /// </summary>
+        public int ElidedChecks { get; set; }
+
         /// <summary>
         /// Shader compilation time (milliseconds)
         /// </summary>
@@ -101,6 +101,9 @@ namespace Studio.ViewModels.Workspace.Properties
                         case InstrumentationDiagnosticMessage.ID:
                             Handle(message.Get<InstrumentationDiagnosticMessage>(), events);
                             break;
+                        case ExportOverflowDiagnosticMessage.ID:
+                            Handle(message.Get<ExportOverflowDiagnosticMessage>(), events);
+                            break;
                     }
                 }
             }
@@ -159,6 +162,7 @@ namespace Studio.ViewModels.Workspace.Properties
                 FailedShaders = (int)message.failedShaders,
                 PassedPipelines = (int)message.passedPipelines,
                 FailedPipelines = (int)message.failedPipelines,
+                ElidedChecks = (int)message.elidedChecks,
                 TotalMilliseconds = (int)message.millisecondsTotal,
                 ShaderMilliseconds = (int)message.millisecondsShaders,
                 PipelineMilliseconds = (int)message.millisecondsPipelines
@@ -190,6 +194,18 @@ namespace Studio.ViewModels.Workspace.Properties
             });
         }
 
+        /// <summary>
+        /// Handle an export overflow
+        /// </summary>
+        public void Handle(ExportOverflowDiagnosticMessage message, List<LogEvent> events)
+        {
+            events.Add(new LogEvent
+            {
+                Severity = LogSeverity.Warning,
+                Message = $"{ConnectionViewModel?.Application?.Name} - Dropped {message.droppedMessages} messages from export {message.exportID}, stream of {message.streamByteSize} bytes exhausted"
+            });
+        }
+
         /// <summary>
         /// Shared logging view model
         /// </summary>